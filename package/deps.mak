@@ -2,15 +2,16 @@
 # This file has been generated by tools/gen-deps.sh
 #
 
-src/include/66/66.h: src/include/66/config.h src/include/66/constants.h src/include/66/enum.h src/include/66/environ.h src/include/66/graph.h src/include/66/hash.h src/include/66/hpr.h src/include/66/info.h src/include/66/instance.h src/include/66/migrate.h src/include/66/module.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/snapshot.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/symlink.h src/include/66/tree.h src/include/66/utils.h src/include/66/write.h
+src/include/66/66.h: src/include/66/config.h src/include/66/constants.h src/include/66/enum.h src/include/66/environ.h src/include/66/graph.h src/include/66/hash.h src/include/66/hpr.h src/include/66/info.h src/include/66/instance.h src/include/66/migrate.h src/include/66/module.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/snapshot.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/symlink.h src/include/66/trace.h src/include/66/tree.h src/include/66/utils.h src/include/66/write.h
 src/include/66/constants.h: src/include/66/config.h
 src/include/66/environ.h: src/include/66/parse.h src/include/66/service.h
 src/include/66/graph.h: src/include/66/hash.h src/include/66/service.h src/include/66/ssexec.h src/include/66/tree.h
 src/include/66/hpr.h: src/include/66/constants.h
 src/include/66/info.h: src/include/66/enum.h src/include/66/service.h
 src/include/66/instance.h: src/include/66/service.h src/include/66/ssexec.h
-src/include/66/migrate.h: src/include/66/migrate_0721.h
+src/include/66/migrate.h: src/include/66/migrate_0721.h src/include/66/migrate_record.h
 src/include/66/migrate_0721.h: src/include/66/ssexec.h
+src/include/66/migrate_record.h: src/include/66/ssexec.h
 src/include/66/module.h: src/include/66/info.h src/include/66/service.h
 src/include/66/parse.h: src/include/66/enum.h src/include/66/service.h src/include/66/ssexec.h
 src/include/66/sanitize.h: src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h
@@ -20,6 +21,7 @@ src/include/66/ssexec.h: src/include/66/config.h
 src/include/66/state.h: src/include/66/service.h
 src/include/66/svc.h: src/include/66/graph.h src/include/66/service.h src/include/66/ssexec.h
 src/include/66/symlink.h: src/include/66/service.h
+src/include/66/trace.h: src/include/66/constants.h
 src/include/66/tree.h: src/include/66/hash.h src/include/66/resolve.h src/include/66/ssexec.h
 src/include/66/utils.h: src/include/66/ssexec.h
 src/include/66/write.h: src/include/66/service.h
@@ -44,7 +46,8 @@ src/lib66/environ/env_import_version_file.o src/lib66/environ/env_import_version
 src/lib66/environ/env_make_symlink.o src/lib66/environ/env_make_symlink.lo: src/lib66/environ/env_make_symlink.c src/include/66/constants.h src/include/66/environ.h src/include/66/parse.h src/include/66/service.h
 src/lib66/environ/env_prepare_for_write.o src/lib66/environ/env_prepare_for_write.lo: src/lib66/environ/env_prepare_for_write.c src/include/66/constants.h src/include/66/environ.h src/include/66/parse.h src/include/66/service.h
 src/lib66/environ/env_resolve_conf.o src/lib66/environ/env_resolve_conf.lo: src/lib66/environ/env_resolve_conf.c src/include/66/constants.h src/include/66/environ.h src/include/66/service.h src/include/66/utils.h
-src/lib66/exec/ssexec_boot.o src/lib66/exec/ssexec_boot.lo: src/lib66/exec/ssexec_boot.c src/include/66/config.h src/include/66/constants.h src/include/66/ssexec.h
+src/lib66/exec/ssexec_analyze.o src/lib66/exec/ssexec_analyze.lo: src/lib66/exec/ssexec_analyze.c src/include/66/constants.h src/include/66/ssexec.h src/include/66/trace.h
+src/lib66/exec/ssexec_boot.o src/lib66/exec/ssexec_boot.lo: src/lib66/exec/ssexec_boot.c src/include/66/config.h src/include/66/constants.h src/include/66/sanitize.h src/include/66/ssexec.h src/include/66/trace.h src/include/66/utils.h
 src/lib66/exec/ssexec_configure.o src/lib66/exec/ssexec_configure.lo: src/lib66/exec/ssexec_configure.c src/include/66/config.h src/include/66/constants.h src/include/66/environ.h src/include/66/resolve.h src/include/66/ssexec.h src/include/66/state.h src/include/66/utils.h src/include/66/write.h
 src/lib66/exec/ssexec_copy.o src/lib66/exec/ssexec_copy.lo: src/lib66/exec/ssexec_copy.c src/include/66/ssexec.h
 src/lib66/exec/ssexec_disable.o src/lib66/exec/ssexec_disable.lo: src/lib66/exec/ssexec_disable.c src/include/66/config.h src/include/66/constants.h src/include/66/graph.h src/include/66/resolve.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h
@@ -75,14 +78,16 @@ src/lib66/exec/ssexec_stop.o src/lib66/exec/ssexec_stop.lo: src/lib66/exec/ssexe
 src/lib66/exec/ssexec_tree_admin.o src/lib66/exec/ssexec_tree_admin.lo: src/lib66/exec/ssexec_tree_admin.c src/include/66/config.h src/include/66/constants.h src/include/66/enum.h src/include/66/graph.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/state.h src/include/66/tree.h src/include/66/utils.h
 src/lib66/exec/ssexec_tree_init.o src/lib66/exec/ssexec_tree_init.lo: src/lib66/exec/ssexec_tree_init.c src/include/66/config.h src/include/66/constants.h src/include/66/graph.h src/include/66/sanitize.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/tree.h
 src/lib66/exec/ssexec_tree_resolve.o src/lib66/exec/ssexec_tree_resolve.lo: src/lib66/exec/ssexec_tree_resolve.c src/include/66/config.h src/include/66/constants.h src/include/66/info.h src/include/66/resolve.h src/include/66/ssexec.h src/include/66/state.h src/include/66/tree.h
-src/lib66/exec/ssexec_tree_signal.o src/lib66/exec/ssexec_tree_signal.lo: src/lib66/exec/ssexec_tree_signal.c src/include/66/constants.h src/include/66/graph.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/tree.h src/include/66/utils.h
+src/lib66/exec/ssexec_tree_signal.o src/lib66/exec/ssexec_tree_signal.lo: src/lib66/exec/ssexec_tree_signal.c src/include/66/constants.h src/include/66/graph.h src/include/66/hash.h src/include/66/sanitize.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/trace.h src/include/66/tree.h src/include/66/utils.h
 src/lib66/exec/ssexec_tree_status.o src/lib66/exec/ssexec_tree_status.lo: src/lib66/exec/ssexec_tree_status.c src/include/66/constants.h src/include/66/enum.h src/include/66/graph.h src/include/66/hash.h src/include/66/info.h src/include/66/resolve.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/tree.h
 src/lib66/exec/ssexec_tree_wrapper.o src/lib66/exec/ssexec_tree_wrapper.lo: src/lib66/exec/ssexec_tree_wrapper.c src/include/66/config.h src/include/66/ssexec.h
 src/lib66/graph/graph_build_arguments.o src/lib66/graph/graph_build_arguments.lo: src/lib66/graph/graph_build_arguments.c src/include/66/graph.h src/include/66/hash.h src/include/66/ssexec.h
 src/lib66/graph/graph_build_system.o src/lib66/graph/graph_build_system.lo: src/lib66/graph/graph_build_system.c src/include/66/constants.h src/include/66/graph.h src/include/66/service.h src/include/66/ssexec.h
 src/lib66/graph/graph_build_tree.o src/lib66/graph/graph_build_tree.lo: src/lib66/graph/graph_build_tree.c src/include/66/constants.h src/include/66/graph.h src/include/66/resolve.h src/include/66/tree.h
-src/lib66/graph/graph_compute_dependencies.o src/lib66/graph/graph_compute_dependencies.lo: src/lib66/graph/graph_compute_dependencies.c
+src/lib66/graph/graph_compute_dependencies.o src/lib66/graph/graph_compute_dependencies.lo: src/lib66/graph/graph_compute_dependencies.c src/include/66/graph.h
 src/lib66/graph/graph_compute_visit.o src/lib66/graph/graph_compute_visit.lo: src/lib66/graph/graph_compute_visit.c src/include/66/enum.h src/include/66/graph.h src/include/66/service.h
+src/lib66/graph/graph_csr.o src/lib66/graph/graph_csr.lo: src/lib66/graph/graph_csr.c src/include/66/graph.h src/include/66/hash.h
+src/lib66/graph/graph_csr_cycle.o src/lib66/graph/graph_csr_cycle.lo: src/lib66/graph/graph_csr_cycle.c src/include/66/graph.h
 src/lib66/graph/graph_remove_deps.o src/lib66/graph/graph_remove_deps.lo: src/lib66/graph/graph_remove_deps.c
 src/lib66/info/info_display_field_name.o src/lib66/info/info_display_field_name.lo: src/lib66/info/info_display_field_name.c src/include/66/info.h
 src/lib66/info/info_display_list.o src/lib66/info/info_display_list.lo: src/lib66/info/info_display_list.c src/include/66/info.h
@@ -95,11 +100,13 @@ src/lib66/info/info_graph_display_tree.o src/lib66/info/info_graph_display_tree.
 src/lib66/info/info_graph_init.o src/lib66/info/info_graph_init.lo: src/lib66/info/info_graph_init.c src/include/66/info.h
 src/lib66/info/info_length_from_wchar.o src/lib66/info/info_length_from_wchar.lo: src/lib66/info/info_length_from_wchar.c src/include/66/info.h
 src/lib66/info/info_walk.o src/lib66/info/info_walk.lo: src/lib66/info/info_walk.c src/include/66/graph.h src/include/66/info.h
+src/lib66/info/info_watch.o src/lib66/info/info_watch.lo: src/lib66/info/info_watch.c src/include/66/constants.h src/include/66/enum.h src/include/66/info.h src/include/66/service.h src/include/66/state.h
 src/lib66/instance/instance_check.o src/lib66/instance/instance_check.lo: src/lib66/instance/instance_check.c src/include/66/utils.h
 src/lib66/instance/instance_create.o src/lib66/instance/instance_create.lo: src/lib66/instance/instance_create.c
 src/lib66/instance/instance_splitname.o src/lib66/instance/instance_splitname.lo: src/lib66/instance/instance_splitname.c src/include/66/utils.h
 src/lib66/instance/instance_splitname_to_char.o src/lib66/instance/instance_splitname_to_char.lo: src/lib66/instance/instance_splitname_to_char.c
 src/lib66/migrate/migrate_0721.o src/lib66/migrate/migrate_0721.lo: src/lib66/migrate/migrate_0721.c src/include/66/constants.h src/include/66/enum.h src/include/66/instance.h src/include/66/migrate_0721.h src/include/66/module.h src/include/66/parse.h src/include/66/resolve.h src/include/66/ssexec.h src/include/66/tree.h src/include/66/utils.h src/include/66/write.h
+src/lib66/migrate/migrate_record.o src/lib66/migrate/migrate_record.lo: src/lib66/migrate/migrate_record.c src/include/66/config.h src/include/66/constants.h src/include/66/migrate_record.h src/include/66/resolve.h src/include/66/service.h src/include/66/ssexec.h
 src/lib66/module/get_list.o src/lib66/module/get_list.lo: src/lib66/module/get_list.c src/include/66/module.h
 src/lib66/module/parse_module.o src/lib66/module/parse_module.lo: src/lib66/module/parse_module.c src/include/66/constants.h src/include/66/info.h src/include/66/instance.h src/include/66/module.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/state.h src/include/66/utils.h
 src/lib66/module/parse_module_check_dir.o src/lib66/module/parse_module_check_dir.lo: src/lib66/module/parse_module_check_dir.c
@@ -122,7 +129,7 @@ src/lib66/parse/parse_get_value_of_key.o src/lib66/parse/parse_get_value_of_key.
 src/lib66/parse/parse_interdependences.o src/lib66/parse/parse_interdependences.lo: src/lib66/parse/parse_interdependences.c src/include/66/constants.h src/include/66/instance.h src/include/66/module.h src/include/66/parse.h src/include/66/resolve.h src/include/66/service.h src/include/66/ssexec.h src/include/66/utils.h
 src/lib66/parse/parse_key.o src/lib66/parse/parse_key.lo: src/lib66/parse/parse_key.c src/include/66/enum.h src/include/66/parse.h
 src/lib66/parse/parse_list.o src/lib66/parse/parse_list.lo: src/lib66/parse/parse_list.c src/include/66/parse.h
-src/lib66/parse/parse_mandatory.o src/lib66/parse/parse_mandatory.lo: src/lib66/parse/parse_mandatory.c src/include/66/enum.h src/include/66/parse.h src/include/66/resolve.h
+src/lib66/parse/parse_mandatory.o src/lib66/parse/parse_mandatory.lo: src/lib66/parse/parse_mandatory.c src/include/66/constants.h src/include/66/enum.h src/include/66/parse.h src/include/66/resolve.h
 src/lib66/parse/parse_rename_interdependences.o src/lib66/parse/parse_rename_interdependences.lo: src/lib66/parse/parse_rename_interdependences.c src/include/66/constants.h src/include/66/enum.h src/include/66/hash.h src/include/66/parse.h src/include/66/resolve.h src/include/66/service.h
 src/lib66/parse/parse_section.o src/lib66/parse/parse_section.lo: src/lib66/parse/parse_section.c src/include/66/enum.h src/include/66/parse.h src/include/66/resolve.h
 src/lib66/parse/parse_service.o src/lib66/parse/parse_service.lo: src/lib66/parse/parse_service.c src/include/66/config.h src/include/66/constants.h src/include/66/enum.h src/include/66/graph.h src/include/66/hash.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/symlink.h src/include/66/tree.h src/include/66/write.h
@@ -136,8 +143,12 @@ src/lib66/parse/parse_value.o src/lib66/parse/parse_value.lo: src/lib66/parse/pa
 src/lib66/resolve/resolve_add_cdb.o src/lib66/resolve/resolve_add_cdb.lo: src/lib66/resolve/resolve_add_cdb.c src/include/66/resolve.h
 src/lib66/resolve/resolve_add_cdb_uint.o src/lib66/resolve/resolve_add_cdb_uint.lo: src/lib66/resolve/resolve_add_cdb_uint.c src/include/66/resolve.h
 src/lib66/resolve/resolve_add_string.o src/lib66/resolve/resolve_add_string.lo: src/lib66/resolve/resolve_add_string.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
+src/lib66/resolve/resolve_cache.o src/lib66/resolve/resolve_cache.lo: src/lib66/resolve/resolve_cache.c src/include/66/hash.h src/include/66/resolve.h
 src/lib66/resolve/resolve_check.o src/lib66/resolve/resolve_check.lo: src/lib66/resolve/resolve_check.c src/include/66/constants.h src/include/66/resolve.h
 src/lib66/resolve/resolve_check_g.o src/lib66/resolve/resolve_check_g.lo: src/lib66/resolve/resolve_check_g.c src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_db_invalidate.o src/lib66/resolve/resolve_db_invalidate.lo: src/lib66/resolve/resolve_db_invalidate.c src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_db_read.o src/lib66/resolve/resolve_db_read.lo: src/lib66/resolve/resolve_db_read.c src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_db_sync.o src/lib66/resolve/resolve_db_sync.lo: src/lib66/resolve/resolve_db_sync.c src/include/66/constants.h src/include/66/resolve.h
 src/lib66/resolve/resolve_free.o src/lib66/resolve/resolve_free.lo: src/lib66/resolve/resolve_free.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
 src/lib66/resolve/resolve_get_field_tosa.o src/lib66/resolve/resolve_get_field_tosa.lo: src/lib66/resolve/resolve_get_field_tosa.c src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
 src/lib66/resolve/resolve_get_field_tosa_g.o src/lib66/resolve/resolve_get_field_tosa_g.lo: src/lib66/resolve/resolve_get_field_tosa_g.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
@@ -148,14 +159,17 @@ src/lib66/resolve/resolve_modify_field.o src/lib66/resolve/resolve_modify_field.
 src/lib66/resolve/resolve_modify_field_g.o src/lib66/resolve/resolve_modify_field_g.lo: src/lib66/resolve/resolve_modify_field_g.c src/include/66/resolve.h
 src/lib66/resolve/resolve_open_cdb.o src/lib66/resolve/resolve_open_cdb.lo: src/lib66/resolve/resolve_open_cdb.c
 src/lib66/resolve/resolve_read.o src/lib66/resolve/resolve_read.lo: src/lib66/resolve/resolve_read.c src/include/66/constants.h src/include/66/resolve.h
-src/lib66/resolve/resolve_read_cdb.o src/lib66/resolve/resolve_read_cdb.lo: src/lib66/resolve/resolve_read_cdb.c src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
-src/lib66/resolve/resolve_read_g.o src/lib66/resolve/resolve_read_g.lo: src/lib66/resolve/resolve_read_g.c src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_read_cdb.o src/lib66/resolve/resolve_read_cdb.lo: src/lib66/resolve/resolve_read_cdb.c src/include/66/resolve.h
+src/lib66/resolve/resolve_read_g.o src/lib66/resolve/resolve_read_g.lo: src/lib66/resolve/resolve_read_g.c src/include/66/config.h src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_read_map.o src/lib66/resolve/resolve_read_map.lo: src/lib66/resolve/resolve_read_map.c src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
 src/lib66/resolve/resolve_remove.o src/lib66/resolve/resolve_remove.lo: src/lib66/resolve/resolve_remove.c src/include/66/constants.h src/include/66/resolve.h
-src/lib66/resolve/resolve_remove_g.o src/lib66/resolve/resolve_remove_g.lo: src/lib66/resolve/resolve_remove_g.c src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_remove_g.o src/lib66/resolve/resolve_remove_g.lo: src/lib66/resolve/resolve_remove_g.c src/include/66/config.h src/include/66/constants.h src/include/66/resolve.h
 src/lib66/resolve/resolve_set_struct.o src/lib66/resolve/resolve_set_struct.lo: src/lib66/resolve/resolve_set_struct.c src/include/66/resolve.h
+src/lib66/resolve/resolve_txn.o src/lib66/resolve/resolve_txn.lo: src/lib66/resolve/resolve_txn.c src/include/66/config.h src/include/66/constants.h src/include/66/hash.h src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
+src/lib66/resolve/resolve_view_free.o src/lib66/resolve/resolve_view_free.lo: src/lib66/resolve/resolve_view_free.c src/include/66/resolve.h
 src/lib66/resolve/resolve_write.o src/lib66/resolve/resolve_write.lo: src/lib66/resolve/resolve_write.c src/include/66/constants.h src/include/66/resolve.h
 src/lib66/resolve/resolve_write_cdb.o src/lib66/resolve/resolve_write_cdb.lo: src/lib66/resolve/resolve_write_cdb.c src/include/66/resolve.h src/include/66/service.h src/include/66/tree.h
-src/lib66/resolve/resolve_write_g.o src/lib66/resolve/resolve_write_g.lo: src/lib66/resolve/resolve_write_g.c src/include/66/constants.h src/include/66/resolve.h
+src/lib66/resolve/resolve_write_g.o src/lib66/resolve/resolve_write_g.lo: src/lib66/resolve/resolve_write_g.c src/include/66/config.h src/include/66/constants.h src/include/66/resolve.h
 src/lib66/sanitize/sanitize_fdholder.o src/lib66/sanitize/sanitize_fdholder.lo: src/lib66/sanitize/sanitize_fdholder.c src/include/66/constants.h src/include/66/enum.h src/include/66/service.h src/include/66/state.h src/include/66/svc.h
 src/lib66/sanitize/sanitize_graph.o src/lib66/sanitize/sanitize_graph.lo: src/lib66/sanitize/sanitize_graph.c src/include/66/constants.h src/include/66/enum.h src/include/66/graph.h src/include/66/hash.h src/include/66/parse.h src/include/66/resolve.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h
 src/lib66/sanitize/sanitize_init.o src/lib66/sanitize/sanitize_init.lo: src/lib66/sanitize/sanitize_init.c src/include/66/constants.h src/include/66/enum.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/symlink.h src/include/66/utils.h
@@ -163,7 +177,7 @@ src/lib66/sanitize/sanitize_livestate.o src/lib66/sanitize/sanitize_livestate.lo
 src/lib66/sanitize/sanitize_migrate.o src/lib66/sanitize/sanitize_migrate.lo: src/lib66/sanitize/sanitize_migrate.c src/include/66/constants.h src/include/66/migrate_0721.h src/include/66/sanitize.h src/include/66/ssexec.h src/include/66/utils.h
 src/lib66/sanitize/sanitize_scandir.o src/lib66/sanitize/sanitize_scandir.lo: src/lib66/sanitize/sanitize_scandir.c src/include/66/constants.h src/include/66/enum.h src/include/66/sanitize.h src/include/66/service.h src/include/66/state.h src/include/66/svc.h
 src/lib66/sanitize/sanitize_source.o src/lib66/sanitize/sanitize_source.lo: src/lib66/sanitize/sanitize_source.c src/include/66/constants.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/state.h
-src/lib66/sanitize/sanitize_system.o src/lib66/sanitize/sanitize_system.lo: src/lib66/sanitize/sanitize_system.c src/include/66/config.h src/include/66/constants.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/ssexec.h src/include/66/state.h src/include/66/tree.h src/include/66/utils.h src/include/66/write.h
+src/lib66/sanitize/sanitize_system.o src/lib66/sanitize/sanitize_system.lo: src/lib66/sanitize/sanitize_system.c src/include/66/config.h src/include/66/constants.h src/include/66/migrate.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/ssexec.h src/include/66/state.h src/include/66/tree.h src/include/66/utils.h src/include/66/write.h
 src/lib66/sanitize/sanitize_write.o src/lib66/sanitize/sanitize_write.lo: src/lib66/sanitize/sanitize_write.c src/include/66/constants.h src/include/66/enum.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/state.h src/include/66/svc.h src/include/66/tree.h
 src/lib66/service/service_cmp_basedir.o src/lib66/service/service_cmp_basedir.lo: src/lib66/service/service_cmp_basedir.c src/include/66/constants.h src/include/66/service.h src/include/66/utils.h
 src/lib66/service/service_db_migrate.o src/lib66/service/service_db_migrate.lo: src/lib66/service/service_db_migrate.c src/include/66/resolve.h src/include/66/service.h
@@ -180,9 +194,13 @@ src/lib66/service/service_is_g.o src/lib66/service/service_is_g.lo: src/lib66/se
 src/lib66/service/service_resolve_get_field_tosa.o src/lib66/service/service_resolve_get_field_tosa.lo: src/lib66/service/service_resolve_get_field_tosa.c src/include/66/resolve.h src/include/66/service.h
 src/lib66/service/service_resolve_modify_field.o src/lib66/service/service_resolve_modify_field.lo: src/lib66/service/service_resolve_modify_field.c src/include/66/resolve.h src/include/66/service.h
 src/lib66/service/service_resolve_read_cdb.o src/lib66/service/service_resolve_read_cdb.lo: src/lib66/service/service_resolve_read_cdb.c src/include/66/resolve.h src/include/66/service.h
+src/lib66/service/service_resolve_read_record.o src/lib66/service/service_resolve_read_record.lo: src/lib66/service/service_resolve_read_record.c src/include/66/resolve.h src/include/66/service.h
 src/lib66/service/service_resolve_sanitize.o src/lib66/service/service_resolve_sanitize.lo: src/lib66/service/service_resolve_sanitize.c src/include/66/resolve.h src/include/66/service.h
+src/lib66/service/service_resolve_view_g.o src/lib66/service/service_resolve_view_g.lo: src/lib66/service/service_resolve_view_g.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h
+src/lib66/service/service_resolve_view_record.o src/lib66/service/service_resolve_view_record.lo: src/lib66/service/service_resolve_view_record.c src/include/66/resolve.h src/include/66/service.h
 src/lib66/service/service_resolve_write.o src/lib66/service/service_resolve_write.lo: src/lib66/service/service_resolve_write.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h
 src/lib66/service/service_resolve_write_cdb.o src/lib66/service/service_resolve_write_cdb.lo: src/lib66/service/service_resolve_write_cdb.c src/include/66/resolve.h src/include/66/service.h
+src/lib66/service/service_resolve_write_record.o src/lib66/service/service_resolve_write_record.lo: src/lib66/service/service_resolve_write_record.c src/include/66/resolve.h src/include/66/service.h
 src/lib66/service/service_resolve_write_remote.o src/lib66/service/service_resolve_write_remote.lo: src/lib66/service/service_resolve_write_remote.c src/include/66/constants.h src/include/66/parse.h src/include/66/service.h
 src/lib66/service/service_resolve_zero.o src/lib66/service/service_resolve_zero.lo: src/lib66/service/service_resolve_zero.c src/include/66/service.h
 src/lib66/service/service_switch_tree.o src/lib66/service/service_switch_tree.lo: src/lib66/service/service_switch_tree.c src/include/66/resolve.h src/include/66/service.h src/include/66/ssexec.h src/include/66/tree.h
@@ -190,25 +208,38 @@ src/lib66/shutdown/hpr_shutdown.o src/lib66/shutdown/hpr_shutdown.lo: src/lib66/
 src/lib66/shutdown/hpr_wall.o src/lib66/shutdown/hpr_wall.lo: src/lib66/shutdown/hpr_wall.c src/include/66/hpr.h
 src/lib66/shutdown/hpr_wallv.o src/lib66/shutdown/hpr_wallv.lo: src/lib66/shutdown/hpr_wallv.c src/include/66/hpr.h
 src/lib66/state/state_check.o src/lib66/state/state_check.lo: src/lib66/state/state_check.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
+src/lib66/state/state_latency.o src/lib66/state/state_latency.lo: src/lib66/state/state_latency.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
 src/lib66/state/state_messenger.o src/lib66/state/state_messenger.lo: src/lib66/state/state_messenger.c src/include/66/service.h src/include/66/state.h
+src/lib66/state/state_notify.o src/lib66/state/state_notify.lo: src/lib66/state/state_notify.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
 src/lib66/state/state_pack.o src/lib66/state/state_pack.lo: src/lib66/state/state_pack.c src/include/66/state.h
-src/lib66/state/state_read.o src/lib66/state/state_read.lo: src/lib66/state/state_read.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
+src/lib66/state/state_read.o src/lib66/state/state_read.lo: src/lib66/state/state_read.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h src/include/66/state.h
+src/lib66/state/state_read_array.o src/lib66/state/state_read_array.lo: src/lib66/state/state_read_array.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
 src/lib66/state/state_read_remote.o src/lib66/state/state_read_remote.lo: src/lib66/state/state_read_remote.c src/include/66/constants.h src/include/66/state.h
 src/lib66/state/state_rmfile.o src/lib66/state/state_rmfile.lo: src/lib66/state/state_rmfile.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
 src/lib66/state/state_set_flag.o src/lib66/state/state_set_flag.lo: src/lib66/state/state_set_flag.c src/include/66/state.h
+src/lib66/state/state_table.o src/lib66/state/state_table.lo: src/lib66/state/state_table.c src/include/66/config.h src/include/66/constants.h src/include/66/hash.h src/include/66/service.h src/include/66/state.h
 src/lib66/state/state_unpack.o src/lib66/state/state_unpack.lo: src/lib66/state/state_unpack.c src/include/66/state.h
-src/lib66/state/state_write.o src/lib66/state/state_write.lo: src/lib66/state/state_write.c src/include/66/constants.h src/include/66/service.h src/include/66/state.h
+src/lib66/state/state_write.o src/lib66/state/state_write.lo: src/lib66/state/state_write.c src/include/66/constants.h src/include/66/resolve.h src/include/66/service.h src/include/66/state.h
+src/lib66/state/state_write_file.o src/lib66/state/state_write_file.lo: src/lib66/state/state_write_file.c src/include/66/state.h
 src/lib66/state/state_write_remote.o src/lib66/state/state_write_remote.lo: src/lib66/state/state_write_remote.c src/include/66/constants.h src/include/66/state.h
+src/lib66/svc/svc_classic_event.o src/lib66/svc/svc_classic_event.lo: src/lib66/svc/svc_classic_event.c src/include/66/service.h src/include/66/svc.h
 src/lib66/svc/svc_compute_ns.o src/lib66/svc/svc_compute_ns.lo: src/lib66/svc/svc_compute_ns.c src/include/66/config.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h
 src/lib66/svc/svc_init_array.o src/lib66/svc/svc_init_array.lo: src/lib66/svc/svc_init_array.c src/include/66/enum.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h
-src/lib66/svc/svc_launch.o src/lib66/svc/svc_launch.lo: src/lib66/svc/svc_launch.c src/include/66/constants.h src/include/66/enum.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h
+src/lib66/svc/svc_launch.o src/lib66/svc/svc_launch.lo: src/lib66/svc/svc_launch.c src/include/66/constants.h src/include/66/enum.h src/include/66/service.h src/include/66/ssexec.h src/include/66/state.h src/include/66/svc.h src/include/66/trace.h
+src/lib66/svc/svc_oneshot.o src/lib66/svc/svc_oneshot.lo: src/lib66/svc/svc_oneshot.c src/include/66/service.h src/include/66/svc.h
 src/lib66/svc/svc_scandir_ok.o src/lib66/svc/svc_scandir_ok.lo: src/lib66/svc/svc_scandir_ok.c src/include/66/svc.h
 src/lib66/svc/svc_scandir_send.o src/lib66/svc/svc_scandir_send.lo: src/lib66/svc/svc_scandir_send.c src/include/66/svc.h
+src/lib66/svc/svc_send_classic.o src/lib66/svc/svc_send_classic.lo: src/lib66/svc/svc_send_classic.c src/include/66/service.h src/include/66/svc.h
 src/lib66/svc/svc_send_fdholder.o src/lib66/svc/svc_send_fdholder.lo: src/lib66/svc/svc_send_fdholder.c src/include/66/svc.h
+src/lib66/svc/svc_send_oneshot.o src/lib66/svc/svc_send_oneshot.lo: src/lib66/svc/svc_send_oneshot.c src/include/66/service.h src/include/66/svc.h
 src/lib66/svc/svc_send_wait.o src/lib66/svc/svc_send_wait.lo: src/lib66/svc/svc_send_wait.c src/include/66/resolve.h src/include/66/ssexec.h src/include/66/svc.h
 src/lib66/svc/svc_unsupervise.o src/lib66/svc/svc_unsupervise.lo: src/lib66/svc/svc_unsupervise.c src/include/66/constants.h src/include/66/enum.h src/include/66/graph.h src/include/66/sanitize.h src/include/66/state.h src/include/66/svc.h src/include/66/symlink.h
 src/lib66/symlink/symlink_make.o src/lib66/symlink/symlink_make.lo: src/lib66/symlink/symlink_make.c src/include/66/constants.h src/include/66/service.h
 src/lib66/symlink/symlink_switch.o src/lib66/symlink/symlink_switch.lo: src/lib66/symlink/symlink_switch.c src/include/66/constants.h src/include/66/resolve.h src/include/66/sanitize.h
+src/lib66/trace/trace_pack.o src/lib66/trace/trace_pack.lo: src/lib66/trace/trace_pack.c src/include/66/trace.h
+src/lib66/trace/trace_path.o src/lib66/trace/trace_path.lo: src/lib66/trace/trace_path.c src/include/66/constants.h src/include/66/trace.h
+src/lib66/trace/trace_read.o src/lib66/trace/trace_read.lo: src/lib66/trace/trace_read.c src/include/66/constants.h src/include/66/trace.h
+src/lib66/trace/trace_write.o src/lib66/trace/trace_write.lo: src/lib66/trace/trace_write.c src/include/66/constants.h src/include/66/trace.h
 src/lib66/tree/tree_find_current.o src/lib66/tree/tree_find_current.lo: src/lib66/tree/tree_find_current.c src/include/66/constants.h src/include/66/resolve.h src/include/66/tree.h
 src/lib66/tree/tree_get_permissions.o src/lib66/tree/tree_get_permissions.lo: src/lib66/tree/tree_get_permissions.c src/include/66/constants.h src/include/66/resolve.h src/include/66/tree.h src/include/66/utils.h
 src/lib66/tree/tree_hash.o src/lib66/tree/tree_hash.lo: src/lib66/tree/tree_hash.c src/include/66/hash.h src/include/66/resolve.h src/include/66/tree.h
@@ -265,12 +296,12 @@ src/lib66/write/write_oneshot.o src/lib66/write/write_oneshot.lo: src/lib66/writ
 src/lib66/write/write_service.o src/lib66/write/write_service.lo: src/lib66/write/write_service.c src/include/66/constants.h src/include/66/enum.h src/include/66/parse.h src/include/66/resolve.h src/include/66/sanitize.h src/include/66/service.h src/include/66/write.h
 src/lib66/write/write_uint.o src/lib66/write/write_uint.lo: src/lib66/write/write_uint.c
 ifeq ($(strip $(STATIC_LIBS_ARE_PIC)),)
-lib66.a.xyzzy: src/lib66/enum/enum.o src/lib66/environ/env_append_version.o src/lib66/environ/env_check_version.o src/lib66/environ/env_compute.o src/lib66/environ/env_find_current_version.o src/lib66/environ/env_get_destination.o src/lib66/environ/env_import_version_file.o src/lib66/environ/env_make_symlink.o src/lib66/environ/env_prepare_for_write.o src/lib66/environ/env_resolve_conf.o src/lib66/exec/ssexec_boot.o src/lib66/exec/ssexec_copy.o src/lib66/exec/ssexec_disable.o src/lib66/exec/ssexec_enable.o src/lib66/exec/ssexec_configure.o src/lib66/exec/ssexec_free.o src/lib66/exec/ssexec_help.o src/lib66/exec/ssexec_parse.o src/lib66/exec/ssexec_reconfigure.o src/lib66/exec/ssexec_reload.o src/lib66/exec/ssexec_remove.o src/lib66/exec/ssexec_resolve.o src/lib66/exec/ssexec_restart.o src/lib66/exec/ssexec_scandir_create.o src/lib66/exec/ssexec_scandir_remove.o src/lib66/exec/ssexec_scandir_signal.o src/lib66/exec/ssexec_scandir_wrapper.o src/lib66/exec/ssexec_shutdown_wrapper.o src/lib66/exec/ssexec_signal.o src/lib66/exec/ssexec_snapshot_create.o src/lib66/exec/ssexec_snapshot_list.o src/lib66/exec/ssexec_snapshot_remove.o src/lib66/exec/ssexec_snapshot_restore.o src/lib66/exec/ssexec_snapshot_wrapper.o src/lib66/exec/ssexec_start.o src/lib66/exec/ssexec_state.o src/lib66/exec/ssexec_status.o src/lib66/exec/ssexec_stop.o src/lib66/exec/ssexec_tree_admin.o src/lib66/exec/ssexec_tree_init.o src/lib66/exec/ssexec_tree_resolve.o src/lib66/exec/ssexec_tree_signal.o src/lib66/exec/ssexec_tree_status.o src/lib66/exec/ssexec_tree_wrapper.o src/lib66/graph/graph_build_arguments.o src/lib66/graph/graph_build_system.o src/lib66/graph/graph_build_tree.o src/lib66/graph/graph_compute_dependencies.o src/lib66/graph/graph_compute_visit.o src/lib66/graph/graph_remove_deps.o src/lib66/info/info_display_field_name.o src/lib66/info/info_display_list.o src/lib66/info/info_display_nline.o src/lib66/info/info_field_align.o src/lib66/info/info_getcols_fd.o src/lib66/info/info_graph_display.o src/lib66/info/info_graph_display_service.o src/lib66/info/info_graph_display_tree.o src/lib66/info/info_graph_init.o src/lib66/info/info_length_from_wchar.o src/lib66/info/info_walk.o src/lib66/instance/instance_check.o src/lib66/instance/instance_create.o src/lib66/instance/instance_splitname.o src/lib66/instance/instance_splitname_to_char.o src/lib66/migrate/migrate_0721.o src/lib66/module/get_list.o src/lib66/module/parse_module.o src/lib66/module/parse_module_check_dir.o src/lib66/module/regex_configure.o src/lib66/module/regex_get_file_name.o src/lib66/module/regex_rename.o src/lib66/module/regex_replace.o src/lib66/parse/parse_create_logger.o src/lib66/parse/parse_bracket.o src/lib66/parse/parse_clean_runas.o src/lib66/parse/parse_compute_list.o src/lib66/parse/parse_compute_resolve.o src/lib66/parse/parse_compute_scripts.o src/lib66/parse/parse_contents.o src/lib66/parse/parse_db_migrate.o src/lib66/parse/parse_error.o src/lib66/parse/parse_frontend.o src/lib66/parse/parse_get_section.o src/lib66/parse/parse_get_value_of_key.o src/lib66/parse/parse_interdependences.o src/lib66/parse/parse_key.o src/lib66/parse/parse_list.o src/lib66/parse/parse_mandatory.o src/lib66/parse/parse_rename_interdependences.o src/lib66/parse/parse_section.o src/lib66/parse/parse_service.o src/lib66/parse/parse_store_environ.o src/lib66/parse/parse_store_g.o src/lib66/parse/parse_store_logger.o src/lib66/parse/parse_store_main.o src/lib66/parse/parse_store_regex.o src/lib66/parse/parse_store_start_stop.o src/lib66/parse/parse_value.o src/lib66/resolve/resolve_add_cdb.o src/lib66/resolve/resolve_add_cdb_uint.o src/lib66/resolve/resolve_add_string.o src/lib66/resolve/resolve_check.o src/lib66/resolve/resolve_check_g.o src/lib66/resolve/resolve_free.o src/lib66/resolve/resolve_get_field_tosa.o src/lib66/resolve/resolve_get_field_tosa_g.o src/lib66/resolve/resolve_get_key.o src/lib66/resolve/resolve_get_sa.o src/lib66/resolve/resolve_init.o src/lib66/resolve/resolve_modify_field.o src/lib66/resolve/resolve_modify_field_g.o src/lib66/resolve/resolve_read.o src/lib66/resolve/resolve_open_cdb.o src/lib66/resolve/resolve_read_cdb.o src/lib66/resolve/resolve_read_g.o src/lib66/resolve/resolve_remove.o src/lib66/resolve/resolve_remove_g.o src/lib66/resolve/resolve_set_struct.o src/lib66/resolve/resolve_write.o src/lib66/resolve/resolve_write_cdb.o src/lib66/resolve/resolve_write_g.o src/lib66/sanitize/sanitize_fdholder.o src/lib66/sanitize/sanitize_graph.o src/lib66/sanitize/sanitize_init.o src/lib66/sanitize/sanitize_livestate.o src/lib66/sanitize/sanitize_migrate.o src/lib66/sanitize/sanitize_scandir.o src/lib66/sanitize/sanitize_source.o src/lib66/sanitize/sanitize_system.o src/lib66/sanitize/sanitize_write.o src/lib66/service/service_cmp_basedir.o src/lib66/service/service_db_migrate.o src/lib66/service/service_enable_disable.o src/lib66/service/service_endof_dir.o src/lib66/service/service_frontend_path.o src/lib66/service/service_frontend_src.o src/lib66/service/service_graph_compute.o src/lib66/service/service_graph_collect_list.o src/lib66/service/service_graph_collect.o src/lib66/service/service_graph_g.o src/lib66/service/service_hash.o src/lib66/service/service_is_g.o src/lib66/service/service_resolve_get_field_tosa.o src/lib66/service/service_resolve_modify_field.o src/lib66/service/service_resolve_write.o src/lib66/service/service_resolve_read_cdb.o src/lib66/service/service_resolve_sanitize.o src/lib66/service/service_resolve_write_remote.o src/lib66/service/service_resolve_write_cdb.o src/lib66/service/service_resolve_zero.o src/lib66/service/service_switch_tree.o src/lib66/shutdown/hpr_shutdown.o src/lib66/shutdown/hpr_wall.o src/lib66/shutdown/hpr_wallv.o src/lib66/state/state_check.o src/lib66/state/state_messenger.o src/lib66/state/state_pack.o src/lib66/state/state_read_remote.o src/lib66/state/state_read.o src/lib66/state/state_rmfile.o src/lib66/state/state_set_flag.o src/lib66/state/state_unpack.o src/lib66/state/state_write_remote.o src/lib66/state/state_write.o src/lib66/svc/svc_compute_ns.o src/lib66/svc/svc_init_array.o src/lib66/svc/svc_launch.o src/lib66/svc/svc_scandir_ok.o src/lib66/svc/svc_scandir_send.o src/lib66/svc/svc_send_fdholder.o src/lib66/svc/svc_send_wait.o src/lib66/svc/svc_unsupervise.o src/lib66/symlink/symlink_make.o src/lib66/symlink/symlink_switch.o src/lib66/tree/tree_find_current.o src/lib66/tree/tree_get_permissions.o src/lib66/tree/tree_hash.o src/lib66/tree/tree_iscurrent.o src/lib66/tree/tree_isenabled.o src/lib66/tree/tree_isinitialized.o src/lib66/tree/tree_issupervised.o src/lib66/tree/tree_isvalid.o src/lib66/tree/tree_ongroups.o src/lib66/tree/tree_resolve_get_field_tosa.o src/lib66/tree/tree_resolve_master_create.o src/lib66/tree/tree_resolve_master_get_field_tosa.o src/lib66/tree/tree_resolve_master_modify_field.o src/lib66/tree/tree_resolve_master_read_cdb.o src/lib66/tree/tree_resolve_master_sanitize.o src/lib66/tree/tree_resolve_master_write_cdb.o src/lib66/tree/tree_resolve_modify_field.o src/lib66/tree/tree_resolve_read_cdb.o src/lib66/tree/tree_resolve_sanitize.o src/lib66/tree/tree_resolve_write_cdb.o src/lib66/tree/tree_resolve_zero.o src/lib66/tree/tree_seed_file_isvalid.o src/lib66/tree/tree_seed_free.o src/lib66/tree/tree_seed_get_group_permissions.o src/lib66/tree/tree_seed_get_key.o src/lib66/tree/tree_seed_isvalid.o src/lib66/tree/tree_seed_parse_file.o src/lib66/tree/tree_seed_resolve_path.o src/lib66/tree/tree_seed_setseed.o src/lib66/tree/tree_service_add.o src/lib66/tree/tree_service_remove.o src/lib66/tree/tree_sethome.o src/lib66/tree/tree_switch_current.o src/lib66/utils/get_userhome.o src/lib66/utils/identifier.o src/lib66/utils/name_isvalid.o src/lib66/utils/read_svfile.o src/lib66/utils/set_environment.o src/lib66/utils/set_livedir.o src/lib66/utils/set_livescan.o src/lib66/utils/set_livestate.o src/lib66/utils/set_ownerhome.o src/lib66/utils/set_ownersysdir.o src/lib66/utils/set_treeinfo.o src/lib66/utils/version.o src/lib66/utils/yourgid.o src/lib66/utils/youruid.o src/lib66/write/write_classic.o src/lib66/write/write_common.o src/lib66/write/write_environ.o src/lib66/write/write_execute_scripts.o src/lib66/write/write_logger.o src/lib66/write/write_oneshot.o src/lib66/write/write_service.o src/lib66/write/write_uint.o
+lib66.a.xyzzy: src/lib66/enum/enum.o src/lib66/environ/env_append_version.o src/lib66/environ/env_check_version.o src/lib66/environ/env_compute.o src/lib66/environ/env_find_current_version.o src/lib66/environ/env_get_destination.o src/lib66/environ/env_import_version_file.o src/lib66/environ/env_make_symlink.o src/lib66/environ/env_prepare_for_write.o src/lib66/environ/env_resolve_conf.o src/lib66/exec/ssexec_analyze.o src/lib66/exec/ssexec_boot.o src/lib66/exec/ssexec_copy.o src/lib66/exec/ssexec_disable.o src/lib66/exec/ssexec_enable.o src/lib66/exec/ssexec_configure.o src/lib66/exec/ssexec_free.o src/lib66/exec/ssexec_help.o src/lib66/exec/ssexec_parse.o src/lib66/exec/ssexec_reconfigure.o src/lib66/exec/ssexec_reload.o src/lib66/exec/ssexec_remove.o src/lib66/exec/ssexec_resolve.o src/lib66/exec/ssexec_restart.o src/lib66/exec/ssexec_scandir_create.o src/lib66/exec/ssexec_scandir_remove.o src/lib66/exec/ssexec_scandir_signal.o src/lib66/exec/ssexec_scandir_wrapper.o src/lib66/exec/ssexec_shutdown_wrapper.o src/lib66/exec/ssexec_signal.o src/lib66/exec/ssexec_snapshot_create.o src/lib66/exec/ssexec_snapshot_list.o src/lib66/exec/ssexec_snapshot_remove.o src/lib66/exec/ssexec_snapshot_restore.o src/lib66/exec/ssexec_snapshot_wrapper.o src/lib66/exec/ssexec_start.o src/lib66/exec/ssexec_state.o src/lib66/exec/ssexec_status.o src/lib66/exec/ssexec_stop.o src/lib66/exec/ssexec_tree_admin.o src/lib66/exec/ssexec_tree_init.o src/lib66/exec/ssexec_tree_resolve.o src/lib66/exec/ssexec_tree_signal.o src/lib66/exec/ssexec_tree_status.o src/lib66/exec/ssexec_tree_wrapper.o src/lib66/graph/graph_build_arguments.o src/lib66/graph/graph_build_system.o src/lib66/graph/graph_build_tree.o src/lib66/graph/graph_compute_dependencies.o src/lib66/graph/graph_compute_visit.o src/lib66/graph/graph_csr.o src/lib66/graph/graph_csr_cycle.o src/lib66/graph/graph_remove_deps.o src/lib66/info/info_display_field_name.o src/lib66/info/info_display_list.o src/lib66/info/info_display_nline.o src/lib66/info/info_field_align.o src/lib66/info/info_getcols_fd.o src/lib66/info/info_graph_display.o src/lib66/info/info_graph_display_service.o src/lib66/info/info_graph_display_tree.o src/lib66/info/info_graph_init.o src/lib66/info/info_length_from_wchar.o src/lib66/info/info_walk.o src/lib66/info/info_watch.o src/lib66/instance/instance_check.o src/lib66/instance/instance_create.o src/lib66/instance/instance_splitname.o src/lib66/instance/instance_splitname_to_char.o src/lib66/migrate/migrate_0721.o src/lib66/migrate/migrate_record.o src/lib66/module/get_list.o src/lib66/module/parse_module.o src/lib66/module/parse_module_check_dir.o src/lib66/module/regex_configure.o src/lib66/module/regex_get_file_name.o src/lib66/module/regex_rename.o src/lib66/module/regex_replace.o src/lib66/parse/parse_create_logger.o src/lib66/parse/parse_bracket.o src/lib66/parse/parse_clean_runas.o src/lib66/parse/parse_compute_list.o src/lib66/parse/parse_compute_resolve.o src/lib66/parse/parse_compute_scripts.o src/lib66/parse/parse_contents.o src/lib66/parse/parse_db_migrate.o src/lib66/parse/parse_error.o src/lib66/parse/parse_frontend.o src/lib66/parse/parse_get_section.o src/lib66/parse/parse_get_value_of_key.o src/lib66/parse/parse_interdependences.o src/lib66/parse/parse_key.o src/lib66/parse/parse_list.o src/lib66/parse/parse_mandatory.o src/lib66/parse/parse_rename_interdependences.o src/lib66/parse/parse_section.o src/lib66/parse/parse_service.o src/lib66/parse/parse_store_environ.o src/lib66/parse/parse_store_g.o src/lib66/parse/parse_store_logger.o src/lib66/parse/parse_store_main.o src/lib66/parse/parse_store_regex.o src/lib66/parse/parse_store_start_stop.o src/lib66/parse/parse_value.o src/lib66/resolve/resolve_add_cdb.o src/lib66/resolve/resolve_add_cdb_uint.o src/lib66/resolve/resolve_add_string.o src/lib66/resolve/resolve_cache.o src/lib66/resolve/resolve_check.o src/lib66/resolve/resolve_check_g.o src/lib66/resolve/resolve_db_invalidate.o src/lib66/resolve/resolve_db_read.o src/lib66/resolve/resolve_db_sync.o src/lib66/resolve/resolve_free.o src/lib66/resolve/resolve_get_field_tosa.o src/lib66/resolve/resolve_get_field_tosa_g.o src/lib66/resolve/resolve_get_key.o src/lib66/resolve/resolve_get_sa.o src/lib66/resolve/resolve_init.o src/lib66/resolve/resolve_modify_field.o src/lib66/resolve/resolve_modify_field_g.o src/lib66/resolve/resolve_read.o src/lib66/resolve/resolve_open_cdb.o src/lib66/resolve/resolve_read_cdb.o src/lib66/resolve/resolve_read_g.o src/lib66/resolve/resolve_read_map.o src/lib66/resolve/resolve_remove.o src/lib66/resolve/resolve_remove_g.o src/lib66/resolve/resolve_set_struct.o src/lib66/resolve/resolve_txn.o src/lib66/resolve/resolve_view_free.o src/lib66/resolve/resolve_write.o src/lib66/resolve/resolve_write_cdb.o src/lib66/resolve/resolve_write_g.o src/lib66/sanitize/sanitize_fdholder.o src/lib66/sanitize/sanitize_graph.o src/lib66/sanitize/sanitize_init.o src/lib66/sanitize/sanitize_livestate.o src/lib66/sanitize/sanitize_migrate.o src/lib66/sanitize/sanitize_scandir.o src/lib66/sanitize/sanitize_source.o src/lib66/sanitize/sanitize_system.o src/lib66/sanitize/sanitize_write.o src/lib66/service/service_cmp_basedir.o src/lib66/service/service_db_migrate.o src/lib66/service/service_enable_disable.o src/lib66/service/service_endof_dir.o src/lib66/service/service_frontend_path.o src/lib66/service/service_frontend_src.o src/lib66/service/service_graph_compute.o src/lib66/service/service_graph_collect_list.o src/lib66/service/service_graph_collect.o src/lib66/service/service_graph_g.o src/lib66/service/service_hash.o src/lib66/service/service_is_g.o src/lib66/service/service_resolve_get_field_tosa.o src/lib66/service/service_resolve_modify_field.o src/lib66/service/service_resolve_write.o src/lib66/service/service_resolve_read_cdb.o src/lib66/service/service_resolve_read_record.o src/lib66/service/service_resolve_sanitize.o src/lib66/service/service_resolve_view_g.o src/lib66/service/service_resolve_view_record.o src/lib66/service/service_resolve_write_remote.o src/lib66/service/service_resolve_write_cdb.o src/lib66/service/service_resolve_write_record.o src/lib66/service/service_resolve_zero.o src/lib66/service/service_switch_tree.o src/lib66/shutdown/hpr_shutdown.o src/lib66/shutdown/hpr_wall.o src/lib66/shutdown/hpr_wallv.o src/lib66/state/state_check.o src/lib66/state/state_latency.o src/lib66/state/state_messenger.o src/lib66/state/state_notify.o src/lib66/state/state_pack.o src/lib66/state/state_read_remote.o src/lib66/state/state_read.o src/lib66/state/state_read_array.o src/lib66/state/state_rmfile.o src/lib66/state/state_set_flag.o src/lib66/state/state_table.o src/lib66/state/state_unpack.o src/lib66/state/state_write_remote.o src/lib66/state/state_write.o src/lib66/state/state_write_file.o src/lib66/svc/svc_classic_event.o src/lib66/svc/svc_compute_ns.o src/lib66/svc/svc_init_array.o src/lib66/svc/svc_launch.o src/lib66/svc/svc_oneshot.o src/lib66/svc/svc_scandir_ok.o src/lib66/svc/svc_scandir_send.o src/lib66/svc/svc_send_classic.o src/lib66/svc/svc_send_fdholder.o src/lib66/svc/svc_send_oneshot.o src/lib66/svc/svc_send_wait.o src/lib66/svc/svc_unsupervise.o src/lib66/symlink/symlink_make.o src/lib66/symlink/symlink_switch.o src/lib66/trace/trace_pack.o src/lib66/trace/trace_path.o src/lib66/trace/trace_read.o src/lib66/trace/trace_write.o src/lib66/tree/tree_find_current.o src/lib66/tree/tree_get_permissions.o src/lib66/tree/tree_hash.o src/lib66/tree/tree_iscurrent.o src/lib66/tree/tree_isenabled.o src/lib66/tree/tree_isinitialized.o src/lib66/tree/tree_issupervised.o src/lib66/tree/tree_isvalid.o src/lib66/tree/tree_ongroups.o src/lib66/tree/tree_resolve_get_field_tosa.o src/lib66/tree/tree_resolve_master_create.o src/lib66/tree/tree_resolve_master_get_field_tosa.o src/lib66/tree/tree_resolve_master_modify_field.o src/lib66/tree/tree_resolve_master_read_cdb.o src/lib66/tree/tree_resolve_master_sanitize.o src/lib66/tree/tree_resolve_master_write_cdb.o src/lib66/tree/tree_resolve_modify_field.o src/lib66/tree/tree_resolve_read_cdb.o src/lib66/tree/tree_resolve_sanitize.o src/lib66/tree/tree_resolve_write_cdb.o src/lib66/tree/tree_resolve_zero.o src/lib66/tree/tree_seed_file_isvalid.o src/lib66/tree/tree_seed_free.o src/lib66/tree/tree_seed_get_group_permissions.o src/lib66/tree/tree_seed_get_key.o src/lib66/tree/tree_seed_isvalid.o src/lib66/tree/tree_seed_parse_file.o src/lib66/tree/tree_seed_resolve_path.o src/lib66/tree/tree_seed_setseed.o src/lib66/tree/tree_service_add.o src/lib66/tree/tree_service_remove.o src/lib66/tree/tree_sethome.o src/lib66/tree/tree_switch_current.o src/lib66/utils/get_userhome.o src/lib66/utils/identifier.o src/lib66/utils/name_isvalid.o src/lib66/utils/read_svfile.o src/lib66/utils/set_environment.o src/lib66/utils/set_livedir.o src/lib66/utils/set_livescan.o src/lib66/utils/set_livestate.o src/lib66/utils/set_ownerhome.o src/lib66/utils/set_ownersysdir.o src/lib66/utils/set_treeinfo.o src/lib66/utils/version.o src/lib66/utils/yourgid.o src/lib66/utils/youruid.o src/lib66/write/write_classic.o src/lib66/write/write_common.o src/lib66/write/write_environ.o src/lib66/write/write_execute_scripts.o src/lib66/write/write_logger.o src/lib66/write/write_oneshot.o src/lib66/write/write_service.o src/lib66/write/write_uint.o
 else
-lib66.a.xyzzy: src/lib66/enum/enum.lo src/lib66/environ/env_append_version.lo src/lib66/environ/env_check_version.lo src/lib66/environ/env_compute.lo src/lib66/environ/env_find_current_version.lo src/lib66/environ/env_get_destination.lo src/lib66/environ/env_import_version_file.lo src/lib66/environ/env_make_symlink.lo src/lib66/environ/env_prepare_for_write.lo src/lib66/environ/env_resolve_conf.lo src/lib66/exec/ssexec_boot.lo src/lib66/exec/ssexec_copy.lo src/lib66/exec/ssexec_disable.lo src/lib66/exec/ssexec_enable.lo src/lib66/exec/ssexec_configure.lo src/lib66/exec/ssexec_free.lo src/lib66/exec/ssexec_help.lo src/lib66/exec/ssexec_parse.lo src/lib66/exec/ssexec_reconfigure.lo src/lib66/exec/ssexec_reload.lo src/lib66/exec/ssexec_remove.lo src/lib66/exec/ssexec_resolve.lo src/lib66/exec/ssexec_restart.lo src/lib66/exec/ssexec_scandir_create.lo src/lib66/exec/ssexec_scandir_remove.lo src/lib66/exec/ssexec_scandir_signal.lo src/lib66/exec/ssexec_scandir_wrapper.lo src/lib66/exec/ssexec_shutdown_wrapper.lo src/lib66/exec/ssexec_signal.lo src/lib66/exec/ssexec_snapshot_create.lo src/lib66/exec/ssexec_snapshot_list.lo src/lib66/exec/ssexec_snapshot_remove.lo src/lib66/exec/ssexec_snapshot_restore.lo src/lib66/exec/ssexec_snapshot_wrapper.lo src/lib66/exec/ssexec_start.lo src/lib66/exec/ssexec_state.lo src/lib66/exec/ssexec_status.lo src/lib66/exec/ssexec_stop.lo src/lib66/exec/ssexec_tree_admin.lo src/lib66/exec/ssexec_tree_init.lo src/lib66/exec/ssexec_tree_resolve.lo src/lib66/exec/ssexec_tree_signal.lo src/lib66/exec/ssexec_tree_status.lo src/lib66/exec/ssexec_tree_wrapper.lo src/lib66/graph/graph_build_arguments.lo src/lib66/graph/graph_build_system.lo src/lib66/graph/graph_build_tree.lo src/lib66/graph/graph_compute_dependencies.lo src/lib66/graph/graph_compute_visit.lo src/lib66/graph/graph_remove_deps.lo src/lib66/info/info_display_field_name.lo src/lib66/info/info_display_list.lo src/lib66/info/info_display_nline.lo src/lib66/info/info_field_align.lo src/lib66/info/info_getcols_fd.lo src/lib66/info/info_graph_display.lo src/lib66/info/info_graph_display_service.lo src/lib66/info/info_graph_display_tree.lo src/lib66/info/info_graph_init.lo src/lib66/info/info_length_from_wchar.lo src/lib66/info/info_walk.lo src/lib66/instance/instance_check.lo src/lib66/instance/instance_create.lo src/lib66/instance/instance_splitname.lo src/lib66/instance/instance_splitname_to_char.lo src/lib66/migrate/migrate_0721.lo src/lib66/module/get_list.lo src/lib66/module/parse_module.lo src/lib66/module/parse_module_check_dir.lo src/lib66/module/regex_configure.lo src/lib66/module/regex_get_file_name.lo src/lib66/module/regex_rename.lo src/lib66/module/regex_replace.lo src/lib66/parse/parse_create_logger.lo src/lib66/parse/parse_bracket.lo src/lib66/parse/parse_clean_runas.lo src/lib66/parse/parse_compute_list.lo src/lib66/parse/parse_compute_resolve.lo src/lib66/parse/parse_compute_scripts.lo src/lib66/parse/parse_contents.lo src/lib66/parse/parse_db_migrate.lo src/lib66/parse/parse_error.lo src/lib66/parse/parse_frontend.lo src/lib66/parse/parse_get_section.lo src/lib66/parse/parse_get_value_of_key.lo src/lib66/parse/parse_interdependences.lo src/lib66/parse/parse_key.lo src/lib66/parse/parse_list.lo src/lib66/parse/parse_mandatory.lo src/lib66/parse/parse_rename_interdependences.lo src/lib66/parse/parse_section.lo src/lib66/parse/parse_service.lo src/lib66/parse/parse_store_environ.lo src/lib66/parse/parse_store_g.lo src/lib66/parse/parse_store_logger.lo src/lib66/parse/parse_store_main.lo src/lib66/parse/parse_store_regex.lo src/lib66/parse/parse_store_start_stop.lo src/lib66/parse/parse_value.lo src/lib66/resolve/resolve_add_cdb.lo src/lib66/resolve/resolve_add_cdb_uint.lo src/lib66/resolve/resolve_add_string.lo src/lib66/resolve/resolve_check.lo src/lib66/resolve/resolve_check_g.lo src/lib66/resolve/resolve_free.lo src/lib66/resolve/resolve_get_field_tosa.lo src/lib66/resolve/resolve_get_field_tosa_g.lo src/lib66/resolve/resolve_get_key.lo src/lib66/resolve/resolve_get_sa.lo src/lib66/resolve/resolve_init.lo src/lib66/resolve/resolve_modify_field.lo src/lib66/resolve/resolve_modify_field_g.lo src/lib66/resolve/resolve_read.lo src/lib66/resolve/resolve_open_cdb.lo src/lib66/resolve/resolve_read_cdb.lo src/lib66/resolve/resolve_read_g.lo src/lib66/resolve/resolve_remove.lo src/lib66/resolve/resolve_remove_g.lo src/lib66/resolve/resolve_set_struct.lo src/lib66/resolve/resolve_write.lo src/lib66/resolve/resolve_write_cdb.lo src/lib66/resolve/resolve_write_g.lo src/lib66/sanitize/sanitize_fdholder.lo src/lib66/sanitize/sanitize_graph.lo src/lib66/sanitize/sanitize_init.lo src/lib66/sanitize/sanitize_livestate.lo src/lib66/sanitize/sanitize_migrate.lo src/lib66/sanitize/sanitize_scandir.lo src/lib66/sanitize/sanitize_source.lo src/lib66/sanitize/sanitize_system.lo src/lib66/sanitize/sanitize_write.lo src/lib66/service/service_cmp_basedir.lo src/lib66/service/service_db_migrate.lo src/lib66/service/service_enable_disable.lo src/lib66/service/service_endof_dir.lo src/lib66/service/service_frontend_path.lo src/lib66/service/service_frontend_src.lo src/lib66/service/service_graph_compute.lo src/lib66/service/service_graph_collect_list.lo src/lib66/service/service_graph_collect.lo src/lib66/service/service_graph_g.lo src/lib66/service/service_hash.lo src/lib66/service/service_is_g.lo src/lib66/service/service_resolve_get_field_tosa.lo src/lib66/service/service_resolve_modify_field.lo src/lib66/service/service_resolve_write.lo src/lib66/service/service_resolve_read_cdb.lo src/lib66/service/service_resolve_sanitize.lo src/lib66/service/service_resolve_write_remote.lo src/lib66/service/service_resolve_write_cdb.lo src/lib66/service/service_resolve_zero.lo src/lib66/service/service_switch_tree.lo src/lib66/shutdown/hpr_shutdown.lo src/lib66/shutdown/hpr_wall.lo src/lib66/shutdown/hpr_wallv.lo src/lib66/state/state_check.lo src/lib66/state/state_messenger.lo src/lib66/state/state_pack.lo src/lib66/state/state_read_remote.lo src/lib66/state/state_read.lo src/lib66/state/state_rmfile.lo src/lib66/state/state_set_flag.lo src/lib66/state/state_unpack.lo src/lib66/state/state_write_remote.lo src/lib66/state/state_write.lo src/lib66/svc/svc_compute_ns.lo src/lib66/svc/svc_init_array.lo src/lib66/svc/svc_launch.lo src/lib66/svc/svc_scandir_ok.lo src/lib66/svc/svc_scandir_send.lo src/lib66/svc/svc_send_fdholder.lo src/lib66/svc/svc_send_wait.lo src/lib66/svc/svc_unsupervise.lo src/lib66/symlink/symlink_make.lo src/lib66/symlink/symlink_switch.lo src/lib66/tree/tree_find_current.lo src/lib66/tree/tree_get_permissions.lo src/lib66/tree/tree_hash.lo src/lib66/tree/tree_iscurrent.lo src/lib66/tree/tree_isenabled.lo src/lib66/tree/tree_isinitialized.lo src/lib66/tree/tree_issupervised.lo src/lib66/tree/tree_isvalid.lo src/lib66/tree/tree_ongroups.lo src/lib66/tree/tree_resolve_get_field_tosa.lo src/lib66/tree/tree_resolve_master_create.lo src/lib66/tree/tree_resolve_master_get_field_tosa.lo src/lib66/tree/tree_resolve_master_modify_field.lo src/lib66/tree/tree_resolve_master_read_cdb.lo src/lib66/tree/tree_resolve_master_sanitize.lo src/lib66/tree/tree_resolve_master_write_cdb.lo src/lib66/tree/tree_resolve_modify_field.lo src/lib66/tree/tree_resolve_read_cdb.lo src/lib66/tree/tree_resolve_sanitize.lo src/lib66/tree/tree_resolve_write_cdb.lo src/lib66/tree/tree_resolve_zero.lo src/lib66/tree/tree_seed_file_isvalid.lo src/lib66/tree/tree_seed_free.lo src/lib66/tree/tree_seed_get_group_permissions.lo src/lib66/tree/tree_seed_get_key.lo src/lib66/tree/tree_seed_isvalid.lo src/lib66/tree/tree_seed_parse_file.lo src/lib66/tree/tree_seed_resolve_path.lo src/lib66/tree/tree_seed_setseed.lo src/lib66/tree/tree_service_add.lo src/lib66/tree/tree_service_remove.lo src/lib66/tree/tree_sethome.lo src/lib66/tree/tree_switch_current.lo src/lib66/utils/get_userhome.lo src/lib66/utils/identifier.lo src/lib66/utils/name_isvalid.lo src/lib66/utils/read_svfile.lo src/lib66/utils/set_environment.lo src/lib66/utils/set_livedir.lo src/lib66/utils/set_livescan.lo src/lib66/utils/set_livestate.lo src/lib66/utils/set_ownerhome.lo src/lib66/utils/set_ownersysdir.lo src/lib66/utils/set_treeinfo.lo src/lib66/utils/version.lo src/lib66/utils/yourgid.lo src/lib66/utils/youruid.lo src/lib66/write/write_classic.lo src/lib66/write/write_common.lo src/lib66/write/write_environ.lo src/lib66/write/write_execute_scripts.lo src/lib66/write/write_logger.lo src/lib66/write/write_oneshot.lo src/lib66/write/write_service.lo src/lib66/write/write_uint.lo
+lib66.a.xyzzy: src/lib66/enum/enum.lo src/lib66/environ/env_append_version.lo src/lib66/environ/env_check_version.lo src/lib66/environ/env_compute.lo src/lib66/environ/env_find_current_version.lo src/lib66/environ/env_get_destination.lo src/lib66/environ/env_import_version_file.lo src/lib66/environ/env_make_symlink.lo src/lib66/environ/env_prepare_for_write.lo src/lib66/environ/env_resolve_conf.lo src/lib66/exec/ssexec_analyze.lo src/lib66/exec/ssexec_boot.lo src/lib66/exec/ssexec_copy.lo src/lib66/exec/ssexec_disable.lo src/lib66/exec/ssexec_enable.lo src/lib66/exec/ssexec_configure.lo src/lib66/exec/ssexec_free.lo src/lib66/exec/ssexec_help.lo src/lib66/exec/ssexec_parse.lo src/lib66/exec/ssexec_reconfigure.lo src/lib66/exec/ssexec_reload.lo src/lib66/exec/ssexec_remove.lo src/lib66/exec/ssexec_resolve.lo src/lib66/exec/ssexec_restart.lo src/lib66/exec/ssexec_scandir_create.lo src/lib66/exec/ssexec_scandir_remove.lo src/lib66/exec/ssexec_scandir_signal.lo src/lib66/exec/ssexec_scandir_wrapper.lo src/lib66/exec/ssexec_shutdown_wrapper.lo src/lib66/exec/ssexec_signal.lo src/lib66/exec/ssexec_snapshot_create.lo src/lib66/exec/ssexec_snapshot_list.lo src/lib66/exec/ssexec_snapshot_remove.lo src/lib66/exec/ssexec_snapshot_restore.lo src/lib66/exec/ssexec_snapshot_wrapper.lo src/lib66/exec/ssexec_start.lo src/lib66/exec/ssexec_state.lo src/lib66/exec/ssexec_status.lo src/lib66/exec/ssexec_stop.lo src/lib66/exec/ssexec_tree_admin.lo src/lib66/exec/ssexec_tree_init.lo src/lib66/exec/ssexec_tree_resolve.lo src/lib66/exec/ssexec_tree_signal.lo src/lib66/exec/ssexec_tree_status.lo src/lib66/exec/ssexec_tree_wrapper.lo src/lib66/graph/graph_build_arguments.lo src/lib66/graph/graph_build_system.lo src/lib66/graph/graph_build_tree.lo src/lib66/graph/graph_compute_dependencies.lo src/lib66/graph/graph_compute_visit.lo src/lib66/graph/graph_csr.lo src/lib66/graph/graph_csr_cycle.lo src/lib66/graph/graph_remove_deps.lo src/lib66/info/info_display_field_name.lo src/lib66/info/info_display_list.lo src/lib66/info/info_display_nline.lo src/lib66/info/info_field_align.lo src/lib66/info/info_getcols_fd.lo src/lib66/info/info_graph_display.lo src/lib66/info/info_graph_display_service.lo src/lib66/info/info_graph_display_tree.lo src/lib66/info/info_graph_init.lo src/lib66/info/info_length_from_wchar.lo src/lib66/info/info_walk.lo src/lib66/info/info_watch.lo src/lib66/instance/instance_check.lo src/lib66/instance/instance_create.lo src/lib66/instance/instance_splitname.lo src/lib66/instance/instance_splitname_to_char.lo src/lib66/migrate/migrate_0721.lo src/lib66/migrate/migrate_record.lo src/lib66/module/get_list.lo src/lib66/module/parse_module.lo src/lib66/module/parse_module_check_dir.lo src/lib66/module/regex_configure.lo src/lib66/module/regex_get_file_name.lo src/lib66/module/regex_rename.lo src/lib66/module/regex_replace.lo src/lib66/parse/parse_create_logger.lo src/lib66/parse/parse_bracket.lo src/lib66/parse/parse_clean_runas.lo src/lib66/parse/parse_compute_list.lo src/lib66/parse/parse_compute_resolve.lo src/lib66/parse/parse_compute_scripts.lo src/lib66/parse/parse_contents.lo src/lib66/parse/parse_db_migrate.lo src/lib66/parse/parse_error.lo src/lib66/parse/parse_frontend.lo src/lib66/parse/parse_get_section.lo src/lib66/parse/parse_get_value_of_key.lo src/lib66/parse/parse_interdependences.lo src/lib66/parse/parse_key.lo src/lib66/parse/parse_list.lo src/lib66/parse/parse_mandatory.lo src/lib66/parse/parse_rename_interdependences.lo src/lib66/parse/parse_section.lo src/lib66/parse/parse_service.lo src/lib66/parse/parse_store_environ.lo src/lib66/parse/parse_store_g.lo src/lib66/parse/parse_store_logger.lo src/lib66/parse/parse_store_main.lo src/lib66/parse/parse_store_regex.lo src/lib66/parse/parse_store_start_stop.lo src/lib66/parse/parse_value.lo src/lib66/resolve/resolve_add_cdb.lo src/lib66/resolve/resolve_add_cdb_uint.lo src/lib66/resolve/resolve_add_string.lo src/lib66/resolve/resolve_cache.lo src/lib66/resolve/resolve_check.lo src/lib66/resolve/resolve_check_g.lo src/lib66/resolve/resolve_db_invalidate.lo src/lib66/resolve/resolve_db_read.lo src/lib66/resolve/resolve_db_sync.lo src/lib66/resolve/resolve_free.lo src/lib66/resolve/resolve_get_field_tosa.lo src/lib66/resolve/resolve_get_field_tosa_g.lo src/lib66/resolve/resolve_get_key.lo src/lib66/resolve/resolve_get_sa.lo src/lib66/resolve/resolve_init.lo src/lib66/resolve/resolve_modify_field.lo src/lib66/resolve/resolve_modify_field_g.lo src/lib66/resolve/resolve_read.lo src/lib66/resolve/resolve_open_cdb.lo src/lib66/resolve/resolve_read_cdb.lo src/lib66/resolve/resolve_read_g.lo src/lib66/resolve/resolve_read_map.lo src/lib66/resolve/resolve_remove.lo src/lib66/resolve/resolve_remove_g.lo src/lib66/resolve/resolve_set_struct.lo src/lib66/resolve/resolve_txn.lo src/lib66/resolve/resolve_view_free.lo src/lib66/resolve/resolve_write.lo src/lib66/resolve/resolve_write_cdb.lo src/lib66/resolve/resolve_write_g.lo src/lib66/sanitize/sanitize_fdholder.lo src/lib66/sanitize/sanitize_graph.lo src/lib66/sanitize/sanitize_init.lo src/lib66/sanitize/sanitize_livestate.lo src/lib66/sanitize/sanitize_migrate.lo src/lib66/sanitize/sanitize_scandir.lo src/lib66/sanitize/sanitize_source.lo src/lib66/sanitize/sanitize_system.lo src/lib66/sanitize/sanitize_write.lo src/lib66/service/service_cmp_basedir.lo src/lib66/service/service_db_migrate.lo src/lib66/service/service_enable_disable.lo src/lib66/service/service_endof_dir.lo src/lib66/service/service_frontend_path.lo src/lib66/service/service_frontend_src.lo src/lib66/service/service_graph_compute.lo src/lib66/service/service_graph_collect_list.lo src/lib66/service/service_graph_collect.lo src/lib66/service/service_graph_g.lo src/lib66/service/service_hash.lo src/lib66/service/service_is_g.lo src/lib66/service/service_resolve_get_field_tosa.lo src/lib66/service/service_resolve_modify_field.lo src/lib66/service/service_resolve_write.lo src/lib66/service/service_resolve_read_cdb.lo src/lib66/service/service_resolve_read_record.lo src/lib66/service/service_resolve_sanitize.lo src/lib66/service/service_resolve_view_g.lo src/lib66/service/service_resolve_view_record.lo src/lib66/service/service_resolve_write_remote.lo src/lib66/service/service_resolve_write_cdb.lo src/lib66/service/service_resolve_write_record.lo src/lib66/service/service_resolve_zero.lo src/lib66/service/service_switch_tree.lo src/lib66/shutdown/hpr_shutdown.lo src/lib66/shutdown/hpr_wall.lo src/lib66/shutdown/hpr_wallv.lo src/lib66/state/state_check.lo src/lib66/state/state_latency.lo src/lib66/state/state_messenger.lo src/lib66/state/state_notify.lo src/lib66/state/state_pack.lo src/lib66/state/state_read_remote.lo src/lib66/state/state_read.lo src/lib66/state/state_read_array.lo src/lib66/state/state_rmfile.lo src/lib66/state/state_set_flag.lo src/lib66/state/state_table.lo src/lib66/state/state_unpack.lo src/lib66/state/state_write_remote.lo src/lib66/state/state_write.lo src/lib66/state/state_write_file.lo src/lib66/svc/svc_classic_event.lo src/lib66/svc/svc_compute_ns.lo src/lib66/svc/svc_init_array.lo src/lib66/svc/svc_launch.lo src/lib66/svc/svc_oneshot.lo src/lib66/svc/svc_scandir_ok.lo src/lib66/svc/svc_scandir_send.lo src/lib66/svc/svc_send_classic.lo src/lib66/svc/svc_send_fdholder.lo src/lib66/svc/svc_send_oneshot.lo src/lib66/svc/svc_send_wait.lo src/lib66/svc/svc_unsupervise.lo src/lib66/symlink/symlink_make.lo src/lib66/symlink/symlink_switch.lo src/lib66/trace/trace_pack.lo src/lib66/trace/trace_path.lo src/lib66/trace/trace_read.lo src/lib66/trace/trace_write.lo src/lib66/tree/tree_find_current.lo src/lib66/tree/tree_get_permissions.lo src/lib66/tree/tree_hash.lo src/lib66/tree/tree_iscurrent.lo src/lib66/tree/tree_isenabled.lo src/lib66/tree/tree_isinitialized.lo src/lib66/tree/tree_issupervised.lo src/lib66/tree/tree_isvalid.lo src/lib66/tree/tree_ongroups.lo src/lib66/tree/tree_resolve_get_field_tosa.lo src/lib66/tree/tree_resolve_master_create.lo src/lib66/tree/tree_resolve_master_get_field_tosa.lo src/lib66/tree/tree_resolve_master_modify_field.lo src/lib66/tree/tree_resolve_master_read_cdb.lo src/lib66/tree/tree_resolve_master_sanitize.lo src/lib66/tree/tree_resolve_master_write_cdb.lo src/lib66/tree/tree_resolve_modify_field.lo src/lib66/tree/tree_resolve_read_cdb.lo src/lib66/tree/tree_resolve_sanitize.lo src/lib66/tree/tree_resolve_write_cdb.lo src/lib66/tree/tree_resolve_zero.lo src/lib66/tree/tree_seed_file_isvalid.lo src/lib66/tree/tree_seed_free.lo src/lib66/tree/tree_seed_get_group_permissions.lo src/lib66/tree/tree_seed_get_key.lo src/lib66/tree/tree_seed_isvalid.lo src/lib66/tree/tree_seed_parse_file.lo src/lib66/tree/tree_seed_resolve_path.lo src/lib66/tree/tree_seed_setseed.lo src/lib66/tree/tree_service_add.lo src/lib66/tree/tree_service_remove.lo src/lib66/tree/tree_sethome.lo src/lib66/tree/tree_switch_current.lo src/lib66/utils/get_userhome.lo src/lib66/utils/identifier.lo src/lib66/utils/name_isvalid.lo src/lib66/utils/read_svfile.lo src/lib66/utils/set_environment.lo src/lib66/utils/set_livedir.lo src/lib66/utils/set_livescan.lo src/lib66/utils/set_livestate.lo src/lib66/utils/set_ownerhome.lo src/lib66/utils/set_ownersysdir.lo src/lib66/utils/set_treeinfo.lo src/lib66/utils/version.lo src/lib66/utils/yourgid.lo src/lib66/utils/youruid.lo src/lib66/write/write_classic.lo src/lib66/write/write_common.lo src/lib66/write/write_environ.lo src/lib66/write/write_execute_scripts.lo src/lib66/write/write_logger.lo src/lib66/write/write_oneshot.lo src/lib66/write/write_service.lo src/lib66/write/write_uint.lo
 endif
 lib66.so.xyzzy: EXTRA_LIBS := -loblibs -lskarnet -ls6 -lexecline
-lib66.so.xyzzy: src/lib66/enum/enum.lo src/lib66/environ/env_append_version.lo src/lib66/environ/env_check_version.lo src/lib66/environ/env_compute.lo src/lib66/environ/env_find_current_version.lo src/lib66/environ/env_get_destination.lo src/lib66/environ/env_import_version_file.lo src/lib66/environ/env_make_symlink.lo src/lib66/environ/env_prepare_for_write.lo src/lib66/environ/env_resolve_conf.lo src/lib66/exec/ssexec_boot.lo src/lib66/exec/ssexec_copy.lo src/lib66/exec/ssexec_disable.lo src/lib66/exec/ssexec_enable.lo src/lib66/exec/ssexec_configure.lo src/lib66/exec/ssexec_free.lo src/lib66/exec/ssexec_help.lo src/lib66/exec/ssexec_parse.lo src/lib66/exec/ssexec_reconfigure.lo src/lib66/exec/ssexec_reload.lo src/lib66/exec/ssexec_remove.lo src/lib66/exec/ssexec_resolve.lo src/lib66/exec/ssexec_restart.lo src/lib66/exec/ssexec_scandir_create.lo src/lib66/exec/ssexec_scandir_remove.lo src/lib66/exec/ssexec_scandir_signal.lo src/lib66/exec/ssexec_scandir_wrapper.lo src/lib66/exec/ssexec_shutdown_wrapper.lo src/lib66/exec/ssexec_signal.lo src/lib66/exec/ssexec_snapshot_create.lo src/lib66/exec/ssexec_snapshot_list.lo src/lib66/exec/ssexec_snapshot_remove.lo src/lib66/exec/ssexec_snapshot_restore.lo src/lib66/exec/ssexec_snapshot_wrapper.lo src/lib66/exec/ssexec_start.lo src/lib66/exec/ssexec_state.lo src/lib66/exec/ssexec_status.lo src/lib66/exec/ssexec_stop.lo src/lib66/exec/ssexec_tree_admin.lo src/lib66/exec/ssexec_tree_init.lo src/lib66/exec/ssexec_tree_resolve.lo src/lib66/exec/ssexec_tree_signal.lo src/lib66/exec/ssexec_tree_status.lo src/lib66/exec/ssexec_tree_wrapper.lo src/lib66/graph/graph_build_arguments.lo src/lib66/graph/graph_build_system.lo src/lib66/graph/graph_build_tree.lo src/lib66/graph/graph_compute_dependencies.lo src/lib66/graph/graph_compute_visit.lo src/lib66/graph/graph_remove_deps.lo src/lib66/info/info_display_field_name.lo src/lib66/info/info_display_list.lo src/lib66/info/info_display_nline.lo src/lib66/info/info_field_align.lo src/lib66/info/info_getcols_fd.lo src/lib66/info/info_graph_display.lo src/lib66/info/info_graph_display_service.lo src/lib66/info/info_graph_display_tree.lo src/lib66/info/info_graph_init.lo src/lib66/info/info_length_from_wchar.lo src/lib66/info/info_walk.lo src/lib66/instance/instance_check.lo src/lib66/instance/instance_create.lo src/lib66/instance/instance_splitname.lo src/lib66/instance/instance_splitname_to_char.lo src/lib66/migrate/migrate_0721.lo src/lib66/module/get_list.lo src/lib66/module/parse_module.lo src/lib66/module/parse_module_check_dir.lo src/lib66/module/regex_configure.lo src/lib66/module/regex_get_file_name.lo src/lib66/module/regex_rename.lo src/lib66/module/regex_replace.lo src/lib66/parse/parse_create_logger.lo src/lib66/parse/parse_bracket.lo src/lib66/parse/parse_clean_runas.lo src/lib66/parse/parse_compute_list.lo src/lib66/parse/parse_compute_resolve.lo src/lib66/parse/parse_compute_scripts.lo src/lib66/parse/parse_contents.lo src/lib66/parse/parse_db_migrate.lo src/lib66/parse/parse_error.lo src/lib66/parse/parse_frontend.lo src/lib66/parse/parse_get_section.lo src/lib66/parse/parse_get_value_of_key.lo src/lib66/parse/parse_interdependences.lo src/lib66/parse/parse_key.lo src/lib66/parse/parse_list.lo src/lib66/parse/parse_mandatory.lo src/lib66/parse/parse_rename_interdependences.lo src/lib66/parse/parse_section.lo src/lib66/parse/parse_service.lo src/lib66/parse/parse_store_environ.lo src/lib66/parse/parse_store_g.lo src/lib66/parse/parse_store_logger.lo src/lib66/parse/parse_store_main.lo src/lib66/parse/parse_store_regex.lo src/lib66/parse/parse_store_start_stop.lo src/lib66/parse/parse_value.lo src/lib66/resolve/resolve_add_cdb.lo src/lib66/resolve/resolve_add_cdb_uint.lo src/lib66/resolve/resolve_add_string.lo src/lib66/resolve/resolve_check.lo src/lib66/resolve/resolve_check_g.lo src/lib66/resolve/resolve_free.lo src/lib66/resolve/resolve_get_field_tosa.lo src/lib66/resolve/resolve_get_field_tosa_g.lo src/lib66/resolve/resolve_get_key.lo src/lib66/resolve/resolve_get_sa.lo src/lib66/resolve/resolve_init.lo src/lib66/resolve/resolve_modify_field.lo src/lib66/resolve/resolve_modify_field_g.lo src/lib66/resolve/resolve_read.lo src/lib66/resolve/resolve_open_cdb.lo src/lib66/resolve/resolve_read_cdb.lo src/lib66/resolve/resolve_read_g.lo src/lib66/resolve/resolve_remove.lo src/lib66/resolve/resolve_remove_g.lo src/lib66/resolve/resolve_set_struct.lo src/lib66/resolve/resolve_write.lo src/lib66/resolve/resolve_write_cdb.lo src/lib66/resolve/resolve_write_g.lo src/lib66/sanitize/sanitize_fdholder.lo src/lib66/sanitize/sanitize_graph.lo src/lib66/sanitize/sanitize_init.lo src/lib66/sanitize/sanitize_livestate.lo src/lib66/sanitize/sanitize_migrate.lo src/lib66/sanitize/sanitize_scandir.lo src/lib66/sanitize/sanitize_source.lo src/lib66/sanitize/sanitize_system.lo src/lib66/sanitize/sanitize_write.lo src/lib66/service/service_cmp_basedir.lo src/lib66/service/service_db_migrate.lo src/lib66/service/service_enable_disable.lo src/lib66/service/service_endof_dir.lo src/lib66/service/service_frontend_path.lo src/lib66/service/service_frontend_src.lo src/lib66/service/service_graph_compute.lo src/lib66/service/service_graph_collect_list.lo src/lib66/service/service_graph_collect.lo src/lib66/service/service_graph_g.lo src/lib66/service/service_hash.lo src/lib66/service/service_is_g.lo src/lib66/service/service_resolve_get_field_tosa.lo src/lib66/service/service_resolve_modify_field.lo src/lib66/service/service_resolve_write.lo src/lib66/service/service_resolve_read_cdb.lo src/lib66/service/service_resolve_sanitize.lo src/lib66/service/service_resolve_write_remote.lo src/lib66/service/service_resolve_write_cdb.lo src/lib66/service/service_resolve_zero.lo src/lib66/service/service_switch_tree.lo src/lib66/shutdown/hpr_shutdown.lo src/lib66/shutdown/hpr_wall.lo src/lib66/shutdown/hpr_wallv.lo src/lib66/state/state_check.lo src/lib66/state/state_messenger.lo src/lib66/state/state_pack.lo src/lib66/state/state_read_remote.lo src/lib66/state/state_read.lo src/lib66/state/state_rmfile.lo src/lib66/state/state_set_flag.lo src/lib66/state/state_unpack.lo src/lib66/state/state_write_remote.lo src/lib66/state/state_write.lo src/lib66/svc/svc_compute_ns.lo src/lib66/svc/svc_init_array.lo src/lib66/svc/svc_launch.lo src/lib66/svc/svc_scandir_ok.lo src/lib66/svc/svc_scandir_send.lo src/lib66/svc/svc_send_fdholder.lo src/lib66/svc/svc_send_wait.lo src/lib66/svc/svc_unsupervise.lo src/lib66/symlink/symlink_make.lo src/lib66/symlink/symlink_switch.lo src/lib66/tree/tree_find_current.lo src/lib66/tree/tree_get_permissions.lo src/lib66/tree/tree_hash.lo src/lib66/tree/tree_iscurrent.lo src/lib66/tree/tree_isenabled.lo src/lib66/tree/tree_isinitialized.lo src/lib66/tree/tree_issupervised.lo src/lib66/tree/tree_isvalid.lo src/lib66/tree/tree_ongroups.lo src/lib66/tree/tree_resolve_get_field_tosa.lo src/lib66/tree/tree_resolve_master_create.lo src/lib66/tree/tree_resolve_master_get_field_tosa.lo src/lib66/tree/tree_resolve_master_modify_field.lo src/lib66/tree/tree_resolve_master_read_cdb.lo src/lib66/tree/tree_resolve_master_sanitize.lo src/lib66/tree/tree_resolve_master_write_cdb.lo src/lib66/tree/tree_resolve_modify_field.lo src/lib66/tree/tree_resolve_read_cdb.lo src/lib66/tree/tree_resolve_sanitize.lo src/lib66/tree/tree_resolve_write_cdb.lo src/lib66/tree/tree_resolve_zero.lo src/lib66/tree/tree_seed_file_isvalid.lo src/lib66/tree/tree_seed_free.lo src/lib66/tree/tree_seed_get_group_permissions.lo src/lib66/tree/tree_seed_get_key.lo src/lib66/tree/tree_seed_isvalid.lo src/lib66/tree/tree_seed_parse_file.lo src/lib66/tree/tree_seed_resolve_path.lo src/lib66/tree/tree_seed_setseed.lo src/lib66/tree/tree_service_add.lo src/lib66/tree/tree_service_remove.lo src/lib66/tree/tree_sethome.lo src/lib66/tree/tree_switch_current.lo src/lib66/utils/get_userhome.lo src/lib66/utils/identifier.lo src/lib66/utils/name_isvalid.lo src/lib66/utils/read_svfile.lo src/lib66/utils/set_environment.lo src/lib66/utils/set_livedir.lo src/lib66/utils/set_livescan.lo src/lib66/utils/set_livestate.lo src/lib66/utils/set_ownerhome.lo src/lib66/utils/set_ownersysdir.lo src/lib66/utils/set_treeinfo.lo src/lib66/utils/version.lo src/lib66/utils/yourgid.lo src/lib66/utils/youruid.lo src/lib66/write/write_classic.lo src/lib66/write/write_common.lo src/lib66/write/write_environ.lo src/lib66/write/write_execute_scripts.lo src/lib66/write/write_logger.lo src/lib66/write/write_oneshot.lo src/lib66/write/write_service.lo src/lib66/write/write_uint.lo
+lib66.so.xyzzy: src/lib66/enum/enum.lo src/lib66/environ/env_append_version.lo src/lib66/environ/env_check_version.lo src/lib66/environ/env_compute.lo src/lib66/environ/env_find_current_version.lo src/lib66/environ/env_get_destination.lo src/lib66/environ/env_import_version_file.lo src/lib66/environ/env_make_symlink.lo src/lib66/environ/env_prepare_for_write.lo src/lib66/environ/env_resolve_conf.lo src/lib66/exec/ssexec_analyze.lo src/lib66/exec/ssexec_boot.lo src/lib66/exec/ssexec_copy.lo src/lib66/exec/ssexec_disable.lo src/lib66/exec/ssexec_enable.lo src/lib66/exec/ssexec_configure.lo src/lib66/exec/ssexec_free.lo src/lib66/exec/ssexec_help.lo src/lib66/exec/ssexec_parse.lo src/lib66/exec/ssexec_reconfigure.lo src/lib66/exec/ssexec_reload.lo src/lib66/exec/ssexec_remove.lo src/lib66/exec/ssexec_resolve.lo src/lib66/exec/ssexec_restart.lo src/lib66/exec/ssexec_scandir_create.lo src/lib66/exec/ssexec_scandir_remove.lo src/lib66/exec/ssexec_scandir_signal.lo src/lib66/exec/ssexec_scandir_wrapper.lo src/lib66/exec/ssexec_shutdown_wrapper.lo src/lib66/exec/ssexec_signal.lo src/lib66/exec/ssexec_snapshot_create.lo src/lib66/exec/ssexec_snapshot_list.lo src/lib66/exec/ssexec_snapshot_remove.lo src/lib66/exec/ssexec_snapshot_restore.lo src/lib66/exec/ssexec_snapshot_wrapper.lo src/lib66/exec/ssexec_start.lo src/lib66/exec/ssexec_state.lo src/lib66/exec/ssexec_status.lo src/lib66/exec/ssexec_stop.lo src/lib66/exec/ssexec_tree_admin.lo src/lib66/exec/ssexec_tree_init.lo src/lib66/exec/ssexec_tree_resolve.lo src/lib66/exec/ssexec_tree_signal.lo src/lib66/exec/ssexec_tree_status.lo src/lib66/exec/ssexec_tree_wrapper.lo src/lib66/graph/graph_build_arguments.lo src/lib66/graph/graph_build_system.lo src/lib66/graph/graph_build_tree.lo src/lib66/graph/graph_compute_dependencies.lo src/lib66/graph/graph_compute_visit.lo src/lib66/graph/graph_csr.lo src/lib66/graph/graph_csr_cycle.lo src/lib66/graph/graph_remove_deps.lo src/lib66/info/info_display_field_name.lo src/lib66/info/info_display_list.lo src/lib66/info/info_display_nline.lo src/lib66/info/info_field_align.lo src/lib66/info/info_getcols_fd.lo src/lib66/info/info_graph_display.lo src/lib66/info/info_graph_display_service.lo src/lib66/info/info_graph_display_tree.lo src/lib66/info/info_graph_init.lo src/lib66/info/info_length_from_wchar.lo src/lib66/info/info_walk.lo src/lib66/info/info_watch.lo src/lib66/instance/instance_check.lo src/lib66/instance/instance_create.lo src/lib66/instance/instance_splitname.lo src/lib66/instance/instance_splitname_to_char.lo src/lib66/migrate/migrate_0721.lo src/lib66/migrate/migrate_record.lo src/lib66/module/get_list.lo src/lib66/module/parse_module.lo src/lib66/module/parse_module_check_dir.lo src/lib66/module/regex_configure.lo src/lib66/module/regex_get_file_name.lo src/lib66/module/regex_rename.lo src/lib66/module/regex_replace.lo src/lib66/parse/parse_create_logger.lo src/lib66/parse/parse_bracket.lo src/lib66/parse/parse_clean_runas.lo src/lib66/parse/parse_compute_list.lo src/lib66/parse/parse_compute_resolve.lo src/lib66/parse/parse_compute_scripts.lo src/lib66/parse/parse_contents.lo src/lib66/parse/parse_db_migrate.lo src/lib66/parse/parse_error.lo src/lib66/parse/parse_frontend.lo src/lib66/parse/parse_get_section.lo src/lib66/parse/parse_get_value_of_key.lo src/lib66/parse/parse_interdependences.lo src/lib66/parse/parse_key.lo src/lib66/parse/parse_list.lo src/lib66/parse/parse_mandatory.lo src/lib66/parse/parse_rename_interdependences.lo src/lib66/parse/parse_section.lo src/lib66/parse/parse_service.lo src/lib66/parse/parse_store_environ.lo src/lib66/parse/parse_store_g.lo src/lib66/parse/parse_store_logger.lo src/lib66/parse/parse_store_main.lo src/lib66/parse/parse_store_regex.lo src/lib66/parse/parse_store_start_stop.lo src/lib66/parse/parse_value.lo src/lib66/resolve/resolve_add_cdb.lo src/lib66/resolve/resolve_add_cdb_uint.lo src/lib66/resolve/resolve_add_string.lo src/lib66/resolve/resolve_cache.lo src/lib66/resolve/resolve_check.lo src/lib66/resolve/resolve_check_g.lo src/lib66/resolve/resolve_db_invalidate.lo src/lib66/resolve/resolve_db_read.lo src/lib66/resolve/resolve_db_sync.lo src/lib66/resolve/resolve_free.lo src/lib66/resolve/resolve_get_field_tosa.lo src/lib66/resolve/resolve_get_field_tosa_g.lo src/lib66/resolve/resolve_get_key.lo src/lib66/resolve/resolve_get_sa.lo src/lib66/resolve/resolve_init.lo src/lib66/resolve/resolve_modify_field.lo src/lib66/resolve/resolve_modify_field_g.lo src/lib66/resolve/resolve_read.lo src/lib66/resolve/resolve_open_cdb.lo src/lib66/resolve/resolve_read_cdb.lo src/lib66/resolve/resolve_read_g.lo src/lib66/resolve/resolve_read_map.lo src/lib66/resolve/resolve_remove.lo src/lib66/resolve/resolve_remove_g.lo src/lib66/resolve/resolve_set_struct.lo src/lib66/resolve/resolve_txn.lo src/lib66/resolve/resolve_view_free.lo src/lib66/resolve/resolve_write.lo src/lib66/resolve/resolve_write_cdb.lo src/lib66/resolve/resolve_write_g.lo src/lib66/sanitize/sanitize_fdholder.lo src/lib66/sanitize/sanitize_graph.lo src/lib66/sanitize/sanitize_init.lo src/lib66/sanitize/sanitize_livestate.lo src/lib66/sanitize/sanitize_migrate.lo src/lib66/sanitize/sanitize_scandir.lo src/lib66/sanitize/sanitize_source.lo src/lib66/sanitize/sanitize_system.lo src/lib66/sanitize/sanitize_write.lo src/lib66/service/service_cmp_basedir.lo src/lib66/service/service_db_migrate.lo src/lib66/service/service_enable_disable.lo src/lib66/service/service_endof_dir.lo src/lib66/service/service_frontend_path.lo src/lib66/service/service_frontend_src.lo src/lib66/service/service_graph_compute.lo src/lib66/service/service_graph_collect_list.lo src/lib66/service/service_graph_collect.lo src/lib66/service/service_graph_g.lo src/lib66/service/service_hash.lo src/lib66/service/service_is_g.lo src/lib66/service/service_resolve_get_field_tosa.lo src/lib66/service/service_resolve_modify_field.lo src/lib66/service/service_resolve_write.lo src/lib66/service/service_resolve_read_cdb.lo src/lib66/service/service_resolve_read_record.lo src/lib66/service/service_resolve_sanitize.lo src/lib66/service/service_resolve_view_g.lo src/lib66/service/service_resolve_view_record.lo src/lib66/service/service_resolve_write_remote.lo src/lib66/service/service_resolve_write_cdb.lo src/lib66/service/service_resolve_write_record.lo src/lib66/service/service_resolve_zero.lo src/lib66/service/service_switch_tree.lo src/lib66/shutdown/hpr_shutdown.lo src/lib66/shutdown/hpr_wall.lo src/lib66/shutdown/hpr_wallv.lo src/lib66/state/state_check.lo src/lib66/state/state_latency.lo src/lib66/state/state_messenger.lo src/lib66/state/state_notify.lo src/lib66/state/state_pack.lo src/lib66/state/state_read_remote.lo src/lib66/state/state_read.lo src/lib66/state/state_read_array.lo src/lib66/state/state_rmfile.lo src/lib66/state/state_set_flag.lo src/lib66/state/state_table.lo src/lib66/state/state_unpack.lo src/lib66/state/state_write_remote.lo src/lib66/state/state_write.lo src/lib66/state/state_write_file.lo src/lib66/svc/svc_classic_event.lo src/lib66/svc/svc_compute_ns.lo src/lib66/svc/svc_init_array.lo src/lib66/svc/svc_launch.lo src/lib66/svc/svc_oneshot.lo src/lib66/svc/svc_scandir_ok.lo src/lib66/svc/svc_scandir_send.lo src/lib66/svc/svc_send_classic.lo src/lib66/svc/svc_send_fdholder.lo src/lib66/svc/svc_send_oneshot.lo src/lib66/svc/svc_send_wait.lo src/lib66/svc/svc_unsupervise.lo src/lib66/symlink/symlink_make.lo src/lib66/symlink/symlink_switch.lo src/lib66/trace/trace_pack.lo src/lib66/trace/trace_path.lo src/lib66/trace/trace_read.lo src/lib66/trace/trace_write.lo src/lib66/tree/tree_find_current.lo src/lib66/tree/tree_get_permissions.lo src/lib66/tree/tree_hash.lo src/lib66/tree/tree_iscurrent.lo src/lib66/tree/tree_isenabled.lo src/lib66/tree/tree_isinitialized.lo src/lib66/tree/tree_issupervised.lo src/lib66/tree/tree_isvalid.lo src/lib66/tree/tree_ongroups.lo src/lib66/tree/tree_resolve_get_field_tosa.lo src/lib66/tree/tree_resolve_master_create.lo src/lib66/tree/tree_resolve_master_get_field_tosa.lo src/lib66/tree/tree_resolve_master_modify_field.lo src/lib66/tree/tree_resolve_master_read_cdb.lo src/lib66/tree/tree_resolve_master_sanitize.lo src/lib66/tree/tree_resolve_master_write_cdb.lo src/lib66/tree/tree_resolve_modify_field.lo src/lib66/tree/tree_resolve_read_cdb.lo src/lib66/tree/tree_resolve_sanitize.lo src/lib66/tree/tree_resolve_write_cdb.lo src/lib66/tree/tree_resolve_zero.lo src/lib66/tree/tree_seed_file_isvalid.lo src/lib66/tree/tree_seed_free.lo src/lib66/tree/tree_seed_get_group_permissions.lo src/lib66/tree/tree_seed_get_key.lo src/lib66/tree/tree_seed_isvalid.lo src/lib66/tree/tree_seed_parse_file.lo src/lib66/tree/tree_seed_resolve_path.lo src/lib66/tree/tree_seed_setseed.lo src/lib66/tree/tree_service_add.lo src/lib66/tree/tree_service_remove.lo src/lib66/tree/tree_sethome.lo src/lib66/tree/tree_switch_current.lo src/lib66/utils/get_userhome.lo src/lib66/utils/identifier.lo src/lib66/utils/name_isvalid.lo src/lib66/utils/read_svfile.lo src/lib66/utils/set_environment.lo src/lib66/utils/set_livedir.lo src/lib66/utils/set_livescan.lo src/lib66/utils/set_livestate.lo src/lib66/utils/set_ownerhome.lo src/lib66/utils/set_ownersysdir.lo src/lib66/utils/set_treeinfo.lo src/lib66/utils/version.lo src/lib66/utils/yourgid.lo src/lib66/utils/youruid.lo src/lib66/write/write_classic.lo src/lib66/write/write_common.lo src/lib66/write/write_environ.lo src/lib66/write/write_execute_scripts.lo src/lib66/write/write_logger.lo src/lib66/write/write_oneshot.lo src/lib66/write/write_service.lo src/lib66/write/write_uint.lo
 66: EXTRA_LIBS := -ls6 -loblibs -lskarnet
 66: src/66/66/66.o ${LIB66}
 66-echo: EXTRA_LIBS := -loblibs -lskarnet
@@ -153,6 +153,39 @@ int main(int argc, char const *const *argv)
                     info.opt_color = 1 ;
                     break ;
 
+                case 'e' :
+
+                    if (!strcmp(l.arg, "fork"))
+                        info.engine = SSEXEC_ENGINE_FORK ;
+                    else if (!strcmp(l.arg, "event"))
+                        info.engine = SSEXEC_ENGINE_EVENT ;
+                    else
+                        log_usage(usage_66, "\n", help_66) ;
+                    break ;
+
+                case 'j' :
+
+                    if (!uint0_scan(l.arg, &info.jobs))
+                        log_usage(usage_66, "\n", help_66) ;
+
+                    if (info.jobs > SSEXEC_JOBS_MAX) {
+                        char fmt[UINT_FMT] ;
+                        fmt[uint_fmt(fmt, SSEXEC_JOBS_MAX)] = 0 ;
+                        log_warn("-j value clamped to: ", fmt) ;
+                        info.jobs = SSEXEC_JOBS_MAX ;
+                    }
+                    break ;
+
+                case 's' :
+
+                    if (!strcmp(l.arg, "order"))
+                        info.sched = SSEXEC_SCHED_ORDER ;
+                    else if (!strcmp(l.arg, "critical"))
+                        info.sched = SSEXEC_SCHED_CRITICAL ;
+                    else
+                        log_usage(usage_66, "\n", help_66) ;
+                    break ;
+
                 case '?' :
 
                     log_usage(usage_66, "\n", help_66) ;
@@ -338,6 +371,15 @@ int main(int argc, char const *const *argv)
         info.usage = usage_state ;
         func = &ssexec_state ;
 
+    } else if (!strcmp(argv[0], "analyze")) {
+
+        PROG = "analyze" ;
+        nargv[n++] = PROG ;
+        info.prog = PROG ;
+        info.help = help_analyze ;
+        info.usage = usage_analyze ;
+        func = &ssexec_analyze ;
+
     } else if (!strcmp(argv[0], "remove")) {
 
         PROG = "remove" ;
@@ -35,6 +35,7 @@
 #include <66/state.h>
 #include <66/svc.h>
 #include <66/symlink.h>
+#include <66/trace.h>
 #include <66/tree.h>
 #include <66/utils.h>
 #include <66/write.h>
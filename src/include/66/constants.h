@@ -68,9 +68,27 @@
 #define SS_STATE_LEN (sizeof SS_STATE - 1)
 #define SS_STATUS "status"
 #define SS_STATUS_LEN (sizeof SS_STATUS - 1)
+#define SS_LATENCY "latency"
+#define SS_LATENCY_LEN (sizeof SS_LATENCY - 1)
+#define SS_STATE_TABLE "/.table"
+#define SS_STATE_TABLE_LEN (sizeof SS_STATE_TABLE - 1)
+#define SS_STATE_EVENT "/.event"
+#define SS_STATE_EVENT_LEN (sizeof SS_STATE_EVENT - 1)
+
+#define SS_TRACE ".trace"
+#define SS_TRACE_LEN (sizeof SS_TRACE - 1)
+/** a transaction records about four transitions per service,
+ * the ring keeps two full transactions of SS_MAX_SERVICE services */
+#define SS_TRACE_MAX (SS_MAX_SERVICE * 8 > 2048 ? SS_MAX_SERVICE * 8 : 2048)
 
 #define SS_RESOLVE "/.resolve"
 #define SS_RESOLVE_LEN (sizeof SS_RESOLVE - 1)
+#define SS_RESOLVE_DBFILE "/.resolve.db"
+#define SS_RESOLVE_DBFILE_LEN (sizeof SS_RESOLVE_DBFILE - 1)
+#define SS_RESOLVE_DBLOCK "/.resolve.lock"
+#define SS_RESOLVE_DBLOCK_LEN (sizeof SS_RESOLVE_DBLOCK - 1)
+#define SS_RESOLVE_RECORD "/.record"
+#define SS_RESOLVE_RECORD_LEN (sizeof SS_RESOLVE_RECORD - 1)
 
 #define SS_FDHOLDER "fdholder"
 #define SS_FDHOLDER_LEN (sizeof SS_FDHOLDER - 1)
@@ -109,6 +127,7 @@
 #define SS_BOOT_UMASK 0022
 #define SS_BOOT_RESCAN 0
 #define SS_BOOT_CATCH_LOG 1
+#define SS_BOOT_JOBS 0
 #define SS_BOOT_LOG "scandir/0/scandir-log"
 #define SS_BOOT_LOG_LEN (sizeof SS_BOOT_LOG - 1)
 #define SS_BOOT_LOGFIFO "scandir/0/scandir-log/fifo"
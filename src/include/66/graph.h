@@ -19,16 +19,54 @@
 
 #include <oblibs/graph.h>
 
+#include <skalibs/stralloc.h>
+
 #include <66/service.h>
 #include <66/tree.h>
 #include <66/ssexec.h>
 #include <66/hash.h>
 
+/** Sparse view of the edges of a graph_t. The dependencies of the
+ * vertex v are edge[offset[v]] to edge[offset[v + 1] - 1], the vertices
+ * requiring it are redge[roffset[v]] to redge[roffset[v + 1] - 1].
+ * sort is the topological order, dependencies first, and rank[v] the
+ * position of v at sort */
+typedef struct graph_csr_s graph_csr_t, *graph_csr_t_ref ;
+struct graph_csr_s
+{
+    unsigned int nvertex ;
+    unsigned int nedge ;
+    unsigned int *offset ;
+    unsigned int *edge ;
+    unsigned int *roffset ;
+    unsigned int *redge ;
+    unsigned int *sort ;
+    unsigned int *rank ;
+} ;
+#define GRAPH_CSR_ZERO { 0, 0, 0, 0, 0, 0, 0, 0 }
+
+/** give the file defining @vertex to the cycle report, 0 if none */
+typedef char const *graph_cycle_func(char const *vertex, void *data) ;
+
 extern void graph_build_tree(graph_t *g, struct resolve_hash_tree_s **htres, char const *base, resolve_tree_master_enum_t field) ;
 extern void graph_build_system(graph_t *g, struct resolve_hash_s **hres, ssexec_t *info, uint32_t flag) ;
 extern void graph_build_arguments(graph_t *g, char const *const *argv, int argc, struct resolve_hash_s **hres, ssexec_t *info, uint32_t flag) ;
 extern int graph_compute_dependencies(graph_t *g, char const *vertex, char const *edge, uint8_t requiredby) ;
-extern void graph_compute_visit(struct resolve_hash_s hres, unsigned int *visit, unsigned int *list, graph_t *graph, unsigned int *nservice, uint8_t requiredby) ;
+extern void graph_visit_alloc(graph_t *graph, unsigned int **list, uint8_t **visit) ;
+extern void graph_compute_visit(struct resolve_hash_s hres, uint8_t *visit, unsigned int *list, graph_t *graph, unsigned int *nservice, uint8_t requiredby) ;
+extern int graph_csr_vertex_add(graph_t *g, char const *vertex) ;
+extern int graph_csr_edge_add(graph_t *g, char const *vertex, char const *edge) ;
+extern int graph_csr_edge_remove(graph_t *g, char const *vertex, char const *edge) ;
+extern int graph_csr_build(graph_t *g) ;
+extern graph_csr_t *graph_csr_get(graph_t *g) ;
+extern int graph_csr_get_id(graph_t *g, char const *vertex) ;
+extern int graph_csr_get_edge_list(unsigned int *list, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive) ;
+extern int graph_csr_get_edge_sorted_list(unsigned int *list, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive) ;
+extern int graph_csr_get_edge_sa(stralloc *sa, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive) ;
+extern int graph_csr_get_edge_sorted_sa(stralloc *sa, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive) ;
+extern int graph_csr_sort_tosa(stralloc *sa, graph_t *g) ;
+extern void graph_csr_free_all(graph_t *g) ;
+extern int graph_csr_cycle(graph_t *g, char const *what, graph_cycle_func *func, void *data) ;
 extern int graph_build_service_bytree(graph_t *g, char const *tree, uint8_t what,  uint8_t is_supervised) ;
 extern int graph_build_service_bytree_from_src(graph_t *g, char const *src, uint8_t what) ;
 
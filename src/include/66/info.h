@@ -85,4 +85,6 @@ extern int info_graph_display(char const *name, info_graph_func *func, depth_t *
 extern int info_graph_display_service(char const *name) ;
 extern int info_graph_display_tree(char const *name) ;
 
+extern void info_watch(resolve_service_t *const *res, unsigned int n, uint8_t json) ;
+
 #endif
@@ -16,5 +16,6 @@
 #define SS_MIGRATE_H
 
 #include <66/migrate_0721.h>
+#include <66/migrate_record.h>
 
 #endif
@@ -0,0 +1,22 @@
+/*
+ * migrate_record.h
+ *
+ * Copyright (c) 2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#ifndef SS_MIGRATE_RECORD_H
+#define SS_MIGRATE_RECORD_H
+
+#include <66/ssexec.h>
+
+extern void migrate_record(ssexec_t *info) ;
+
+#endif
@@ -88,7 +88,7 @@ extern int parse_mandatory(resolve_service_t *res, ssexec_t *info) ;
 extern void parse_error(int ierr, int idsec, key_description_t const *list, int idkey) ;
 extern void parse_rename_interdependences(resolve_service_t *res, char const *prefix, struct resolve_hash_s **hres, ssexec_t *info) ;
 extern void parse_db_migrate(resolve_service_t *res, ssexec_t *info) ;
-extern void parse_copy_to_source(char const *dst, char const *src, resolve_service_t *res, uint8_t force) ;
+extern void parse_move_to_source(char const *dst, char const *src, resolve_service_t *res, uint8_t force, stralloc *dirs) ;
 
 /** module */
 extern void parse_module(resolve_service_t *res, struct resolve_hash_s **hres, ssexec_t *info, uint8_t force) ;
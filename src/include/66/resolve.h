@@ -17,6 +17,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <skalibs/stralloc.h>
 #include <skalibs/cdb.h>
@@ -41,10 +42,49 @@ struct resolve_wrapper_s
     else if (wres->type == DATA_TREE_MASTER) sawres = (&((resolve_tree_master_t *)wres->obj)->sa) ;
 #endif
 
+/** key prefix of a record at the resolve database, indexed by DATA_* */
+#define RESOLVE_DB_KEY(type) ("stm"[(type)])
+
+/** binary record of a service: header then the uint32 fields in
+ * resolve_service_enum_t order then the string area */
+#define RESOLVE_RECORD_MAGIC "66rr"
+#define RESOLVE_RECORD_MAGIC_LEN (sizeof RESOLVE_RECORD_MAGIC - 1)
+#define RESOLVE_RECORD_VERSION 1
+/** magic, version, number of fields, length of the string area */
+#define RESOLVE_RECORD_HEADER_LEN (RESOLVE_RECORD_MAGIC_LEN + 12)
+#define RESOLVE_ISRECORD(map, len) ((len) >= RESOLVE_RECORD_HEADER_LEN && !memcmp((map), RESOLVE_RECORD_MAGIC, RESOLVE_RECORD_MAGIC_LEN))
+
+/** read-only view of a resolve file. The string area of the resolve
+ * structure points inside the mapped file, or to @sa when the file
+ * could not be used as is. Valid until resolve_view_free() */
+typedef struct resolve_view_s resolve_view_t, *resolve_view_t_ref ;
+struct resolve_view_s
+{
+    char *map ;
+    size_t len ;
+    stralloc sa ;
+} ;
+
+#define RESOLVE_VIEW_ZERO { 0, 0, STRALLOC_ZERO }
+
+/** pending modifications of resolve files. A file is read at its
+ * first use by the transaction and written once at the commit,
+ * whatever the number of modifications it received */
+typedef struct resolve_txn_s resolve_txn_t, *resolve_txn_t_ref ;
+struct resolve_txn_s
+{
+    struct resolve_txn_entry_s *entries ;
+} ;
+
+#define RESOLVE_TXN_ZERO { 0 }
+
 typedef struct resolve_field_table_s resolve_field_table_t, *resolve_field_table_t_ref ;
 struct resolve_field_table_s
 {
     char *field ;
+    /** position of the field inside the structure, 0 if the field
+     * is not kept as is (offset 0 is the stralloc) */
+    size_t offset ;
 } ;
 
 /**
@@ -92,10 +132,50 @@ extern void resolve_remove(char const *base, char const *name) ;
 extern int resolve_get_field_tosa(stralloc *sa, resolve_wrapper_t_ref wres, uint8_t field) ;
 extern int resolve_modify_field(resolve_wrapper_t_ref wres, uint8_t field, char const *by) ;
 extern int resolve_read_cdb(resolve_wrapper_t *wres, const char *path, const char *name) ;
+extern int resolve_read_map(resolve_wrapper_t *wres, char const *map, uint32_t len) ;
 extern int resolve_write_cdb(resolve_wrapper_t *wres, const char *path, const char *name) ;
 extern int resolve_add_cdb(cdbmaker *c, char const *key, char const *str, uint32_t element, uint8_t check) ;
 extern int resolve_add_cdb_uint(cdbmaker *c, char const *key, uint32_t data) ;
 extern int resolve_get_sa(stralloc *sa, const cdb *c) ;
 extern int resolve_get_key(const cdb *c, const char *key, uint32_t *field) ;
 
+/**
+ *
+ * Resolve database
+ *
+ * */
+
+extern int resolve_db_read(resolve_wrapper_t *wres, char const *base, char const *name) ;
+extern int resolve_db_sync(char const *base, uint8_t type, char const *list, size_t len) ;
+extern void resolve_db_invalidate(char const *base) ;
+
+/**
+ *
+ * Cache
+ *
+ * */
+
+extern int resolve_cache_get(char const *file, char const **map, size_t *len) ;
+extern void resolve_cache_remove(char const *file) ;
+
+/**
+ *
+ * Read-only view
+ *
+ * */
+
+extern void resolve_view_free(resolve_view_t *view) ;
+
+/**
+ *
+ * Transaction
+ *
+ * */
+
+extern int resolve_txn_get(resolve_wrapper_t **wres, resolve_txn_t *txn, uint8_t type, char const *base, char const *name) ;
+extern int resolve_txn_modify_field(resolve_txn_t *txn, uint8_t type, char const *base, char const *name, uint8_t field, char const *value) ;
+extern int resolve_txn_touch(resolve_txn_t *txn, uint8_t type, char const *base, char const *name) ;
+extern int resolve_txn_commit(resolve_txn_t *txn) ;
+extern void resolve_txn_free(resolve_txn_t *txn) ;
+
 #endif
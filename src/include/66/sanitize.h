@@ -32,6 +32,6 @@ extern void sanitize_graph(ssexec_t *info) ;
 /** @Return 0 the service is already written
  * @Return 1 the service will be overwritten
  * die on system error */
-extern int sanitize_write(resolve_service_t *res, uint8_t force) ;
+extern int sanitize_write(resolve_txn_t *txn, resolve_service_t *res, uint8_t force) ;
 
 #endif
@@ -360,8 +360,12 @@ extern int service_resolve_read_cdb(cdb *c, resolve_service_t *res) ;
 extern void service_resolve_write(resolve_service_t *res) ;
 extern void service_resolve_write_remote(resolve_service_t *res, char const *dst, uint8_t force) ;
 extern int service_resolve_write_cdb(cdbmaker *c, resolve_service_t *sres) ;
-extern void service_enable_disable(graph_t *g, struct resolve_hash_s *hash, struct resolve_hash_s **hres, uint8_t action, uint8_t propagate, ssexec_t *info) ;
-extern void service_switch_tree(resolve_service_t *res, char const *base, char const *totreename, ssexec_t *info) ;
+extern int service_resolve_read_record(char const *map, size_t len, resolve_service_t *res) ;
+extern int service_resolve_write_record(stralloc *sa, resolve_service_t *res) ;
+extern int service_resolve_view_record(char const *map, size_t len, resolve_service_t *res) ;
+extern int service_resolve_view_g(resolve_view_t *view, resolve_service_t *res, char const *base, char const *name) ;
+extern void service_enable_disable(resolve_txn_t *txn, graph_t *g, struct resolve_hash_s *hash, struct resolve_hash_s **hres, uint8_t action, uint8_t propagate, ssexec_t *info) ;
+extern void service_switch_tree(resolve_txn_t *txn, resolve_service_t *res, char const *base, char const *totreename, ssexec_t *info) ;
 extern void service_db_migrate(resolve_service_t *old, resolve_service_t *new, char const *base, uint8_t requiredby) ;
 /* avoid circular dependencies by prototyping the ss_state_t instead
  * of calling the state.h header file*/
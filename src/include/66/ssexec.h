@@ -61,6 +61,9 @@ struct ssexec_s
     uint8_t opt_tree ;
     uint8_t opt_timeout ;
     uint8_t opt_color ;
+    uint8_t engine ; // SSEXEC_ENGINE_EVENT, SSEXEC_ENGINE_FORK
+    unsigned int jobs ; // maximum of services in transition at once, 0 means no limit
+    uint8_t sched ; // SSEXEC_SCHED_ORDER, SSEXEC_SCHED_CRITICAL
     // skip option definition 0->no,1-yes
     uint8_t skip_opt_tree ; // tree,treename, treeallow will not be set. Also, trees permissions is not checked.
 } ;
@@ -83,8 +86,24 @@ struct ssexec_s
                         .opt_tree = 0, \
                         .opt_timeout = 0, \
                         .opt_color = 0, \
+                        .engine = 0, \
+                        .jobs = 0, \
+                        .sched = 0, \
                         .skip_opt_tree = 0 }
 
+/** svc_launch engine */
+#define SSEXEC_ENGINE_EVENT 0 // single process state machine driven by ftrigr
+#define SSEXEC_ENGINE_FORK 1 // one process per service, notification through pipes
+
+/** order of the ready services of a transaction */
+/** the fork engine keeps one byte per job slot at a pipe, a pipe
+ * holds at least one page even when the pipe buffers of the user
+ * are exhausted */
+#define SSEXEC_JOBS_MAX 4096
+
+#define SSEXEC_SCHED_ORDER 0 // first ready, first launched
+#define SSEXEC_SCHED_CRITICAL 1 // longest remaining path first, implies the event engine
+
 typedef int ssexec_func_t(int argc, char const *const *argv, ssexec_t *info) ;
 typedef ssexec_func_t *ssexec_func_t_ref ;
 
@@ -116,6 +135,7 @@ extern ssexec_func_t ssexec_resolve ;
 extern ssexec_func_t ssexec_state ;
 extern ssexec_func_t ssexec_remove ;
 extern ssexec_func_t ssexec_signal ;
+extern ssexec_func_t ssexec_analyze ;
 
 /** tree */
 extern ssexec_func_t ssexec_tree_wrapper ;
@@ -171,6 +191,8 @@ extern char const *usage_remove ;
 extern char const *help_remove ;
 extern char const *usage_signal ;
 extern char const *help_signal ;
+extern char const *usage_analyze ;
+extern char const *help_analyze ;
 
 extern char const *usage_tree_wrapper ;
 extern char const *help_tree_wrapper ;
@@ -244,7 +266,7 @@ extern char const *help_snapshot_remove ;
 extern char const *usage_snapshot_list ;
 extern char const *help_snapshot_list ;
 
-#define OPTS_MAIN "hv:l:t:T:z"
+#define OPTS_MAIN "hv:l:t:T:ze:j:s:"
 #define OPTS_MAIN_LEN (sizeof OPTS_MAIN - 1)
 #define OPTS_SUBSTART "hP"
 #define OPTS_SUBSTART_LEN (sizeof OPTS_SUBSTART - 1)
@@ -260,7 +282,7 @@ extern char const *help_snapshot_list ;
 #define OPTS_STOP_LEN (sizeof OPTS_STOP - 1)
 #define OPTS_REMOVE "hfP"
 #define OPTS_REMOVE_LEN (sizeof OPTS_REMOVE - 1)
-#define OPTS_STATUS "hno:grd:p:"
+#define OPTS_STATUS "hno:grd:p:wj"
 #define OPTS_STATUS_LEN (sizeof OPTS_STATUS - 1)
 #define OPTS_SIGNAL "habqHkti12pcys:rodDuUxOQw:P"
 #define OPTS_SIGNAL_LEN (sizeof OPTS_SIGNAL - 1)
@@ -270,12 +292,14 @@ extern char const *help_snapshot_list ;
 #define OPTS_STATE_LEN (sizeof OPTS_STATE - 1)
 #define OPTS_RESOLVE "h"
 #define OPTS_RESOVLE_LEN (sizeof OPTS_RESOLVE - 1)
+#define OPTS_ANALYZE "hcn:t:"
+#define OPTS_ANALYZE_LEN (sizeof OPTS_ANALYZE - 1)
 
 #define OPTS_TREE_WRAPPER "h"
 #define OPTS_TREE_WRAPPER_LEN (sizeof OPTS_TREE_WRAPPER - 1)
 #define OPTS_TREE_STATUS "no:grd:"
 #define OPTS_TREE_STATUS_LEN (sizeof OPTS_TREE_STATUS - 1)
-#define OPTS_TREE_SIGNAL "f"
+#define OPTS_TREE_SIGNAL "fm"
 #define OPTS_TREE_SIGNAL_LEN (sizeof OPTS_TREE_SIGNAL - 1)
 #define OPTS_TREE_ADMIN "co:EDRnadC:S:"
 #define OPTS_TREE_ADMIN_LEN (sizeof OPTS_TREE_ADMIN - 1)
@@ -16,6 +16,7 @@
 #define SS_STATE_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 #include <skalibs/uint32.h>
 
@@ -76,9 +77,20 @@ extern void state_unpack(char *pack, ss_state_t *sta) ;
 extern void state_set_flag(ss_state_t *sta, int flags,int flags_val) ;
 extern int state_check(resolve_service_t *res) ;
 extern int state_write(ss_state_t *sta, resolve_service_t *res) ;
+extern int state_write_file(char const *path, char const *pack) ;
 extern int state_write_remote(ss_state_t *sta, char const *tmp) ;
 extern int state_read(ss_state_t *sta, resolve_service_t *res) ;
 extern int state_read_remote(ss_state_t *sta, char const *dst) ;
+extern int state_read_array(ss_state_t *sta, uint8_t *found, resolve_service_t *const *res, unsigned int n) ;
 extern int state_messenger(resolve_service_t *res, uint32_t flag, uint32_t value) ;
+extern uint32_t state_read_latency(resolve_service_t *res) ;
+extern int state_write_latency(resolve_service_t *res, uint32_t ms) ;
+
+/** table of the state of the services living at the live directory */
+extern int state_table_read(ss_state_t *sta, resolve_service_t *res) ;
+extern int state_table_write(ss_state_t *sta, resolve_service_t *res, uint8_t create) ;
+extern int state_table_set_flag(resolve_service_t *res, int flag, uint32_t value) ;
+extern void state_table_release(resolve_service_t *res) ;
+extern void state_notify(resolve_service_t *res) ;
 
 #endif
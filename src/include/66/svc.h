@@ -22,11 +22,20 @@
 #include <66/graph.h>
 
 #include <skalibs/tai.h>
+#include <skalibs/genalloc.h>
+#include <skalibs/iopause.h>
+#include <skalibs/unixmessage.h>
 
 #include <66/service.h>
 
 #define DATASIZE 65
 
+/** notification between the processes of a transaction: the slot of
+ * the sender as uint32 big endian followed by the event character.
+ * A record is far below PIPE_BUF, writers never interleave */
+#define SVC_NOTIF_SIZE 5
+#define SVC_NOTIF_BUFSIZE (SVC_NOTIF_SIZE * 128)
+
 #define SVC_FLAGS_STARTING 1 // 1 starting not really up
 #define SVC_FLAGS_STOPPING (1 << 1) // 2 stopping not really down
 #define SVC_FLAGS_UP (1 << 2) // 4 really up
@@ -34,6 +43,15 @@
 #define SVC_FLAGS_BLOCK (1 << 4) // 16 all deps are not up/down
 #define SVC_FLAGS_UNBLOCK (1 << 5) // 32 all deps are up/down
 #define SVC_FLAGS_FATAL (1 << 6) // 64 process crashed
+#define SVC_FLAGS_BARRIER (1 << 7) // 128 ordering vertex, nothing to control
+
+/** a barrier vertex orders two sets of services without an edge between
+ * each pair of them, e.g. the trees merged by ssexec_tree_signal. It takes
+ * part in the transaction without a resolve file and is done as soon as
+ * its dependencies are. Its name starts with a slash, never found at a
+ * service name */
+#define SVC_BARRIER '/'
+#define SVC_ISBARRIER(vertex) (*(vertex) == SVC_BARRIER)
 
 typedef struct pidservice_s pidservice_t, *pidservice_t_ref ;
 struct pidservice_s
@@ -44,11 +62,12 @@ struct pidservice_s
     unsigned int vertex ; // id at graph_hash_t struct
     uint8_t state ;
     int nedge ;
-    unsigned int edge[SS_MAX_SERVICE + 1] ; // array of id at graph_hash_t struct
+    unsigned int *edge ; // array of id at graph_hash_t struct, point into svc_array_t.edges
     int nnotif ;
-    /** id at graph_hash_t struct of depends/requiredby service
-     * to notify when a service is started/stopped */
-    unsigned int notif[SS_MAX_SERVICE + 1] ;
+    /** slot at apids array of depends/requiredby service
+     * to notify when a service is started/stopped,
+     * point into svc_array_t.edges */
+    unsigned int *notif ;
 } ;
 
 #define PIDSERVICE_ZERO { \
@@ -58,12 +77,48 @@ struct pidservice_s
     .vertex = -1, \
     .state = 0, \
     .nedge =  0, \
-    .edge = { 0 }, \
+    .edge = NULL, \
     .nnotif = 0, \
-    .notif = { 0 } \
+    .notif = NULL \
 }
 
-extern void svc_init_array(unsigned int *list, unsigned int listlen, pidservice_t *apids, graph_t *g, struct resolve_hash_s **hres, ssexec_t *info, uint8_t requiredby, uint32_t flag) ;
+/** services of a transaction. The edge and notif lists of
+ * every service are stored contiguously at the edges buffer */
+typedef struct svc_array_s svc_array_t, *svc_array_t_ref ;
+struct svc_array_s
+{
+    pidservice_t *apids ;
+    unsigned int napid ;
+    genalloc edges ; // unsigned int
+} ;
+#define SVC_ARRAY_ZERO { .apids = NULL, .napid = 0, .edges = GENALLOC_ZERO }
+
+/** steps of a request to the oneshotd daemon, see svc_oneshot.c */
+#define SVC_ONESHOT_CONNECT 0 // connection in progress
+#define SVC_ONESHOT_BANNER 1 // waiting for the banner of s6-sudod
+#define SVC_ONESHOT_SEND 2 // request not completely sent
+#define SVC_ONESHOT_WAIT 3 // waiting for the end of the program
+
+typedef struct svc_oneshot_s svc_oneshot_t, *svc_oneshot_t_ref ;
+struct svc_oneshot_s
+{
+    int fd ; // connection to the oneshotd daemon
+    uint8_t step ;
+    char buf[16] ; // banner of s6-sudod, then spawn result + wait status
+    size_t len ;
+    int wstat ;
+    unixmessage_sender b ; // the request
+    tain deadline ; // end of the handshake, the program has the timeout of the service
+} ;
+
+#define SVC_ONESHOT_ZERO { .fd = -1, .step = SVC_ONESHOT_CONNECT, .buf = { 0 }, .len = 0, .wstat = 0, .b = UNIXMESSAGE_SENDER_ZERO, .deadline = TAIN_ZERO }
+#define svc_oneshot_fd(o) ((o)->fd)
+/** events to wait for on svc_oneshot_fd() before calling svc_oneshot_update() */
+#define svc_oneshot_events(o) ((o)->step == SVC_ONESHOT_CONNECT || (o)->step == SVC_ONESHOT_SEND ? IOPAUSE_WRITE : IOPAUSE_READ)
+#define svc_oneshot_handshake(o) ((o)->step < SVC_ONESHOT_WAIT)
+
+extern void svc_init_array(svc_array_t *array, unsigned int *list, unsigned int listlen, graph_t *g, struct resolve_hash_s **hres, ssexec_t *info, uint8_t requiredby, uint32_t flag) ;
+extern void svc_array_free(svc_array_t *array) ;
 extern int svc_launch(pidservice_t *apids, unsigned int napid, uint8_t what, graph_t *graph, struct resolve_hash_s **hres, ssexec_t *info, char const *rise, uint8_t rise_opt, uint8_t msg, char const *signal, uint8_t propagate) ;
 extern int svc_compute_ns(resolve_service_t *res, uint8_t what, ssexec_t *info, char const *updown, uint8_t opt_updown, uint8_t reloadmsg,char const *data, uint8_t propagate, pidservice_t *apids, unsigned int napids) ;
 extern int svc_scandir_ok (char const *dir) ;
@@ -72,4 +127,17 @@ extern int svc_send_wait(char const *const *list, unsigned int nservice, char **
 extern void svc_unsupervise(unsigned int *alist, unsigned int alen, graph_t *g, struct resolve_hash_s **hres, ssexec_t *info) ;
 extern void svc_send_fdholder(char const *socket, char const *signal) ;
 
+/** classic */
+extern int svc_send_classic(resolve_service_t *res, char const *sig, char wait, unsigned int timeout) ;
+extern char svc_classic_wait(resolve_service_t *res, char wait) ;
+extern int svc_classic_status(resolve_service_t *res, char wait) ;
+extern int svc_classic_event(char wait, uint8_t *down, char c) ;
+
+/** oneshot */
+extern int svc_send_oneshot(resolve_service_t *res, char const *action, unsigned int timeout) ;
+extern int svc_oneshot_start(svc_oneshot_t *o, resolve_service_t *res, char const *action) ;
+extern int svc_oneshot_update(svc_oneshot_t *o) ;
+extern void svc_oneshot_end(svc_oneshot_t *o) ;
+extern int svc_oneshot_exitcode(svc_oneshot_t *o) ;
+
 #endif
@@ -0,0 +1,81 @@
+/*
+ * trace.h
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#ifndef SS_TRACE_H
+#define SS_TRACE_H
+
+#include <stdint.h>
+
+#include <skalibs/genalloc.h>
+
+#include <66/constants.h>
+
+/** The transitions of the services and trees are recorded at a ring
+ * file of SS_TRACE_MAX fixed size records under the live state
+ * directory of the owner. The file begins with a header:
+ *
+ *      magic(4) version(4) capacity(4) count(4)
+ *
+ * @count is the number of records ever written, the next record
+ * goes to the slot count % capacity. Every integer is big endian.
+ *
+ * A process buffers its records and writes them at once by
+ * trace_flush(), called at exit() or when the buffer is full. */
+
+#define TRACE_MAGIC "66tr"
+#define TRACE_VERSION 1
+#define TRACE_HEADER_SIZE 16
+
+#define TRACE_NAMELEN 80 // including the trailing 0, longer names are truncated
+#define TRACE_TREELEN 32
+#define TRACE_RECORD_SIZE (16 + TRACE_NAMELEN + TRACE_TREELEN + TRACE_NAMELEN)
+
+/** @live may come with or without its trailing slash */
+#define TRACE_PATH_LEN(livelen, ownerlen) ((livelen) + 1 + SS_STATE_LEN + 1 + (ownerlen) + 1 + SS_TRACE_LEN + 1)
+
+#define TRACE_KIND_SERVICE 0
+#define TRACE_KIND_TREE 1
+#define TRACE_KIND_STAGE 2 // boot stage, SENT at its beginning and DONE at its end
+
+#define TRACE_EVENT_QUEUED 0 // part of the transaction
+#define TRACE_EVENT_READY 1 // dependencies satisfied
+#define TRACE_EVENT_SENT 2 // control sent
+#define TRACE_EVENT_DONE 3 // up or down reached
+#define TRACE_EVENT_FAIL 4
+
+typedef struct trace_record_s trace_record_t, *trace_record_t_ref ;
+struct trace_record_s
+{
+    uint64_t stamp ; // CLOCK_MONOTONIC in nanoseconds
+    uint32_t txn ; // pid of the process driving the transaction
+    uint8_t kind ;
+    uint8_t event ;
+    uint8_t what ; // 0 up, 1 down
+    uint8_t exitcode ;
+    char name[TRACE_NAMELEN] ;
+    char tree[TRACE_TREELEN] ;
+    char by[TRACE_NAMELEN] ; // dependency which released the READY event, empty if none
+} ;
+
+extern void trace_path(char *dst, char const *live, char const *ownerstr) ;
+extern int trace_open(char const *live, char const *ownerstr) ;
+extern uint64_t trace_now(void) ;
+extern void trace_write(uint8_t kind, uint8_t event, uint8_t what, char const *name, char const *tree, char const *by, uint8_t exitcode) ;
+extern void trace_write_stamp(uint64_t stamp, uint8_t kind, uint8_t event, uint8_t what, char const *name, char const *tree, char const *by, uint8_t exitcode) ;
+extern void trace_flush(void) ;
+extern int trace_read(genalloc *ga, char const *live, char const *ownerstr) ;
+extern void trace_pack(char *pack, trace_record_t *rec) ;
+extern void trace_unpack(char *pack, trace_record_t *rec) ;
+
+#endif
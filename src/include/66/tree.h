@@ -196,8 +196,8 @@ extern int tree_resolve_write_cdb(cdbmaker *c, resolve_tree_t *tres) ;
 extern void tree_resolve_sanitize(resolve_tree_t *tres) ;
 extern void tree_resolve_modify_field(resolve_tree_t *tres, uint8_t field, char const *data) ;
 extern int tree_resolve_get_field_tosa(stralloc *sa, resolve_tree_t *tres, resolve_tree_enum_t field) ;
-extern void tree_service_add(char const *treename, char const *service, ssexec_t *info) ;
-extern void tree_service_remove(char const *base, char const *treename, char const *service) ;
+extern void tree_service_add(resolve_txn_t *txn, char const *treename, char const *service, ssexec_t *info) ;
+extern void tree_service_remove(resolve_txn_t *txn, char const *base, char const *treename, char const *service) ;
 /** Master */
 extern int tree_resolve_master_read_cdb(cdb *c, resolve_tree_master_t *mres) ;
 extern int tree_resolve_master_write_cdb(cdbmaker *c, resolve_tree_master_t *mres) ;
@@ -0,0 +1,585 @@
+/*
+ * ssexec_analyze.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h> // qsort
+#include <unistd.h> // unlink
+#include <errno.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/types.h>
+#include <skalibs/buffer.h>
+#include <skalibs/lolstdio.h>
+#include <skalibs/genalloc.h>
+#include <skalibs/stralloc.h>
+#include <skalibs/djbunix.h>
+#include <skalibs/sgetopt.h>
+
+#include <66/ssexec.h>
+#include <66/constants.h>
+#include <66/trace.h>
+
+/** last occurrence of a service, a tree or a boot stage at the ring */
+typedef struct analyze_s analyze_t, *analyze_t_ref ;
+struct analyze_s
+{
+    trace_record_t const *rec ; // carries the name and the tree
+    char const *by ;
+    uint64_t queued ;
+    uint64_t ready ;
+    uint64_t sent ;
+    uint64_t done ;
+    uint8_t failed ;
+} ;
+
+static uint64_t origin = 0 ; // first stamp of the ring
+static uint64_t last = 0 ; // last stamp of the ring
+
+static void analyze_time(char *s, uint64_t ns)
+{
+    uint64_t ms = ns / 1000000 ;
+    size_t len = uint64_fmt(s, ms / 1000) ;
+
+    s[len++] = '.' ;
+    s[len++] = '0' + (ms % 1000) / 100 ;
+    s[len++] = '0' + (ms % 100) / 10 ;
+    s[len++] = '0' + ms % 10 ;
+    s[len++] = 's' ;
+    s[len] = 0 ;
+}
+
+static inline uint64_t analyze_duration(analyze_t const *a)
+{
+    return a->sent && a->done > a->sent ? a->done - a->sent : 0 ;
+}
+
+static analyze_t *analyze_find(genalloc *ga, uint8_t kind, char const *name)
+{
+    size_t pos = 0, len = genalloc_len(analyze_t, ga) ;
+    analyze_t *a = genalloc_s(analyze_t, ga) ;
+
+    for (; pos < len ; pos++)
+        if (a[pos].rec->kind == kind && !strcmp(a[pos].rec->name, name))
+            return &a[pos] ;
+
+    return 0 ;
+}
+
+static void analyze_compute(genalloc *ga, genalloc *records)
+{
+    log_flow() ;
+
+    size_t pos = 0, len = genalloc_len(trace_record_t, records) ;
+    trace_record_t const *rec = genalloc_s(trace_record_t, records) ;
+
+    for (; pos < len ; pos++) {
+
+        analyze_t *a = analyze_find(ga, rec[pos].kind, rec[pos].name) ;
+
+        if (!a) {
+
+            analyze_t n = { .rec = &rec[pos], .by = "", .queued = 0, .ready = 0, .sent = 0, .done = 0, .failed = 0 } ;
+
+            if (!genalloc_append(analyze_t, ga, &n))
+                log_die_nomem("genalloc") ;
+
+            a = &genalloc_s(analyze_t, ga)[genalloc_len(analyze_t, ga) - 1] ;
+        }
+
+        switch (rec[pos].event) {
+
+            case TRACE_EVENT_QUEUED:
+                /** a new transaction for it, forget the previous one */
+                a->rec = &rec[pos] ;
+                a->by = "" ;
+                a->queued = rec[pos].stamp ;
+                a->ready = a->sent = a->done = 0 ;
+                a->failed = 0 ;
+                break ;
+
+            case TRACE_EVENT_READY:
+                a->ready = rec[pos].stamp ;
+                a->by = rec[pos].by ;
+                break ;
+
+            case TRACE_EVENT_SENT:
+                a->sent = rec[pos].stamp ;
+                break ;
+
+            case TRACE_EVENT_DONE:
+            case TRACE_EVENT_FAIL:
+                a->done = rec[pos].stamp ;
+                a->failed = rec[pos].event == TRACE_EVENT_FAIL ;
+                break ;
+
+            default: break ;
+        }
+    }
+}
+
+static int analyze_cmp(void const *a, void const *b)
+{
+    uint64_t da = analyze_duration(*(analyze_t *const *)a) ;
+    uint64_t db = analyze_duration(*(analyze_t *const *)b) ;
+
+    return da < db ? 1 : da > db ? -1 : 0 ;
+}
+
+static void analyze_blame(genalloc *ga, unsigned int nline)
+{
+    log_flow() ;
+
+    size_t pos = 0, n = 0, len = genalloc_len(analyze_t, ga) ;
+    analyze_t *a = genalloc_s(analyze_t, ga) ;
+    analyze_t **sorted = (analyze_t **)malloc((len + 1) * sizeof(analyze_t *)) ;
+    char t[UINT64_FMT + 5] ;
+
+    if (!sorted)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+    for (; pos < len ; pos++)
+        if (a[pos].rec->kind == TRACE_KIND_SERVICE && a[pos].sent && a[pos].done)
+            sorted[n++] = &a[pos] ;
+
+    qsort(sorted, n, sizeof(analyze_t *), analyze_cmp) ;
+
+    if (nline && nline < n)
+        n = nline ;
+
+    if (!bprintf(buffer_1, "%s\n", "blame:"))
+        log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+
+    for (pos = 0 ; pos < n ; pos++) {
+
+        analyze_time(t, analyze_duration(sorted[pos])) ;
+
+        if (!bprintf(buffer_1, "%12s %s%s%s (%s)\n", t, sorted[pos]->failed ? log_color->warning : "", sorted[pos]->rec->name, log_color->off, sorted[pos]->rec->tree))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+    }
+
+    free(sorted) ;
+}
+
+/** Start from the service reached the last and follow the dependency
+ * which released it up to a service without dependency */
+static void analyze_chain(genalloc *ga)
+{
+    log_flow() ;
+
+    size_t pos = 0, n = 0, len = genalloc_len(analyze_t, ga) ;
+    analyze_t *a = genalloc_s(analyze_t, ga), *cur = 0 ;
+    analyze_t **chain = (analyze_t **)malloc((len + 1) * sizeof(analyze_t *)) ;
+    char at[UINT64_FMT + 5], plus[UINT64_FMT + 5] ;
+
+    if (!chain)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+    for (; pos < len ; pos++)
+        if (a[pos].rec->kind == TRACE_KIND_SERVICE && a[pos].done && !a[pos].failed && (!cur || a[pos].done > cur->done))
+            cur = &a[pos] ;
+
+    while (cur && n < len) {
+
+        chain[n++] = cur ;
+
+        if (!*cur->by)
+            break ;
+
+        cur = analyze_find(ga, TRACE_KIND_SERVICE, cur->by) ;
+    }
+
+    if (!bprintf(buffer_1, "%s\n", "critical chain:"))
+        log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+
+    while (n--) {
+
+        analyze_t *c = chain[n] ;
+
+        analyze_time(at, (c->sent ? c->sent : c->done) - origin) ;
+        analyze_time(plus, analyze_duration(c)) ;
+
+        if (!bprintf(buffer_1, "    %s%s%s @%s +%s\n", log_color->valid, c->rec->name, log_color->off, at, plus))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+    }
+
+    free(chain) ;
+}
+
+static void analyze_tree(genalloc *ga)
+{
+    log_flow() ;
+
+    size_t pos = 0, i = 0, len = genalloc_len(analyze_t, ga) ;
+    analyze_t *a = genalloc_s(analyze_t, ga) ;
+    char wall[UINT64_FMT + 5], busy[UINT64_FMT + 5], nb[UINT_FMT] ;
+
+    if (!bprintf(buffer_1, "%s\n", "trees:"))
+        log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+
+    for (; pos < len ; pos++) {
+
+        char const *tree = a[pos].rec->tree ;
+        uint64_t first = 0, end = 0, sum = 0 ;
+        unsigned int nservice = 0 ;
+        analyze_t *t = 0 ;
+
+        if (!*tree || a[pos].rec->kind == TRACE_KIND_STAGE)
+            continue ;
+
+        /** first occurrence of the tree only */
+        for (i = 0 ; i < pos ; i++)
+            if (!strcmp(a[i].rec->tree, tree))
+                break ;
+
+        if (i < pos)
+            continue ;
+
+        for (i = pos ; i < len ; i++) {
+
+            if (strcmp(a[i].rec->tree, tree) || a[i].rec->kind == TRACE_KIND_STAGE)
+                continue ;
+
+            if (a[i].rec->kind == TRACE_KIND_TREE) {
+                t = &a[i] ;
+                continue ;
+            }
+
+            nservice++ ;
+            sum += analyze_duration(&a[i]) ;
+
+            if (a[i].sent && (!first || a[i].sent < first))
+                first = a[i].sent ;
+
+            if (a[i].done > end)
+                end = a[i].done ;
+        }
+
+        /** a tree handled as a whole, e.g. at boot time, has its own
+         * records, otherwise the span of its services is used */
+        if (t && t->sent && t->done) {
+            first = t->sent ;
+            end = t->done ;
+        }
+
+        analyze_time(wall, first && end > first ? end - first : 0) ;
+        analyze_time(busy, sum) ;
+        nb[uint_fmt(nb, nservice)] = 0 ;
+
+        if (!bprintf(buffer_1, "    %s%s%s: %s, %s services, %s busy\n", t && t->failed ? log_color->warning : log_color->valid, tree, log_color->off, wall, nb, busy))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+    }
+}
+
+static void analyze_stage(genalloc *ga)
+{
+    log_flow() ;
+
+    size_t pos = 0, len = genalloc_len(analyze_t, ga) ;
+    analyze_t *a = genalloc_s(analyze_t, ga) ;
+    uint8_t title = 0 ;
+    char at[UINT64_FMT + 5], plus[UINT64_FMT + 5] ;
+
+    for (; pos < len ; pos++) {
+
+        if (a[pos].rec->kind != TRACE_KIND_STAGE || !a[pos].sent)
+            continue ;
+
+        if (!title++ && !bprintf(buffer_1, "%s\n", "boot stages:"))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+
+        analyze_time(at, a[pos].sent - origin) ;
+        /** stage2 ends with the last transition made by rc.init */
+        analyze_time(plus, (a[pos].done ? a[pos].done : last) - a[pos].sent) ;
+
+        if (!bprintf(buffer_1, "    %s%s%s @%s +%s\n", log_color->valid, a[pos].rec->name, log_color->off, at, plus))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+    }
+}
+
+/** Chrome trace event format
+ *
+ * Every service, tree and boot stage is a complete event ("ph":"X")
+ * on a lane. Lanes are shared by events which do not overlap, so the
+ * number of lanes used at a given time is the parallelism reached.
+ * The time spent to wait for the dependencies and for a job slot
+ * precedes the event on the same lane. */
+
+#define ANALYZE_PID_STAGE 1
+#define ANALYZE_PID_TREE 2
+#define ANALYZE_PID_SERVICE 3
+
+static inline uint64_t analyze_begin(analyze_t const *a)
+{
+    return a->queued ? a->queued : a->ready ? a->ready : a->sent ;
+}
+
+static inline uint64_t analyze_end(analyze_t const *a)
+{
+    return a->done ? a->done : last ;
+}
+
+static int analyze_cmp_begin(void const *a, void const *b)
+{
+    uint64_t ba = analyze_begin(*(analyze_t *const *)a) ;
+    uint64_t bb = analyze_begin(*(analyze_t *const *)b) ;
+
+    return ba < bb ? -1 : ba > bb ? 1 : 0 ;
+}
+
+static void analyze_json_string(stralloc *sa, char const *str)
+{
+    if (!stralloc_catb(sa, "\"", 1))
+        log_die_nomem("stralloc") ;
+
+    for (; *str ; str++) {
+
+        if ((unsigned char)*str < 0x20)
+            continue ;
+
+        if ((*str == '"' || *str == '\\') && !stralloc_catb(sa, "\\", 1))
+            log_die_nomem("stralloc") ;
+
+        if (!stralloc_catb(sa, str, 1))
+            log_die_nomem("stralloc") ;
+    }
+
+    if (!stralloc_catb(sa, "\"", 1))
+        log_die_nomem("stralloc") ;
+}
+
+static void analyze_json_event(stralloc *sa, char const *name, char const *cat, unsigned int pid, unsigned int tid, uint64_t begin, uint64_t end, analyze_t const *a)
+{
+    char ts[UINT64_FMT], dur[UINT64_FMT], fpid[UINT_FMT], ftid[UINT_FMT], ftxn[UINT32_FMT] ;
+
+    if (end <= begin)
+        return ;
+
+    ts[uint64_fmt(ts, (begin - origin) / 1000)] = 0 ;
+    dur[uint64_fmt(dur, (end - begin) / 1000)] = 0 ;
+    fpid[uint_fmt(fpid, pid)] = 0 ;
+    ftid[uint_fmt(ftid, tid)] = 0 ;
+    ftxn[uint32_fmt(ftxn, a->rec->txn)] = 0 ;
+
+    if (!auto_stra(sa, ",\n{\"name\":"))
+        log_die_nomem("stralloc") ;
+
+    analyze_json_string(sa, name) ;
+
+    if (!auto_stra(sa, ",\"cat\":\"", cat, "\",\"ph\":\"X\",\"ts\":", ts, ",\"dur\":", dur, ",\"pid\":", fpid, ",\"tid\":", ftid, a->failed && !strcmp(cat, "transition") ? ",\"cname\":\"terrible\"" : "", ",\"args\":{\"tree\":"))
+        log_die_nomem("stralloc") ;
+
+    analyze_json_string(sa, a->rec->tree) ;
+
+    if (!auto_stra(sa, ",\"by\":"))
+        log_die_nomem("stralloc") ;
+
+    analyze_json_string(sa, a->by) ;
+
+    if (!auto_stra(sa, ",\"txn\":", ftxn, ",\"failed\":", a->failed ? "true" : "false", "}}"))
+        log_die_nomem("stralloc") ;
+}
+
+static void analyze_json_lanes(stralloc *sa, genalloc *ga, uint8_t kind, unsigned int pid)
+{
+    log_flow() ;
+
+    size_t pos = 0, n = 0, len = genalloc_len(analyze_t, ga) ;
+    unsigned int nlane = 0, lane = 0 ;
+    analyze_t *a = genalloc_s(analyze_t, ga) ;
+    analyze_t **sorted = (analyze_t **)malloc((len + 1) * sizeof(analyze_t *)) ;
+    uint64_t *lanes = (uint64_t *)malloc((len + 1) * sizeof(uint64_t)) ;
+
+    if (!sorted || !lanes)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+    /** services and trees already in the wanted state were not sent */
+    for (; pos < len ; pos++)
+        if (a[pos].rec->kind == kind && a[pos].sent)
+            sorted[n++] = &a[pos] ;
+
+    qsort(sorted, n, sizeof(analyze_t *), analyze_cmp_begin) ;
+
+    for (pos = 0 ; pos < n ; pos++) {
+
+        analyze_t *e = sorted[pos] ;
+        uint64_t begin = analyze_begin(e), end = analyze_end(e) ;
+
+        for (lane = 0 ; lane < nlane ; lane++)
+            if (lanes[lane] <= begin)
+                break ;
+
+        if (lane == nlane)
+            nlane++ ;
+
+        lanes[lane] = end ;
+
+        if (e->queued && e->ready)
+            analyze_json_event(sa, "dependencies", "wait", pid, lane, e->queued, e->ready, e) ;
+
+        if (e->ready)
+            analyze_json_event(sa, "job slot", "wait", pid, lane, e->ready, e->sent, e) ;
+
+        analyze_json_event(sa, e->rec->name, "transition", pid, lane, e->sent, end, e) ;
+    }
+
+    free(lanes) ;
+    free(sorted) ;
+}
+
+static void analyze_json(genalloc *ga, char const *file)
+{
+    log_flow() ;
+
+    stralloc sa = STRALLOC_ZERO ;
+
+    if (!auto_stra(&sa, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", \
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"boot stages\"}},\n", \
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":2,\"args\":{\"name\":\"trees\"}},\n", \
+        "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":3,\"args\":{\"name\":\"services\"}}"))
+            log_die_nomem("stralloc") ;
+
+    analyze_json_lanes(&sa, ga, TRACE_KIND_STAGE, ANALYZE_PID_STAGE) ;
+    analyze_json_lanes(&sa, ga, TRACE_KIND_TREE, ANALYZE_PID_TREE) ;
+    analyze_json_lanes(&sa, ga, TRACE_KIND_SERVICE, ANALYZE_PID_SERVICE) ;
+
+    if (!auto_stra(&sa, "\n]}\n"))
+        log_die_nomem("stralloc") ;
+
+    if (!strcmp(file, "-")) {
+
+        if (buffer_putflush(buffer_1, sa.s, sa.len) < 0)
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+
+    } else if (!openwritenclose_unsafe(file, sa.s, sa.len))
+        log_dieusys(LOG_EXIT_SYS, "write: ", file) ;
+
+    stralloc_free(&sa) ;
+}
+
+int ssexec_analyze(int argc, char const *const *argv, ssexec_t *info)
+{
+    log_flow() ;
+
+    uint8_t clear = 0 ;
+    unsigned int nline = 0 ;
+    size_t pos = 0 ;
+    char const *json = 0 ;
+    genalloc records = GENALLOC_ZERO ; // trace_record_t
+    genalloc ga = GENALLOC_ZERO ; // analyze_t
+
+    {
+        subgetopt l = SUBGETOPT_ZERO ;
+
+        for (;;) {
+
+            int opt = subgetopt_r(argc, argv, OPTS_ANALYZE, &l) ;
+            if (opt == -1) break ;
+
+            switch (opt) {
+
+                case 'h' :
+
+                    info_help(info->help, info->usage) ;
+                    return 0 ;
+
+                case 'c' :
+
+                    clear = 1 ;
+                    break ;
+
+                case 'n' :
+
+                    if (!uint0_scan(l.arg, &nline))
+                        log_usage(info->usage, "\n", info->help) ;
+                    break ;
+
+                case 't' :
+
+                    json = l.arg ;
+                    break ;
+
+                default :
+                    log_usage(info->usage, "\n", info->help) ;
+            }
+        }
+        argc -= l.ind ; argv += l.ind ;
+    }
+
+    if (clear) {
+
+        char file[TRACE_PATH_LEN(info->live.len, info->ownerlen)] ;
+
+        trace_path(file, info->live.s, info->ownerstr) ;
+
+        if (unlink(file) < 0 && errno != ENOENT)
+            log_dieusys(LOG_EXIT_SYS, "remove: ", file) ;
+
+        return 0 ;
+    }
+
+    if (!trace_read(&records, info->live.s, info->ownerstr)) {
+
+        if (errno == ENOENT) {
+            log_info("Nothing was traced yet") ;
+            return 0 ;
+        }
+
+        log_dieusys(LOG_EXIT_SYS, "read trace file") ;
+    }
+
+    if (!genalloc_len(trace_record_t, &records)) {
+        log_info("Nothing was traced yet") ;
+        return 0 ;
+    }
+
+    /** the boot stages are written after the opening of the file,
+     * the ring is not sorted by stamp */
+    origin = last = genalloc_s(trace_record_t, &records)[0].stamp ;
+
+    for (; pos < genalloc_len(trace_record_t, &records) ; pos++) {
+
+        uint64_t stamp = genalloc_s(trace_record_t, &records)[pos].stamp ;
+
+        if (stamp < origin)
+            origin = stamp ;
+
+        if (stamp > last)
+            last = stamp ;
+    }
+
+    analyze_compute(&ga, &records) ;
+
+    if (json) {
+
+        analyze_json(&ga, json) ;
+
+    } else {
+
+        analyze_stage(&ga) ;
+        analyze_blame(&ga, nline) ;
+        analyze_chain(&ga) ;
+        analyze_tree(&ga) ;
+
+        if (!buffer_flush(buffer_1))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+    }
+
+    genalloc_free(analyze_t, &ga) ;
+    genalloc_free(trace_record_t, &records) ;
+
+    return 0 ;
+}
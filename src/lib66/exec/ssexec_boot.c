@@ -38,17 +38,22 @@
 #include <skalibs/djbunix.h>
 #include <skalibs/stralloc.h>
 #include <skalibs/types.h>
+#include <skalibs/env.h>
 #include <skalibs/exec.h>
 #include <skalibs/cspawn.h>
 
 #include <66/config.h>
 #include <66/constants.h>
 #include <66/ssexec.h>
+#include <66/trace.h>
+#include <66/utils.h>
+#include <66/sanitize.h>
 
 static mode_t mask = SS_BOOT_UMASK ;
 static unsigned int rescan = SS_BOOT_RESCAN ;
 static unsigned int container = SS_BOOT_CONTAINER ;
 static unsigned int catch_log = SS_BOOT_CATCH_LOG ;
+static unsigned int jobs = SS_BOOT_JOBS ;
 static char const *skel = SS_SKEL_DIR ;
 static char const *live = SS_LIVE ;
 static char const *path = SS_BOOT_PATH ;
@@ -60,7 +65,6 @@ static char const *slashdev = 0 ;
 static char const *envdir = 0 ;
 static char const *fifo = 0 ;
 static char const *log_user = SS_LOGGER_RUNNER ;
-static char const *cver = 0 ;
 static char tpath[SS_MAX_PATH_LEN + 1] ;
 static char trcinit[SS_MAX_PATH_LEN + 1] ;
 static char trcinit_container[SS_MAX_PATH_LEN + 1] ;
@@ -193,7 +197,7 @@ static void parse_conf(stralloc *env)
     log_flow() ;
 
     static char const *valid[] =
-    { "VERBOSITY", "PATH", "LIVE", "TREE", "RCINIT", "UMASK", "RESCAN", "CONTAINER", "CATCHLOG", "RCINIT_CONTAINER", 0 } ;
+    { "VERBOSITY", "PATH", "LIVE", "TREE", "RCINIT", "UMASK", "RESCAN", "CONTAINER", "CATCHLOG", "RCINIT_CONTAINER", "JOBS", 0 } ;
 
     unsigned int j = 0 ;
     uint8_t empty = 0 ;
@@ -328,6 +332,24 @@ static void parse_conf(stralloc *env)
 
                 break ;
 
+            case 10:
+
+                if (!get_value(&val, "JOBS"))
+                    empty = 1 ;
+
+                if (!empty && !uint0_scan(val.s, &jobs))
+                    sulogin("invalid JOBS value: ",val.s) ;
+
+                if (empty) {
+                    /** rc.init passes it to 66 -j */
+                    char fmt[UINT_FMT] ;
+                    fmt[uint_fmt(fmt, jobs)] = 0 ;
+                    if (!auto_stra(env, "JOBS=", fmt, "\n"))
+                        sulogin("append environment stralloc with key: JOBS=", fmt) ;
+                }
+
+                break ;
+
             default: break ;
         }
 
@@ -437,42 +459,58 @@ static inline void run_stage2 (stralloc *env)
     xmexec_m(newargv, t, tlen) ;
 }
 
-static inline void make_cmdline(char const *prog,char const **add,int len,char const *msg,char const *arg, stralloc *env)
+/** the scandir does not exist yet, make the same
+ * system check as the 66 binary before any command */
+static int boot_scandir_create(int argc, char const *const *argv, ssexec_t *info)
 {
     log_flow() ;
 
-    size_t elen = sastr_nelement(env) ;
-    char const *e[elen+1] ;
+    sanitize_system(info) ;
 
-    if (!env_make(e, elen, env->s, env->len))
-        sulogin("make environment", "") ;
-    e[elen] = 0 ;
+    return ssexec_scandir_create(argc, argv, info) ;
+}
+
+/** run @func in a child process with the ssexec_t prepared
+ * by the boot. The child does not execute a new 66 binary, so
+ * the option parsing, the owner lookups and the paths setting
+ * are made once. Any failure of @func only ends the child and
+ * calls sulogin as before. */
+static inline void make_stage(ssexec_func_t_ref func, char const *prog, char const *const *argv, int argc, char const *msg, char const *arg, ssexec_t *binfo, stralloc *env)
+{
+    log_flow() ;
 
     pid_t pid ;
     int wstat ;
-    int m = 7 + len, i = 0, n = 0 ;
-    char const *newargv[m] ;
 
-    newargv[n++] = "66" ;
-    newargv[n++] = "-v" ;
-    newargv[n++] = cver ;
-    newargv[n++] = "-l" ;
-    newargv[n++] = live ;
-    newargv[n++] = prog ;
+    pid = fork() ;
+
+    if (pid < 0)
+        sulogin("fork: ", prog) ;
+
+    if (!pid) {
 
-    for (;i<len;i++)
-        newargv[n++] = add[i] ;
+        /** the stage runs with the boot environment as the spawned
+         * 66 binary did, every process it starts inherits it */
+        size_t n = env_len((char const *const *)environ) + 1 + sastr_nelement(env) ;
+        char const *newenv[n + 1] ;
 
-    newargv[n] = 0 ;
+        if (!env_merge(newenv, n, (char const *const *)environ, env_len((char const *const *)environ), env->s, env->len))
+            sulogin("build environment for: ", prog) ;
 
-    pid = child_spawn0(newargv[0], newargv, e) ;
+        environ = (char **)newenv ;
+
+        PROG = prog ;
+        binfo->prog = prog ;
+        int e = (*func)(argc, argv, binfo) ;
+        trace_flush() ;
+        _exit(e) ;
+    }
 
     if (waitpid_nointr(pid, &wstat, 0) < 0)
-        sulogin("wait for: ", newargv[0]) ;
+        sulogin("wait for: ", prog) ;
 
     if (wstat)
         sulogin(msg, arg) ;
-
 }
 
 static void cad(void)
@@ -511,8 +549,10 @@ int ssexec_boot(int argc, char const *const *argv, ssexec_t *info)
     unsigned int r , tmpfs = 0, opened = 0 ;
     size_t bannerlen, livelen ;
     pid_t pid ;
-    char verbo[UINT_FMT] ;
-    cver = verbo ;
+    /** begin and end of the scandir creation and the tree initialization */
+    uint64_t stage[4] = { 0 } ;
+    /** shared by the boot stages, see make_stage() */
+    ssexec_t binfo = SSEXEC_ZERO ;
 
     {
         subgetopt l = SUBGETOPT_ZERO ;
@@ -542,6 +582,10 @@ int ssexec_boot(int argc, char const *const *argv, ssexec_t *info)
         log_diesys(LOG_EXIT_USER, "nice try, but missing root privileges") ;
     }
 
+    ssexec_copy(&binfo, info) ;
+    binfo.live.len = 0 ;
+    binfo.scandir.len = 0 ;
+
     {
         if (skel[0] != '/')
             sulogin("skeleton directory must be an aboslute path: ",skel) ;
@@ -575,7 +619,6 @@ int ssexec_boot(int argc, char const *const *argv, ssexec_t *info)
     }
 
     parse_conf(&env) ;
-    verbo[uint_fmt(verbo, VERBOSITY)] = 0 ;
     bannerlen = strlen(banner) ;
     livelen = strlen(live) ;
     char tfifo[livelen + 1 + SS_BOOT_LOGFIFO_LEN + 1] ;
@@ -664,13 +707,21 @@ int ssexec_boot(int argc, char const *const *argv, ssexec_t *info)
         }
     }
 
+    /** the stages below work on the live
+     * directory of the boot configuration */
+    if (!auto_stra(&binfo.live, live) ||
+        set_livedir(&binfo.live) <= 0 ||
+        !stralloc_copy(&binfo.scandir, &binfo.live) ||
+        set_livescan(&binfo.scandir, binfo.owner) <= 0)
+            sulogin("set live directory: ", live) ;
+
     /** create scandir */
     {
         size_t ncatch = !catch_log ? 1 : 0 ;
         size_t nargc = 6 + ncatch ;
         unsigned int m = 0 ;
 
-        char const *t[nargc] ;
+        char const *t[nargc + 1] ;
 
         t[m++] = "create" ;
         if (container) {
@@ -686,17 +737,41 @@ int ssexec_boot(int argc, char const *const *argv, ssexec_t *info)
         t[m++] = skel ;
         t[m++] = "-L" ;
         t[m++] = log_user ;
+        t[m] = 0 ;
 
         log_info("Create live scandir at: ",live) ;
 
-        make_cmdline("scandir", t, nargc, "create live scandir at: ", live, &env) ;
+        binfo.help = help_scandir_create ;
+        binfo.usage = usage_scandir_create ;
+
+        stage[0] = trace_now() ;
+        make_stage(&boot_scandir_create, "scandir", t, nargc, "create live scandir at: ", live, &binfo, &env) ;
+        stage[1] = trace_now() ;
     }
 
     /** initiate earlier service */
     {
-        char const *t[] = { "init", tree } ;
+        char const *t[] = { "init", tree, 0 } ;
         log_info("Initiate earlier service of tree: ",tree) ;
-        make_cmdline("tree", t, 2, "initiate earlier service of tree: ", tree, &env) ;
+
+        binfo.help = help_tree_init ;
+        binfo.usage = usage_tree_init ;
+
+        stage[2] = trace_now() ;
+        make_stage(&ssexec_tree_init, "tree", t, 2, "initiate earlier service of tree: ", tree, &binfo, &env) ;
+        stage[3] = trace_now() ;
+    }
+
+    ssexec_free(&binfo) ;
+
+    /** the live state directory exists from now, record the stages
+     * made before its creation */
+    if (trace_open(live, info->ownerstr)) {
+
+        trace_write_stamp(stage[0], TRACE_KIND_STAGE, TRACE_EVENT_SENT, 0, "scandir create", "", 0, 0) ;
+        trace_write_stamp(stage[1], TRACE_KIND_STAGE, TRACE_EVENT_DONE, 0, "scandir create", "", 0, 0) ;
+        trace_write_stamp(stage[2], TRACE_KIND_STAGE, TRACE_EVENT_SENT, 0, "tree init", tree, 0, 0) ;
+        trace_write_stamp(stage[3], TRACE_KIND_STAGE, TRACE_EVENT_DONE, 0, "tree init", tree, 0, 0) ;
     }
 
     if (catch_log)
@@ -728,6 +803,11 @@ int ssexec_boot(int argc, char const *const *argv, ssexec_t *info)
         if (!catch_log && pipe(notifpipe) < 0)
             sulogin("pipe","") ;
 
+        /** its end is the last transition made by rc.init */
+        trace_write(TRACE_KIND_STAGE, TRACE_EVENT_SENT, 0, "stage2", "", 0, 0) ;
+        /** both sides of the fork below exec */
+        trace_flush() ;
+
         pid = fork() ;
 
         if (pid == -1)
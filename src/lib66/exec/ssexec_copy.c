@@ -40,6 +40,9 @@ void ssexec_copy(ssexec_t *dest, ssexec_t *src)
     dest->opt_live = src->opt_live ;
     dest->opt_timeout = src->opt_timeout ;
     dest->opt_color = src->opt_color ;
+    dest->engine = src->engine ;
+    dest->jobs = src->jobs ;
+    dest->sched = src->sched ;
     dest->skip_opt_tree = src->skip_opt_tree ;
 }
 
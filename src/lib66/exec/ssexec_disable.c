@@ -40,6 +40,7 @@ int ssexec_disable(int argc, char const *const *argv, ssexec_t *info)
     graph_t graph = GRAPH_ZERO ;
     struct resolve_hash_s *hres = NULL ;
     struct resolve_hash_s tostop[argc] ;
+    resolve_txn_t txn = RESOLVE_TXN_ZERO ;
 
     memset(tostop, 0, sizeof(struct resolve_hash_s) * argc) ;
 
@@ -90,12 +91,16 @@ int ssexec_disable(int argc, char const *const *argv, ssexec_t *info)
         if (hash == NULL)
             log_dieu(LOG_EXIT_USER, "find service: ", argv[n], " -- did you parse it?") ;
 
-        service_enable_disable(&graph, hash, &hres, 0, propagate, info) ;
+        service_enable_disable(&txn, &graph, hash, &hres, 0, propagate, info) ;
 
         tostop[n] = *hash ;
     }
 
-    graph_free_all(&graph) ;
+    if (!resolve_txn_commit(&txn))
+        log_dieu(LOG_EXIT_SYS, "write resolve files of trees") ;
+
+    resolve_txn_free(&txn) ;
+    graph_csr_free_all(&graph) ;
     e = 0 ;
 
     if (stop && n) {
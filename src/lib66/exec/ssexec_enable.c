@@ -38,6 +38,7 @@ int ssexec_enable(int argc, char const *const *argv, ssexec_t *info)
     graph_t graph = GRAPH_ZERO ;
     struct resolve_hash_s *hres = NULL ;
     struct resolve_hash_s tostart[argc] ;
+    resolve_txn_t txn = RESOLVE_TXN_ZERO ;
 
     memset(tostart, 0, sizeof(struct resolve_hash_s) * argc) ;
 
@@ -97,11 +98,11 @@ int ssexec_enable(int argc, char const *const *argv, ssexec_t *info)
         if (hash == NULL)
             log_dieu(LOG_EXIT_USER, "find service: ", argv[pos], " -- did you parse it?") ;
 
-        service_enable_disable(&graph, hash, &hres, 1, propagate, info) ;
+        service_enable_disable(&txn, &graph, hash, &hres, 1, propagate, info) ;
 
         if (info->opt_tree) {
 
-            service_switch_tree(&hash->res, info->base.s, info->treename.s, info) ;
+            service_switch_tree(&txn, &hash->res, info->base.s, info->treename.s, info) ;
 
             if (hash->res.logger.want && hash->res.type == TYPE_CLASSIC) {
 
@@ -109,14 +110,19 @@ int ssexec_enable(int argc, char const *const *argv, ssexec_t *info)
                 if (log == NULL)
                     log_die(LOG_EXIT_USER, "service: ", hash->res.sa.s + hash->res.logger.name, " not available -- please make a bug report") ;
 
-                service_switch_tree(&log->res, info->base.s, info->treename.s, info) ;
+                service_switch_tree(&txn, &log->res, info->base.s, info->treename.s, info) ;
             }
         }
 
         tostart[n] = *hash ;
     }
 
-    graph_free_all(&graph) ;
+    /** every tree receiving services is written once */
+    if (!resolve_txn_commit(&txn))
+        log_dieu(LOG_EXIT_SYS, "write resolve files of trees") ;
+
+    resolve_txn_free(&txn) ;
+    graph_csr_free_all(&graph) ;
     e = 0 ;
 
     if (start && n) {
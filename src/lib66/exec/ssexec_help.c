@@ -23,7 +23,7 @@ inline void info_help (char const *help,char const *usage)
 }
 
 
-char const *usage_66 = "66 [ -h ] [ -z ] [ -v verbosity ] [ -l live ] [ -T timeout ] [ -t tree ] start|stop|reload|restart|free|reconfigure|enable|disable|configure|status|resolve|state|remove|signal|snapshot|tree|parse|scandir|boot|poweroff|reboot|halt|wall|version [<command options> or <subcommand options> ] service...|tree" ;
+char const *usage_66 = "66 [ -h ] [ -z ] [ -v verbosity ] [ -l live ] [ -T timeout ] [ -t tree ] [ -e engine ] [ -j jobs ] [ -s sched ] start|stop|reload|restart|free|reconfigure|enable|disable|configure|status|resolve|state|analyze|remove|signal|snapshot|tree|parse|scandir|boot|poweroff|reboot|halt|wall|version [<command options> or <subcommand options> ] service...|tree" ;
 
 char const *help_66 =
 "\nprogram to init a system, control and manage services\n"
@@ -35,6 +35,9 @@ char const *help_66 =
 "   -l live: changes live directory\n"
 "   -T timeout: general timeout (in milliseconds) passed to command\n"
 "   -t tree: set tree as tree to use\n"
+"   -e engine: engine used to handle a transaction: event(default) or fork\n"
+"   -j jobs: maximum of services in transition at once, 0(default) means no limit\n"
+"   -s sched: order of the ready services: order(default) or critical\n"
 "\n"
 "command:\n"
 "   start: bring up service\n"
@@ -49,6 +52,7 @@ char const *help_66 =
 "   status: display service informations\n"
 "   resolve: display the service's resolve file contents\n"
 "   state: display service's state file contents\n"
+"   analyze: display where the time of the transactions goes\n"
 "   remove: remove service and cleanup all files belong to it within the system\n"
 "   signal: send signal to services\n"
 "   snapshot: manage system snapshot\n"
@@ -187,7 +191,7 @@ char const *help_free =
 "   -P: do not propagate signal to its dependencies\n"
 ;
 
-char const *usage_status = "66 status [ -h ] [ -n ] [ -o name,intree,status,... ] [ -g ] [ -d depth ] [ -r ] [ -p nline ] service" ;
+char const *usage_status = "66 status [ -h ] [ -n ] [ -o name,intree,status,... ] [ -g ] [ -d depth ] [ -r ] [ -p nline ] [ -w ] [ -j ] service..." ;
 
 char const *help_status =
 "\ndisplay services informations\n"
@@ -200,6 +204,8 @@ char const *help_status =
 "   -d depth: Limit the depth of interdependence graph recursion by depth\n"
 "   -r: reverse the interdependence graph\n"
 "   -p nline: print nline last lines of the log file\n"
+"   -w: watch and print the state transitions of the services\n"
+"   -j: with -w, print the transitions as JSON lines\n"
 "\n"
 "valid fields for -o options are:\n"
 "\n"
@@ -246,6 +252,18 @@ char const *help_state =
 "   -h: print this help\n"
 ;
 
+char const *usage_analyze = "66 analyze [ -h ] [ -c ] [ -n number ] [ -t file ]" ;
+
+char const *help_analyze =
+"\ndisplay the blame list, the critical chain and the per tree totals of the traced transactions\n"
+"\n"
+"options:\n"
+"   -h: print this help\n"
+"   -c: clear the trace file\n"
+"   -n: only display the number slowest services of the blame list\n"
+"   -t: write the transitions at file in Chrome trace event format, - for stdout\n"
+;
+
 char const *usage_remove = "66 remove [ -h ] [ -P ] service..." ;
 
 char const *help_remove =
@@ -437,18 +455,19 @@ char const *help_tree_init =
 "   -h: print this help\n"
 ;
 
-char const *usage_tree_start = "66 tree start [ -h ] tree" ;
+char const *usage_tree_start = "66 tree start [ -h ] [ -m ] tree" ;
 
 char const *help_tree_start =
 "\nbring up all enabled services of tree\n"
 "\n"
 "options:\n"
 "   -h: print this help\n"
+"   -m: start all trees with one services transaction\n"
 "\n"
 "If no tree name are provided, it bring up all enabled services within all enabled trees of the system\n"
 ;
 
-char const *usage_tree_stop = "66 tree stop [ -h ] [ -f ] tree" ;
+char const *usage_tree_stop = "66 tree stop [ -h ] [ -f ] [ -m ] tree" ;
 
 char const *help_tree_stop =
 "\nbring down all services of tree\n"
@@ -456,6 +475,7 @@ char const *help_tree_stop =
 "options:\n"
 "   -h: print this help\n"
 "   -f: fork the process\n"
+"   -m: stop all trees with one services transaction\n"
 "\n"
 "If no tree name are provided, it bring down all services within all enabled trees of the system\n"
 ;
@@ -13,6 +13,7 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/types.h>
@@ -44,11 +45,10 @@ int ssexec_reconfigure(int argc, char const *const *argv, ssexec_t *info)
     resolve_service_t_ref pres = 0 ;
     struct resolve_hash_s tostate[argc] ;
     struct resolve_hash_s toenable[argc] ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1], ntostate = 0, ntoenable = 0, nservice = 0, n = 0 ;
+    unsigned int *list = 0, ntostate = 0, ntoenable = 0, nservice = 0, n = 0 ;
+    uint8_t *visit = 0 ;
     ss_state_t sta = STATE_ZERO ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
     memset(tostate, 0, argc * sizeof(struct resolve_hash_s)) ;
     memset(toenable, 0, argc * sizeof(struct resolve_hash_s)) ;
     FLAGS_SET(flag, STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_TOPARSE|STATE_FLAGS_WANTDOWN) ;
@@ -89,6 +89,8 @@ int ssexec_reconfigure(int argc, char const *const *argv, ssexec_t *info)
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "services selection is not available -- have you already parsed a service?") ;
 
+    graph_visit_alloc(&graph, &list, &visit) ;
+
     for (; n < argc ; n++) {
 
         struct resolve_hash_s *hash = hash_search(&hres, argv[n]) ;
@@ -208,11 +210,11 @@ int ssexec_reconfigure(int argc, char const *const *argv, ssexec_t *info)
 
         /** live of the service still exist.
          * Reverse to the previous state of the toparse flag. */
-        if (state_read_remote(&sta, tostate[n].res.sa.s + tostate[n].res.live.statedir)) {
+        if (state_table_read(&sta, &tostate[n].res) > 0 || state_read_remote(&sta, tostate[n].res.sa.s + tostate[n].res.live.statedir)) {
 
             sta.toparse = STATE_FLAGS_FALSE ;
 
-            if (!state_write_remote(&sta, tostate[n].res.sa.s + tostate[n].res.live.statedir))
+            if (!state_write(&sta, &tostate[n].res))
                 log_warnusys("write status file of: ", tostate[n].res.sa.s + tostate[n].res.live.statedir) ;
         }
     }
@@ -286,8 +288,10 @@ int ssexec_reconfigure(int argc, char const *const *argv, ssexec_t *info)
     }
 
     freed:
+        free(list) ;
+        free(visit) ;
         hash_free(&hres) ;
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
 
     return e ;
 }
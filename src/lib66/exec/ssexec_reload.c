@@ -170,7 +170,7 @@ int ssexec_reload(int argc, char const *const *argv, ssexec_t *info)
 
     err:
         hash_free(&hres) ;
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
 
         return r ;
 }
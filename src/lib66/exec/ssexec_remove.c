@@ -41,6 +41,14 @@
 #include <66/utils.h>
 #include <66/hash.h>
 
+/** removed services, their records are dropped
+ * from the resolve database at the end of the process */
+static stralloc removed = STRALLOC_ZERO ;
+
+/** trees losing the removed services, each one
+ * is written once at the end of the process */
+static resolve_txn_t txn = RESOLVE_TXN_ZERO ;
+
 static void auto_remove(char const *path)
 {
     log_trace("remove directory: ", path) ;
@@ -130,7 +138,7 @@ static void remove_logger(resolve_service_t *res, ssexec_t *info)
 
     auto_remove(lres.sa.s + lres.io.fdout.destination) ;
 
-    tree_service_remove(info->base.s, lres.sa.s + lres.treename, lres.sa.s + lres.name) ;
+    tree_service_remove(&txn, info->base.s, lres.sa.s + lres.treename, lres.sa.s + lres.name) ;
 
     log_trace("remove symlink: ", sym) ;
     unlink_void(sym) ;
@@ -138,6 +146,9 @@ static void remove_logger(resolve_service_t *res, ssexec_t *info)
     log_trace("remove symlink: ", lres.sa.s + lres.live.scandir) ;
     unlink_void(lres.sa.s + lres.live.scandir) ;
 
+    if (SS_RESOLVE_DB && !sastr_add_string(&removed, name))
+        log_die_nomem("stralloc") ;
+
     log_info("Removed successfully: ", lres.sa.s + lres.name) ;
 
     resolve_free(lwres) ;
@@ -161,7 +172,7 @@ static void remove_service(resolve_service_t *res, ssexec_t *info)
     if (res->environ.envdir)
         auto_remove(res->sa.s + res->environ.envdir) ;
 
-    tree_service_remove(info->base.s, res->sa.s + res->treename, res->sa.s + res->name) ;
+    tree_service_remove(&txn, info->base.s, res->sa.s + res->treename, res->sa.s + res->name) ;
 
     auto_strings(sym, res->sa.s + res->path.home, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", res->sa.s + res->name) ;
 
@@ -171,6 +182,9 @@ static void remove_service(resolve_service_t *res, ssexec_t *info)
     log_trace("remove symlink: ", res->sa.s + res->live.scandir) ;
     unlink_void(res->sa.s + res->live.scandir) ;
 
+    if (SS_RESOLVE_DB && !sastr_add_string(&removed, res->sa.s + res->name))
+        log_die_nomem("stralloc") ;
+
     log_info("Removed successfully: ", res->sa.s + res->name) ;
 }
 
@@ -329,6 +343,15 @@ int ssexec_remove(int argc, char const *const *argv, ssexec_t *info)
         }
     }
 
+    if (!resolve_txn_commit(&txn))
+        log_dieu(LOG_EXIT_SYS, "write resolve files of trees") ;
+
+    resolve_txn_free(&txn) ;
+
+    if (removed.len)
+        resolve_db_sync(info->base.s, DATA_SERVICE, removed.s, removed.len) ;
+
+    stralloc_free(&removed) ;
     hash_free(&hres) ;
     free(wres) ;
 
@@ -173,7 +173,7 @@ int ssexec_resolve(int argc, char const *const *argv, ssexec_t *info)
     char const *svname = 0 ;
 
     resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    resolve_view_t view = RESOLVE_VIEW_ZERO ;
 
     char service_buf[MAXOPTS][INFO_FIELD_MAXLEN] = {
         "name",
@@ -296,14 +296,14 @@ int ssexec_resolve(int argc, char const *const *argv, ssexec_t *info)
     else if (!r || r == STATE_FLAGS_FALSE)
         log_die(LOG_EXIT_USER, "service: ", svname, " is not parsed -- try to parse it first using '66 parse ", svname, "'") ;
 
-    if (resolve_read_g(wres, info->base.s, svname) <= 0)
+    if (service_resolve_view_g(&view, &res, info->base.s, svname) <= 0)
         log_dieusys(LOG_EXIT_SYS, "read resolve file") ;
 
     info_field_align(service_buf, fields, field_suffix,MAXOPTS) ;
 
     info_display_service_field(&res) ;
 
-    resolve_free(wres) ;
+    resolve_view_free(&view) ;
 
     return 0 ;
 }
@@ -116,7 +116,7 @@ int ssexec_restart(int argc, char const *const *argv, ssexec_t *info)
     r = svc_send_wait(argv, argc, sig, siglen, info) ;
 
     hash_free(&hres) ;
-    graph_free_all(&graph) ;
+    graph_csr_free_all(&graph) ;
 
     return r ;
 }
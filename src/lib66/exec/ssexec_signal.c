@@ -14,6 +14,7 @@
 
 #include <string.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/graph.h>
@@ -59,7 +60,8 @@ int ssexec_signal(int argc, char const *const *argv, ssexec_t *info)
     char data[DATASIZE + 1] = "-" ;
     unsigned int datalen = 1 ;
     struct resolve_hash_s *hres = NULL ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1] ;
+    unsigned int *list = 0 ;
+    uint8_t *visit = 0 ;
 
     /*
      * STATE_FLAGS_TOPROPAGATE = 0
@@ -78,8 +80,6 @@ int ssexec_signal(int argc, char const *const *argv, ssexec_t *info)
      * */
     uint32_t gflag = STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_ISSUPERVISED|STATE_FLAGS_WANTUP ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
 
     {
         subgetopt l = SUBGETOPT_ZERO ;
@@ -174,6 +174,8 @@ int ssexec_signal(int argc, char const *const *argv, ssexec_t *info)
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "services selection is not supervised -- initiate its first") ;
 
+    graph_visit_alloc(&graph, &list, &visit) ;
+
     for (; pos < argc ; pos++) {
 
         struct resolve_hash_s *hash = hash_search(&hres, argv[pos]) ;
@@ -197,13 +199,16 @@ int ssexec_signal(int argc, char const *const *argv, ssexec_t *info)
     if (!napid)
         log_dieu(LOG_EXIT_USER, "find service: ", argv[0], " -- not currently in use") ;
 
-    pidservice_t apids[napid] ;
+    svc_array_t array = SVC_ARRAY_ZERO ;
 
-    svc_init_array(list, napid, apids, &graph, &hres, info, requiredby, gflag) ;
+    svc_init_array(&array, list, napid, &graph, &hres, info, requiredby, gflag) ;
 
-    r = svc_launch(apids, napid, what, &graph, &hres, info, updown, opt_updown, reloadmsg, data, propagate) ;
+    r = svc_launch(array.apids, array.napid, what, &graph, &hres, info, updown, opt_updown, reloadmsg, data, propagate) ;
 
-    graph_free_all(&graph) ;
+    svc_array_free(&array) ;
+    free(list) ;
+    free(visit) ;
+    graph_csr_free_all(&graph) ;
     hash_free(&hres) ;
 
     return r ;
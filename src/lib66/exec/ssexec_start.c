@@ -13,6 +13,7 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/types.h>
@@ -36,16 +37,14 @@ int ssexec_start(int argc, char const *const *argv, ssexec_t *info)
 {
     log_flow() ;
 
-    int n = 0 ;
+    int n = 0, e = 0 ;
     uint32_t flag = 0 ;
     graph_t graph = GRAPH_ZERO ;
-    uint8_t siglen = 3 ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1], nservice = 0 ;
+    unsigned int *list = 0, nservice = 0 ;
+    uint8_t *visit = 0 ;
 
     struct resolve_hash_s *hres = NULL ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
     FLAGS_SET(flag, STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_TOPARSE|STATE_FLAGS_WANTUP) ;
 
     {
@@ -66,7 +65,6 @@ int ssexec_start(int argc, char const *const *argv, ssexec_t *info)
                 case 'P' :
 
                     FLAGS_CLEAR(flag, STATE_FLAGS_TOPROPAGATE) ;
-                    siglen++ ;
                     break ;
 
                 default :
@@ -102,6 +100,8 @@ int ssexec_start(int argc, char const *const *argv, ssexec_t *info)
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "services selection is not available -- please make a bug report") ;
 
+    graph_visit_alloc(&graph, &list, &visit) ;
+
     for (n = 0 ; n < argc ; n++) {
 
         struct resolve_hash_s *hash = hash_search(&hres, argv[n]) ;
@@ -114,23 +114,20 @@ int ssexec_start(int argc, char const *const *argv, ssexec_t *info)
     /** initiate services at the corresponding scandir */
     sanitize_init(list, nservice, &graph, &hres) ;
 
-    hash_free(&hres) ;
-    graph_free_all(&graph) ;
-
-    char *sig[siglen] ;
-    if (siglen > 3) {
+    /** The graph and the resolve files are already in memory,
+     * bring up the selection from here instead of re-executing
+     * 66 signal which would read and compute everything again. */
+    svc_array_t array = SVC_ARRAY_ZERO ;
 
-        sig[0] = "-P" ;
-        sig[1] = "-wU" ;
-        sig[2] = "-u" ;
-        sig[3] = 0 ;
+    svc_init_array(&array, list, nservice, &graph, &hres, info, 0, flag) ;
 
-    } else {
+    e = svc_launch(array.apids, array.napid, 0, &graph, &hres, info, "-wU", 1, 0, "-u", FLAGS_ISSET(flag, STATE_FLAGS_TOPROPAGATE) ? 1 : 0) ;
 
-        sig[0] = "-wU" ;
-        sig[1] = "-u" ;
-        sig[2] = 0 ;
-    }
+    svc_array_free(&array) ;
+    free(list) ;
+    free(visit) ;
+    hash_free(&hres) ;
+    graph_csr_free_all(&graph) ;
 
-    return svc_send_wait(argv, argc, sig, siglen, info) ;
+    return e ;
 }
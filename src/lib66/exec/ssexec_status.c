@@ -58,6 +58,8 @@ static unsigned int REVERSE = 0 ;
 static unsigned int NOFIELD = 1 ;
 static unsigned int GRAPH = 0 ;
 static unsigned int nlog = 10 ;
+static unsigned int WATCH = 0 ;
+static unsigned int JSON = 0 ;
 
 static wchar_t const field_suffix[] = L" :" ;
 static char fields[INFO_NKEY][INFO_FIELD_MAXLEN] = {{ 0 }} ;
@@ -202,13 +204,12 @@ static void info_display_intree(char const *field,resolve_service_t *res)
     info_display_string(res->sa.s + res->treename) ;
 }
 
-static void info_get_status(resolve_service_t *res)
+/** @sta is the state already read by the caller */
+static void info_get_status(resolve_service_t *res, ss_state_t *sta)
 {
     int r, wstat, warn_color = 0 ;
     pid_t pid ;
 
-    ss_state_t sta = STATE_ZERO ;
-
     if (res->type == TYPE_CLASSIC) {
 
         r = s6_svc_ok(res->sa.s + res->live.scandir) ;
@@ -235,14 +236,11 @@ static void info_get_status(resolve_service_t *res)
 
         char *status = 0 ;
 
-        if (!state_read(&sta, res))
-            log_dieusys(LOG_EXIT_SYS,"read state of: ", res->sa.s + res->name) ;
-
-        if (sta.issupervised == STATE_FLAGS_FALSE) {
+        if (sta->issupervised == STATE_FLAGS_FALSE) {
 
             status = "unsupervised" ;
 
-        } else if (sta.isup == STATE_FLAGS_FALSE) {
+        } else if (sta->isup == STATE_FLAGS_FALSE) {
 
             status = "down" ;
             warn_color = 1 ;
@@ -276,7 +274,7 @@ static void info_display_status(char const *field,resolve_service_t *res)
     if (buffer_putsflush(buffer_1,"") == -1)
         log_dieusys(LOG_EXIT_SYS,"write to stdout") ;
 
-    info_get_status(res) ;
+    info_get_status(res, &ste) ;
 
 }
 
@@ -351,7 +349,7 @@ static void info_display_requiredby(char const *field, resolve_service_t *res)
 
     unsigned int list[graph.mlen] ;
 
-    int count = graph_matrix_get_requiredby(list, &graph, res->sa.s + res->name , 0) ;
+    int count = graph_csr_get_edge_list(list, &graph, res->sa.s + res->name, 1, 0) ;
 
     if (count == -1)
         log_dieu(LOG_EXIT_SYS,"get the requiredby list for service: ", res->sa.s + res->name) ;
@@ -373,7 +371,7 @@ static void info_display_requiredby(char const *field, resolve_service_t *res)
     } else {
 
         deps.len = 0 ;
-        r = graph_matrix_get_edge_g_sorted_sa(&deps,&graph, res->sa.s + res->name, 1, 0) ;
+        r = graph_csr_get_edge_sorted_sa(&deps,&graph, res->sa.s + res->name, 1, 0) ;
         if (r == -1)
             log_dieu(LOG_EXIT_SYS, "get the requiredby list") ;
 
@@ -402,7 +400,7 @@ static void info_display_requiredby(char const *field, resolve_service_t *res)
             info_display_empty() ;
         }
     freed:
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         hash_free(&hres) ;
         stralloc_free(&deps) ;
 }
@@ -428,7 +426,7 @@ static void info_display_deps(char const *field, resolve_service_t *res)
 
     unsigned int list[graph.mlen] ;
 
-    int count = graph_matrix_get_edge(list, &graph, res->sa.s + res->name , 0) ;
+    int count = graph_csr_get_edge_list(list, &graph, res->sa.s + res->name, 0, 0) ;
 
     if (count == -1)
         log_dieu(LOG_EXIT_SYS,"get the dependencies list for service: ", res->sa.s + res->name) ;
@@ -449,7 +447,7 @@ static void info_display_deps(char const *field, resolve_service_t *res)
     }
     else
     {
-        r = graph_matrix_get_edge_g_sorted_sa(&deps,&graph, res->sa.s + res->name, 0, 0) ;
+        r = graph_csr_get_edge_sorted_sa(&deps,&graph, res->sa.s + res->name, 0, 0) ;
         if (r == -1)
             log_dieu(LOG_EXIT_SYS, "get the dependencies list") ;
 
@@ -479,7 +477,7 @@ static void info_display_deps(char const *field, resolve_service_t *res)
         }
 
     freed:
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         hash_free(&hres) ;
         stralloc_free(&deps) ;
 }
@@ -570,7 +568,7 @@ static void info_display_contents(char const *field, resolve_service_t *res)
         }
 
     freed:
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         hash_free(&hres) ;
 }
 
@@ -895,10 +893,10 @@ void info_status_all(void)
     int flag = STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_WANTUP|STATE_FLAGS_WANTDOWN;
     graph_build_tree(&graph, &htres, pinfo->base.s, E_RESOLVE_TREE_MASTER_CONTENTS) ;
 
-    if (!graph_matrix_sort_tosa(&sa, &graph))
+    if (!graph_csr_sort_tosa(&sa, &graph))
         log_dieu(LOG_EXIT_SYS, "get the sorted list of trees") ;
 
-    graph_free_all(&graph) ;
+    graph_csr_free_all(&graph) ;
 
     if (sa.len) {
 
@@ -932,7 +930,7 @@ void info_status_all(void)
                 if (buffer_puts(buffer_1,"\n") == -1)
                     log_dieusys(LOG_EXIT_SYS,"write to stdout") ;
 
-                graph_free_all(&graph) ;
+                graph_csr_free_all(&graph) ;
                 hash_free(&hres) ;
             }
         }
@@ -947,7 +945,7 @@ void info_status_all(void)
 void info_status_one(const char *service, int *what)
 {
     resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    resolve_view_t view = RESOLVE_VIEW_ZERO ;
 
     int r = service_is_g(service, STATE_FLAGS_ISPARSED) ;
     if (r < 0)
@@ -956,7 +954,7 @@ void info_status_one(const char *service, int *what)
     if (!r || r == STATE_FLAGS_FALSE)
         log_die(LOG_EXIT_SYS, "service: ", service, " is not parsed -- try to parse it using '66 parse ", service, "'") ;
 
-    if (resolve_read_g(wres, pinfo->base.s, service) <= 0)
+    if (service_resolve_view_g(&view, &res, pinfo->base.s, service) <= 0)
         log_dieusys(LOG_EXIT_SYS, "read resolve file of: ", service) ;
 
     info_display_all(&res, what) ;
@@ -964,8 +962,69 @@ void info_status_one(const char *service, int *what)
     if (buffer_putsflush(buffer_1,"\n") == -1)
         log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
 
-    resolve_free(wres) ;
+    resolve_view_free(&view) ;
+
+}
+
+/** without arguments, every service of every tree is followed */
+void info_status_watch(char const *const *argv, int argc)
+{
+    int r ;
+    size_t pos = 0, tpos = 0 ;
+    unsigned int n = 0, npos = 0 ;
+    _alloc_sa_(sa) ;
+    _alloc_sa_(tree) ;
+    _alloc_sa_(contents) ;
+
+    if (!argc) {
+
+        if (!resolve_get_field_tosa_g(&tree, pinfo->base.s, SS_MASTER + 1, DATA_TREE_MASTER, E_RESOLVE_TREE_MASTER_CONTENTS))
+            log_dieu(LOG_EXIT_SYS, "get the list of trees") ;
+
+        FOREACH_SASTR(&tree, tpos) {
+
+            contents.len = 0 ;
+
+            if (!resolve_get_field_tosa_g(&contents, pinfo->base.s, tree.s + tpos, DATA_TREE, E_RESOLVE_TREE_CONTENTS))
+                log_dieu(LOG_EXIT_SYS, "get contents list of tree: ", tree.s + tpos) ;
+
+            if (!stralloc_catb(&sa, contents.s, contents.len))
+                log_die_nomem("stralloc") ;
+        }
+
+    } else {
+
+        for (; npos < (unsigned int)argc ; npos++)
+            if (!sastr_add_string(&sa, argv[npos]))
+                log_die_nomem("stralloc") ;
+    }
+
+    n = sastr_nelement(&sa) ;
+    if (!n)
+        log_die(LOG_EXIT_USER, "no services to watch") ;
+
+    resolve_service_t ares[n] ;
+    resolve_service_t *pres[n] ;
+
+    n = 0 ;
+    FOREACH_SASTR(&sa, pos) {
+
+        char *name = sa.s + pos ;
+        ares[n] = service_resolve_zero ;
+        resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &ares[n]) ;
 
+        r = resolve_read_g(wres, pinfo->base.s, name) ;
+        free(wres) ;
+        if (r == -1)
+            log_dieu(LOG_EXIT_SYS, "read resolve file of: ", name) ;
+        if (!r)
+            log_die(LOG_EXIT_SYS, "service: ", name, " is not parsed -- try to parse it using '66 parse ", name, "'") ;
+
+        pres[n] = &ares[n] ;
+        n++ ;
+    }
+
+    info_watch(pres, n, JSON) ;
 }
 
 int ssexec_status(int argc, char const *const *argv, ssexec_t *info)
@@ -1023,6 +1082,8 @@ int ssexec_status(int argc, char const *const *argv, ssexec_t *info)
                 case 'r' :  REVERSE = 1 ; break ;
                 case 'd' :  if (!uint0_scan(l.arg, &INFO_MAXDEPTH)) log_usage(info->usage, "\n", info->help) ; break ;
                 case 'p' :  if (!uint0_scan(l.arg, &nlog)) log_usage(info->usage, "\n", info->help) ; break ;
+                case 'w' :  WATCH = 1 ; break ;
+                case 'j' :  JSON = 1 ; break ;
                 default :   log_usage(info->usage, "\n", info->help) ;
             }
         }
@@ -1034,6 +1095,11 @@ int ssexec_status(int argc, char const *const *argv, ssexec_t *info)
 
     svname = *argv ;
 
+    if (WATCH) {
+        info_status_watch(argv, argc) ;
+        return 0 ;
+    }
+
     if (legacy) {
 
         unsigned int i = 0 ;
@@ -13,6 +13,7 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/types.h>
@@ -23,6 +24,7 @@
 #include <skalibs/sgetopt.h>
 #include <skalibs/djbunix.h>
 #include <skalibs/genalloc.h>
+#include <skalibs/bitarray.h>
 
 #include <66/graph.h>
 #include <66/config.h>
@@ -39,13 +41,11 @@ int ssexec_stop(int argc, char const *const *argv, ssexec_t *info)
 
     uint32_t flag = 0 ;
     graph_t graph = GRAPH_ZERO ;
-    uint8_t siglen = 3 ;
     int e = 0 ;
     struct resolve_hash_s *hres = NULL ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1], nservice = 0, pos = 0, idx = 0 ;
+    unsigned int *list = 0, nservice = 0, pos = 0, idx = 0 ;
+    uint8_t *visit = 0 ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
     FLAGS_SET(flag, STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_ISSUPERVISED|STATE_FLAGS_WANTDOWN) ;
 
     {
@@ -66,7 +66,6 @@ int ssexec_stop(int argc, char const *const *argv, ssexec_t *info)
                 case 'P' :
 
                     FLAGS_CLEAR(flag, STATE_FLAGS_TOPROPAGATE) ;
-                    siglen++ ;
                     break ;
 
                 case 'u' :
@@ -92,6 +91,8 @@ int ssexec_stop(int argc, char const *const *argv, ssexec_t *info)
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "services selection is not available -- did you start it first?") ;
 
+    graph_visit_alloc(&graph, &list, &visit) ;
+
     for (; pos < argc ; pos++) {
 
         /** The service may not be supervised, so it will be ignored by the
@@ -110,40 +111,20 @@ int ssexec_stop(int argc, char const *const *argv, ssexec_t *info)
     if (!nservice)
         log_dieu(LOG_EXIT_USER, "find service: ", argv[0], " -- not currently in use") ;
 
-    char *sig[siglen] ;
-    if (siglen > 3) {
-
-        sig[0] = "-P" ;
-        sig[1] = "-wD" ;
-        sig[2] = "-d" ;
-        sig[3] = 0 ;
-
-    } else {
-
-        sig[0] = "-wD" ;
-        sig[1] = "-d" ;
-        sig[2] = 0 ;
-    }
-
-    unsigned int flist[SS_MAX_SERVICE + 1], fvisit[SS_MAX_SERVICE + 1], fnservice = 0 ;
-    char const *nargv[(nservice * 2) + 1] ; // nservice * 2 -> at worse one logger per service
-    unsigned int nargc = 0 ;
+    unsigned int *flist = 0, fnservice = 0 ;
+    uint8_t *fvisit = 0 ;
 
     idx = 0 ;
-    memset(flist, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(fvisit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
+    graph_visit_alloc(&graph, &flist, &fvisit) ;
 
     for (pos = 0 ; pos < nservice ; pos++) {
 
         char *name = graph.data.s + genalloc_s(graph_hash_t, &graph.hash)[list[pos]].vertex ;
-        nargv[nargc++] = name ;
 
-        idx = graph_hash_vertex_get_id(&graph, name) ;
+        idx = graph_csr_get_id(&graph, name) ;
 
-        if (!fvisit[idx]) {
+        if (!bitarray_testandset(fvisit, idx))
             flist[fnservice++] = idx ;
-            fvisit[idx] = 1 ;
-        }
 
         struct resolve_hash_s *hash = hash_search(&hres, name) ;
         if (hash == NULL)
@@ -158,25 +139,32 @@ int ssexec_stop(int argc, char const *const *argv, ssexec_t *info)
                 if (hash == NULL)
                     continue ;
 
-                nargv[nargc++] = hash->res.sa.s + hash->res.name ;
-                idx = graph_hash_vertex_get_id(&graph, hash->res.sa.s + hash->res.name) ;
-                if (!fvisit[idx]) {
+                idx = graph_csr_get_id(&graph, hash->res.sa.s + hash->res.name) ;
+                if (!bitarray_testandset(fvisit, idx))
                     flist[fnservice++] = idx ;
-                    fvisit[idx] = 1 ;
-                }
             }
         }
     }
 
-    nargv[nargc] = 0 ;
+    /** The selection and its loggers are already computed,
+     * bring them down from here instead of re-executing 66 signal. */
+    svc_array_t array = SVC_ARRAY_ZERO ;
+
+    svc_init_array(&array, flist, fnservice, &graph, &hres, info, 1, flag) ;
+
+    e = svc_launch(array.apids, array.napid, 1, &graph, &hres, info, "-wD", 1, 0, "-d", FLAGS_ISSET(flag, STATE_FLAGS_TOPROPAGATE) ? 1 : 0) ;
 
-    e = svc_send_wait(nargv, nargc, sig, siglen, info) ;
+    svc_array_free(&array) ;
 
     if (FLAGS_ISSET(flag, STATE_FLAGS_TOUNSUPERVISE))
         svc_unsupervise(flist, fnservice, &graph, &hres, info) ;
 
+    free(list) ;
+    free(visit) ;
+    free(flist) ;
+    free(fvisit) ;
     hash_free(&hres) ;
-    graph_free_all(&graph) ;
+    graph_csr_free_all(&graph) ;
 
     return e ;
 }
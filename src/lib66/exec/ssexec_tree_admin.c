@@ -301,13 +301,13 @@ static void tree_parse_options_depends(graph_t *g, ssexec_t *info, char const *s
 
         if (!requiredby) {
 
-            if (!graph_vertex_add_with_edge(g, info->treename.s, name))
+            if (!graph_csr_edge_add(g, info->treename.s, name))
                 log_die(LOG_EXIT_SYS,"add edge: ", name, " to vertex: ", info->treename.s) ;
 
         } else if (r) {
             /** if TreeA is requiredby TreeB, we don't want to create TreeB.
              * We only manages it if it exist yet */
-            if (!graph_vertex_add_with_requiredby(g, info->treename.s, name))
+            if (!graph_csr_edge_add(g, name, info->treename.s))
                 log_die(LOG_EXIT_SYS,"add requiredby: ", name, " to: ", info->treename.s) ;
         }
     }
@@ -510,10 +510,10 @@ void tree_master_modify_contents(char const *base)
 {
     log_flow() ;
 
-    stralloc sa = STRALLOC_ZERO ;
+    stralloc sa = STRALLOC_ZERO, list = STRALLOC_ZERO ;
     resolve_tree_master_t mres = RESOLVE_TREE_MASTER_ZERO ;
     resolve_wrapper_t_ref wres = resolve_set_struct(DATA_TREE_MASTER, &mres) ;
-    size_t baselen = strlen(base) ;
+    size_t baselen = strlen(base), pos = 0 ;
     char solve[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + 1] ;
 
     char const *exclude[2] = { SS_MASTER + 1, 0 } ;
@@ -522,9 +522,16 @@ void tree_master_modify_contents(char const *base)
 
     auto_strings(solve, base, SS_SYSTEM, SS_RESOLVE) ;
 
-    if (!sastr_dir_get(&sa, solve, exclude, S_IFREG))
+    if (!sastr_dir_get(&list, solve, exclude, S_IFREG))
         log_dieu(LOG_EXIT_SYS, "get trees resolve files") ;
 
+    /** dot files are temporaries of resolve_write_cdb() */
+    FOREACH_SASTR(&list, pos)
+        if (list.s[pos] != '.' && !sastr_add_string(&sa, list.s + pos))
+            log_die_nomem("stralloc") ;
+
+    stralloc_free(&list) ;
+
     size_t ncontents = sa.len ? sastr_nelement(&sa) : 0 ;
 
     if (ncontents)
@@ -600,7 +607,7 @@ void tree_enable_disable_deps(graph_t *g,char const *base, char const *treename,
     size_t pos = 0, element = 0 ;
     stralloc sa = STRALLOC_ZERO ;
 
-    if (graph_matrix_get_edge_g_sa(&sa, g, treename, action ? 0 : 1, 0) < 0)
+    if (graph_csr_get_edge_sa(&sa, g, treename, action ? 0 : 1, 0) < 0)
         log_dieu(LOG_EXIT_SYS, "get ", action ? "dependencies" : "required by" ," of: ", treename) ;
 
     size_t len = sastr_nelement(&sa) ;
@@ -683,7 +690,7 @@ void tree_depends_requiredby(graph_t *g, char const *base, char const *treename,
 
     log_trace("manage ", !requiredby ? "dependencies" : "required by", " for tree: ", treename, "..." ) ;
 
-    if (graph_matrix_get_edge_g_sorted_sa(&sa, g, treename, requiredby, 0) < 0)
+    if (graph_csr_get_edge_sorted_sa(&sa, g, treename, requiredby, 0) < 0)
         log_dieu(LOG_EXIT_SYS,"get sorted ", requiredby ? "required by" : "dependency", " list of tree: ", treename) ;
 
     size_t vlen = sastr_nelement(&sa) ;
@@ -707,7 +714,7 @@ void tree_depends_requiredby(graph_t *g, char const *base, char const *treename,
 
                 if (!none) {
 
-                    if (!graph_edge_remove_g(g, treename, name))
+                    if (!(requiredby ? graph_csr_edge_remove(g, name, treename) : graph_csr_edge_remove(g, treename, name)))
                        log_dieu(LOG_EXIT_SYS,"remove edge: ", name, " from vertex: ", treename);
 
                 } else {
@@ -750,17 +757,14 @@ void tree_depends_requiredby(graph_t *g, char const *base, char const *treename,
 
     if (!none) {
 
-        graph_free_matrix(g) ;
-        graph_free_sort(g) ;
-
-        if (!graph_matrix_build(g))
+        int r = graph_csr_build(g) ;
+        if (r < 0)
             log_die(LOG_EXIT_SYS, "build the graph") ;
 
-        if (!graph_matrix_analyze_cycle(g))
+        if (!r) {
+            graph_csr_cycle(g, "tree", 0, 0) ;
             log_die(LOG_EXIT_SYS, "found cycle") ;
-
-        if (!graph_matrix_sort(g))
-            log_die(LOG_EXIT_SYS, "sort the graph") ;
+        }
 
     }
 
@@ -778,7 +782,7 @@ void tree_depends_requiredby_deps(graph_t *g, char const *base, char const *tree
     stralloc sa = STRALLOC_ZERO ;
     char solve[baselen + SS_SYSTEM_LEN + 1] ;
 
-    if (graph_matrix_get_edge_g_sorted_sa(&sa, g, treename, requiredby, 0) < 0)
+    if (graph_csr_get_edge_sorted_sa(&sa, g, treename, requiredby, 0) < 0)
         log_dieu(LOG_EXIT_SYS,"get sorted ", requiredby ? "required by" : "dependency", " list of tree: ", treename) ;
 
     size_t vlen = sastr_nelement(&sa) ;
@@ -904,10 +908,8 @@ static void tree_service_switch_contents(char const *base, char const *treesrc,
     log_flow() ;
 
     size_t pos = 0 ; ssize_t r = -1 ;
-    resolve_tree_t tres = RESOLVE_TREE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_TREE, &tres) ;
-    resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref swres = resolve_set_struct(DATA_SERVICE, &res) ;
+    resolve_txn_t txn = RESOLVE_TXN_ZERO ;
+    resolve_wrapper_t_ref swres = 0 ;
     stralloc sa = STRALLOC_ZERO ;
 
     if (!resolve_get_field_tosa_g(&sa, base, treesrc, DATA_TREE, E_RESOLVE_TREE_CONTENTS))
@@ -921,22 +923,25 @@ static void tree_service_switch_contents(char const *base, char const *treesrc,
          * for an unexisting service which can cause a stuck situation where
          * you cannot remove a tree for a corrupted list of service.*/
 
-        r = resolve_read_g(swres, base, sa.s + pos) ;
+        r = resolve_txn_get(&swres, &txn, DATA_SERVICE, base, sa.s + pos) ;
         if (r == -1)
             log_dieusys(LOG_EXIT_SYS, "get information of service: ", sa.s + pos, " -- please make a bug report") ;
 
         if (!r)
             continue ;
 
-        tree_service_add(treedst, sa.s + pos, info) ;
+        tree_service_add(&txn, treedst, sa.s + pos, info) ;
 
-        if (!resolve_modify_field_g(swres, base, sa.s + pos, E_RESOLVE_SERVICE_TREENAME, treedst))
+        if (!resolve_txn_modify_field(&txn, DATA_SERVICE, base, sa.s + pos, E_RESOLVE_SERVICE_TREENAME, treedst))
             log_dieu(LOG_EXIT_SYS, "modify resolve file of: ", sa.s + pos) ;
     }
 
+    /** the destination tree and the services are written once */
+    if (!resolve_txn_commit(&txn))
+        log_dieu(LOG_EXIT_SYS, "write resolve files of tree: ", treedst) ;
+
+    resolve_txn_free(&txn) ;
     stralloc_free(&sa) ;
-    resolve_free(wres) ;
-    resolve_free(swres) ;
 }
 
 void tree_remove(graph_t *g, char const *base, char const *treename, ssexec_t *info)
@@ -1177,7 +1182,7 @@ int ssexec_tree_admin(int argc, char const *const *argv, ssexec_t *info)
 
         sa.len = 0 ;
         size_t pos = 0 ;
-        if (graph_matrix_get_edge_g_sorted_sa(&sa, &graph, info->treename.s, 0, 0) < 0)
+        if (graph_csr_get_edge_sorted_sa(&sa, &graph, info->treename.s, 0, 0) < 0)
             log_dieu(LOG_EXIT_SYS,"get sorted dependency list of tree: ", info->treename.s) ;
 
         if (tree_isenabled(info->base.s, info->treename.s)) {
@@ -1194,7 +1199,7 @@ int ssexec_tree_admin(int argc, char const *const *argv, ssexec_t *info)
 
         sa.len = 0 ;
         size_t pos = 0 ;
-        if (graph_matrix_get_edge_g_sorted_sa(&sa, &graph, info->treename.s, 1, 0) < 0)
+        if (graph_csr_get_edge_sorted_sa(&sa, &graph, info->treename.s, 1, 0) < 0)
             log_dieu(LOG_EXIT_SYS,"get sorted dependency list of tree: ", info->treename.s) ;
 
         if (!tree_isenabled(info->base.s, info->treename.s)) {
@@ -1227,7 +1232,7 @@ int ssexec_tree_admin(int argc, char const *const *argv, ssexec_t *info)
             log_die_nomem("stralloc") ;
 
         stralloc_free(&sa) ;
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         hash_free_tree(&htres) ;
 
     return 0 ;
@@ -14,6 +14,7 @@
 
 #include <string.h>
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/types.h>
@@ -23,6 +24,7 @@
 
 #include <skalibs/stralloc.h>
 #include <skalibs/sgetopt.h>
+#include <skalibs/bitarray.h>
 
 #include <66/constants.h>
 #include <66/config.h>
@@ -41,10 +43,9 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
     uint32_t flag = 0 ;
     graph_t graph = GRAPH_ZERO ;
     struct resolve_hash_s *hres = NULL ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1], nservice = 0, n = 0 ;
+    unsigned int *list = 0, *l = 0, nservice = 0, n = 0 ;
+    uint8_t *visit = 0 ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
     FLAGS_SET(flag, STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_WANTUP) ;
 
     if (earlier)
@@ -54,7 +55,7 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
 
     if (!graph.mlen && earlier) {
         hash_free(&hres) ;
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         log_warn("no earlier service to initiate") ;
         return ;
     }
@@ -62,6 +63,12 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "services selection is not available -- have you already parsed a service?") ;
 
+    graph_visit_alloc(&graph, &list, &visit) ;
+
+    l = (unsigned int *)calloc(graph.mlen + 1, sizeof(unsigned int)) ;
+    if (!l)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
     FOREACH_SASTR(sa, n) {
 
         struct resolve_hash_s *hash ;
@@ -75,18 +82,19 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
             log_die(LOG_EXIT_USER, "service: ", sa->s + n, " not available -- please execute \"66 parse ", sa->s + n,"\" command first") ;
         }
 
-        unsigned int l[graph.mlen], c = 0, pos = 0, idx = 0 ;
+        unsigned int pos = 0, idx = 0 ;
+        int c = 0 ;
 
-        idx = graph_hash_vertex_get_id(&graph, sa->s + n) ;
+        idx = graph_csr_get_id(&graph, sa->s + n) ;
 
-        if (!visit[idx]) {
+        if (!bitarray_peek(visit, idx)) {
 
             if (earlier) {
 
                 if (hash->res.earlier) {
 
                     list[nservice++] = idx ;
-                    visit[idx] = 1 ;
+                    bitarray_set(visit, idx) ;
                 }
 
             } else {
@@ -94,7 +102,7 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
                 if (hash->res.enabled) {
 
                     list[nservice++] = idx ;
-                    visit[idx] = 1 ;
+                    bitarray_set(visit, idx) ;
 
                 } else {
 
@@ -106,12 +114,14 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
         }
 
         /** find dependencies of the service from the graph, do it recursively */
-        c = graph_matrix_get_edge_g_list(l, &graph, sa->s + n, 0, 1) ;
+        c = graph_csr_get_edge_list(l, &graph, sa->s + n, 0, 1) ;
+        if (c < 0)
+            log_dieu(LOG_EXIT_SYS, "get dependency list of service: ", sa->s + n) ;
 
         /** append to the list to deal with */
-        for (; pos < c ; pos++) {
+        for (; pos < (unsigned int)c ; pos++) {
 
-            if (!visit[l[pos]]) {
+            if (!bitarray_peek(visit, l[pos])) {
 
                 char *name = graph.data.s + genalloc_s(graph_hash_t,&graph.hash)[l[pos]].vertex ;
 
@@ -125,7 +135,7 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
                     if (h->res.earlier) {
 
                         list[nservice++] = l[pos] ;
-                        visit[l[pos]] = 1 ;
+                        bitarray_set(visit, l[pos]) ;
                     }
 
                 } else {
@@ -133,7 +143,7 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
                     if (h->res.enabled) {
 
                         list[nservice++] = l[pos] ;
-                        visit[l[pos]] = 1 ;
+                        bitarray_set(visit, l[pos]) ;
 
                     }
                 }
@@ -143,8 +153,11 @@ static void doit(stralloc *sa, ssexec_t *info, uint8_t earlier)
 
     sanitize_init(list, nservice, &graph, &hres) ;
 
+    free(l) ;
+    free(list) ;
+    free(visit) ;
     hash_free(&hres) ;
-    graph_free_all(&graph) ;
+    graph_csr_free_all(&graph) ;
 }
 
 int ssexec_tree_init(int argc, char const *const *argv, ssexec_t *info)
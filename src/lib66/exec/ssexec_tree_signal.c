@@ -28,9 +28,11 @@
 #include <oblibs/files.h>
 #include <oblibs/graph.h>
 #include <oblibs/directory.h>
+#include <oblibs/stack.h>
 
 #include <skalibs/sgetopt.h>
 #include <skalibs/types.h>
+#include <skalibs/uint32.h>
 #include <skalibs/stralloc.h>
 #include <skalibs/djbunix.h>
 #include <skalibs/posixplz.h>
@@ -38,6 +40,8 @@
 #include <skalibs/selfpipe.h>
 #include <skalibs/sig.h>
 #include <skalibs/iopause.h>
+#include <skalibs/genalloc.h>
+#include <skalibs/bitarray.h>
 
 #include <66/ssexec.h>
 #include <66/constants.h>
@@ -46,6 +50,10 @@
 #include <66/utils.h>
 #include <66/graph.h>
 #include <66/state.h>
+#include <66/trace.h>
+#include <66/service.h>
+#include <66/sanitize.h>
+#include <66/hash.h>
 
 #include <s6/ftrigr.h>
 #include <s6/ftrigw.h>
@@ -60,6 +68,8 @@
 
 static unsigned int napid = 0 ;
 static unsigned int npid = 0 ;
+static unsigned int ntransition = 0 ;
+static unsigned int nnotification = 0 ;
 
 static uint8_t reloadmsg = 0 ;
 
@@ -72,11 +82,11 @@ struct pidtree_s
     unsigned int vertex ; // id at graph_hash_t struct
     uint8_t state ;
     int nedge ;
-    unsigned int edge[SS_MAX_SERVICE + 1] ; // array of id at graph_hash_t struct
+    unsigned int *edge ; // array of id at graph_hash_t struct
     int nnotif ;
-    /** id at graph_hash_t struct of depends/requiredby service
+    /** slot at apidt array of depends/requiredby tree
      * to notify when a tree is started/stopped */
-    unsigned int notif[SS_MAX_SERVICE + 1] ;
+    unsigned int *notif ;
 } ;
 #define PIDTREE_ZERO { \
     .pipe[0] = -1, \
@@ -85,9 +95,9 @@ struct pidtree_s
     .vertex = -1, \
     .state = 0, \
     .nedge =  0, \
-    .edge = { 0 }, \
+    .edge = NULL, \
     .nnotif = 0, \
-    .notif = { 0 } \
+    .notif = NULL \
 }
 
 typedef enum fifo_e fifo_t, *fifo_t_ref ;
@@ -202,49 +212,64 @@ static inline void kill_all(pidtree_t *apidt)
     while (j--) kill(apidt[j].pid, SIGKILL) ;
 }
 
-static pidtree_t pidtree_init(unsigned int len)
+/** the graph may return up to g->mlen edges for a vertex */
+static unsigned int *edges_ready(genalloc *edges, graph_t *g)
 {
-    log_flow() ;
-
-    pidtree_t pids = PIDTREE_ZERO ;
-
-    if (len > SS_MAX_SERVICE)
-        log_die(LOG_EXIT_SYS, "too many trees") ;
-
-    graph_array_init_single(pids.edge, len) ;
+    if (!genalloc_readyplus(unsigned int, edges, g->mlen))
+        log_die_nomem("genalloc") ;
 
-    return pids ;
+    return genalloc_s(unsigned int, edges) + genalloc_len(unsigned int, edges) ;
 }
 
 static void notify(pidtree_t *apidt, unsigned int pos, char const *sig, unsigned int what)
 {
     log_flow() ;
 
-    unsigned int i = 0, idx = 0 ;
-    char fmt[UINT_FMT] ;
+    int i = 0 ;
+    unsigned int idx = 0 ;
+    char s[SVC_NOTIF_SIZE] ;
     uint8_t flag = what ? FLAGS_DOWN : FLAGS_UP ;
 
+    uint32_pack_big(s, (uint32_t)pos) ;
+    s[4] = *sig ;
+
+    /** notif contains the slot at apidt of the dependents part of
+     * the selection, see pidtree_init_array() */
     for (; i < apidt[pos].nnotif ; i++) {
 
-        for (idx = 0 ; idx < napid ; idx++) {
+        idx = apidt[pos].notif[i] ;
 
-            if (apidt[pos].notif[i] == apidt[idx].vertex && !FLAGS_ISSET(apidt[idx].state, flag))  {
+        if (FLAGS_ISSET(apidt[idx].state, flag))
+            continue ;
 
-                size_t nlen = uint_fmt(fmt, pos) ;
-                fmt[nlen] = 0 ;
-                size_t len = nlen + 1 + 2 ;
-                char s[len + 1] ;
-                auto_strings(s, fmt, ":", sig, "@") ;
+        nnotification++ ;
 
-                log_trace("sends notification ", sig, " to: ", apidt[idx].tres->sa.s + apidt[idx].tres->name, " from: ", apidt[pos].tres->sa.s + apidt[pos].tres->name) ;
+        log_trace("sends notification ", sig, " to: ", apidt[idx].tres->sa.s + apidt[idx].tres->name, " from: ", apidt[pos].tres->sa.s + apidt[pos].tres->name) ;
 
-                if (write(apidt[idx].pipe[1], s, strlen(s)) < 0)
-                    log_dieusys(LOG_EXIT_SYS, "send notif to: ", apidt[idx].tres->sa.s + apidt[idx].tres->name) ;
-            }
-        }
+        if (write(apidt[idx].pipe[1], s, SVC_NOTIF_SIZE) < 0)
+            log_dieusys(LOG_EXIT_SYS, "send notif to: ", apidt[idx].tres->sa.s + apidt[idx].tres->name) ;
     }
 }
 
+static void trace_tree(pidtree_t *apidt, unsigned int pos, uint8_t event, unsigned int what, char const *by, unsigned int exitcode)
+{
+    char const *treename = apidt[pos].tres->sa.s + apidt[pos].tres->name ;
+
+    trace_write(TRACE_KIND_TREE, event, what, treename, treename, by, exitcode) ;
+}
+
+/** expose the amount of work made by the transaction */
+static void trace_transitions(void)
+{
+    char t[UINT_FMT], n[UINT_FMT], a[UINT_FMT] ;
+
+    t[uint_fmt(t, ntransition)] = 0 ;
+    n[uint_fmt(n, nnotification)] = 0 ;
+    a[uint_fmt(a, napid)] = 0 ;
+
+    log_trace("transaction of ", a, " trees: ", t, " transitions, ", n, " notifications") ;
+}
+
 /**
  * @what: up or down
  * @success: 0 fail, 1 win
@@ -258,12 +283,16 @@ static void announce(unsigned int pos, pidtree_t *apidt, char const *base, unsig
 
     uint8_t flag = what ? FLAGS_DOWN : FLAGS_UP ;
 
+    ntransition++ ;
+
     if (success) {
 
         fmt[uint_fmt(fmt, exitcode)] = 0 ;
 
         log_1_warnu(reloadmsg == 0 ? "start" : reloadmsg > 1 ? "unsupervise" : what == 0 ? "start" : "stop", " tree: ", treename, " -- exited with signal: ", fmt) ;
 
+        trace_tree(apidt, pos, TRACE_EVENT_FAIL, what, 0, exitcode) ;
+
         notify(apidt, pos, "F", what) ;
 
         FLAGS_SET(apidt[pos].state, FLAGS_BLOCK|FLAGS_FATAL) ;
@@ -272,6 +301,8 @@ static void announce(unsigned int pos, pidtree_t *apidt, char const *base, unsig
 
         log_info("Successfully ", reloadmsg == 0 ? "started" : reloadmsg > 1 ? "unsupervised" : what == 0 ? "started" : "stopped", " tree: ", treename) ;
 
+        trace_tree(apidt, pos, TRACE_EVENT_DONE, what, 0, 0) ;
+
         notify(apidt, pos, what ? "D" : "U", what) ;
 
         FLAGS_CLEAR(apidt[pos].state, FLAGS_BLOCK) ;
@@ -281,15 +312,24 @@ static void announce(unsigned int pos, pidtree_t *apidt, char const *base, unsig
 
 }
 
-static void pidtree_init_array(unsigned int *list, unsigned int listlen, pidtree_t *apidt, graph_t *g, struct resolve_hash_tree_s **htres, ssexec_t *info, uint8_t requiredby, uint8_t what)
+static void pidtree_init_array(unsigned int *list, unsigned int listlen, pidtree_t *apidt, genalloc *edges, graph_t *g, struct resolve_hash_tree_s **htres, ssexec_t *info, uint8_t requiredby, uint8_t what)
 {
     log_flow() ;
 
-    unsigned int pos = 0 ;
+    int r = 0 ;
+    unsigned int pos = 0, i = 0, *e = 0 ;
+    /** graph vertex -> apidt slot + 1, 0 if not part of the selection */
+    unsigned int *vslot = (unsigned int *)calloc(g->mlen + 1, sizeof(unsigned int)) ;
+
+    if (!vslot)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+    for (; pos < listlen ; pos++)
+        vslot[list[pos]] = pos + 1 ;
 
-    for (; pos < listlen ; pos++) {
+    for (pos = 0 ; pos < listlen ; pos++) {
 
-        pidtree_t pids = pidtree_init(g->mlen) ;
+        pidtree_t pids = PIDTREE_ZERO ;
 
         char *name = g->data.s + genalloc_s(graph_hash_t,&g->hash)[list[pos]].vertex ;
 
@@ -299,17 +339,33 @@ static void pidtree_init_array(unsigned int *list, unsigned int listlen, pidtree
 
         pids.tres = &hash->tres ;
 
-        pids.nedge = graph_matrix_get_edge_g_sorted_list(pids.edge, g, name, requiredby, 1) ;
+        e = edges_ready(edges, g) ;
+
+        pids.nedge = graph_csr_get_edge_sorted_list(e, g, name, requiredby, 1) ;
 
         if (pids.nedge < 0)
             log_dieu(LOG_EXIT_SYS,"get sorted ", requiredby ? "required by" : "dependency", " list of tree: ", name) ;
 
-        pids.nnotif = graph_matrix_get_edge_g_sorted_list(pids.notif, g, name, !requiredby, 1) ;
+        edges->len += pids.nedge * sizeof(unsigned int) ;
+
+        e = edges_ready(edges, g) ;
+
+        pids.nnotif = graph_csr_get_edge_sorted_list(e, g, name, !requiredby, 1) ;
 
         if (pids.nnotif < 0)
             log_dieu(LOG_EXIT_SYS,"get sorted ", !requiredby ? "required by" : "dependency", " list of tree: ", name) ;
 
-        pids.vertex = graph_hash_vertex_get_id(g, name) ;
+        /** keep only the trees part of the selection and
+         * store their slot at apidt instead of their vertex */
+        for (i = 0, r = 0 ; i < pids.nnotif ; i++)
+            if (vslot[e[i]])
+                e[r++] = vslot[e[i]] - 1 ;
+
+        pids.nnotif = r ;
+
+        edges->len += pids.nnotif * sizeof(unsigned int) ;
+
+        pids.vertex = graph_csr_get_id(g, name) ;
 
         if (pids.vertex < 0)
             log_dieu(LOG_EXIT_SYS, "get vertex id -- please make a bug report") ;
@@ -321,6 +377,19 @@ static void pidtree_init_array(unsigned int *list, unsigned int listlen, pidtree
 
         apidt[pos] = pids ;
     }
+
+    free(vslot) ;
+
+    /** the edges buffer do not move anymore */
+    e = genalloc_s(unsigned int, edges) ;
+
+    for (pos = 0 ; pos < listlen ; pos++) {
+
+        apidt[pos].edge = e ;
+        e += apidt[pos].nedge ;
+        apidt[pos].notif = e ;
+        e += apidt[pos].nnotif ;
+    }
 }
 
 static int handle_signal(pidtree_t *apidt, unsigned int what, graph_t *graph, ssexec_t *info)
@@ -412,39 +481,66 @@ static int ssexec_callback(stralloc *sa, ssexec_t *info, unsigned int what)
 
     int r, e = 1 ;
     size_t pos = 0, len = sa->len ;
-    ss_state_t ste = STATE_ZERO ;
-    resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    unsigned int n = 0, nres = sastr_nelement(sa) ;
+    /** a tree can hold many services, keep them off the stack */
+    resolve_service_t *ares = (resolve_service_t *)malloc((nres + 1) * sizeof(resolve_service_t)) ;
+    resolve_service_t **pres = (resolve_service_t **)malloc((nres + 1) * sizeof(resolve_service_t *)) ;
+    ss_state_t *ste = (ss_state_t *)malloc((nres + 1) * sizeof(ss_state_t)) ;
+    uint8_t *found = (uint8_t *)malloc((nres + 1) * sizeof(uint8_t)) ;
     char t[len + 1] ;
 
+    if (!ares || !pres || !ste || !found)
+        log_die_nomem("allocate memory") ;
+
     sastr_to_char(t, sa) ;
 
     sa->len = 0 ;
 
-    /** only deal with enabled service at up time and
-     * supervised service at down time */
     for (; pos < len ; pos += strlen(t + pos) + 1) {
 
         char *name = t + pos ;
+        ares[n] = service_resolve_zero ;
+        resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &ares[n]) ;
 
         r = resolve_read_g(wres, info->base.s, name) ;
+        free(wres) ;
         if (r == -1)
             log_dieu(LOG_EXIT_SYS, "read resolve file of: ", name) ;
         if (!r)
             log_dieu(LOG_EXIT_SYS, "read resolve file of: ", name, " -- please make a bug report") ;
 
-        if (!state_read(&ste, &res))
+        pres[n] = &ares[n] ;
+        n++ ;
+    }
+
+    /** the state of the tree contents in one pass */
+    if (what && state_read_array(ste, found, pres, n) < 0)
+        log_dieu(LOG_EXIT_SYS, "read state of the services of the tree") ;
+
+    /** only deal with enabled service at up time and
+     * supervised service at down time */
+    for (pos = 0 ; pos < n ; pos++) {
+
+        char *name = ares[pos].sa.s + ares[pos].name ;
+
+        if (what && !found[pos])
             log_dieu(LOG_EXIT_SYS, "read state file of: ", name, " -- please make a bug report") ;
 
-        if (!what ? res.enabled : ste.issupervised == STATE_FLAGS_TRUE && !res.earlier) {
+        if (!what ? ares[pos].enabled : ste[pos].issupervised == STATE_FLAGS_TRUE && !ares[pos].earlier) {
 
-            if (get_rstrlen_until(name, SS_LOG_SUFFIX) < 0 && !res.inns)
+            if (get_rstrlen_until(name, SS_LOG_SUFFIX) < 0 && !ares[pos].inns)
                 if (!sastr_add_string(sa, name))
                     log_dieu(LOG_EXIT_SYS, "add string") ;
         }
     }
 
-    resolve_free(wres) ;
+    for (pos = 0 ; pos < n ; pos++)
+        stralloc_free(&ares[pos].sa) ;
+
+    free(ares) ;
+    free(pres) ;
+    free(ste) ;
+    free(found) ;
 
     if (!sa->len) {
         e = 0 ;
@@ -560,13 +656,16 @@ static int check_action(pidtree_t *apidt, unsigned int pos, unsigned int receive
 
 }
 
-static int async_deps(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned int i, unsigned int what, ssexec_t *info, graph_t *graph, tain *deadline)
+/** @last receives the tree which released @i */
+static int async_deps(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned int i, unsigned int what, ssexec_t *info, graph_t *graph, tain *deadline, unsigned int *last)
 {
     log_flow() ;
 
     int r ;
-    unsigned int pos = 0, id = 0, idx = 0 ;
-    char buf[(UINT_FMT*2)*SS_MAX_SERVICE + 1] ;
+    unsigned int pos = 0, n = apidt[i].nedge ;
+    size_t len = 0, idx = 0 ;
+    char buf[SVC_NOTIF_BUFSIZE] ;
+    char const *name = apidt[i].tres->sa.s + apidt[i].tres->name ;
 
     tain dead ;
     tain_now_set_stopwatch_g() ;
@@ -574,11 +673,6 @@ static int async_deps(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsi
 
     iopause_fd x = { .fd = apidt[i].pipe[0], .events = IOPAUSE_READ, 0 } ;
 
-    unsigned int n = apidt[i].nedge ;
-    unsigned int visit[n + 1] ;
-
-    memset(visit, 0, (n + 1) * sizeof (unsigned int));
-
     while (pos < n) {
 
         r = iopause_g(&x, 1, &dead) ;
@@ -588,74 +682,56 @@ static int async_deps(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsi
 
         if (!r) {
             errno = ETIMEDOUT ;
-            log_dieusys(LOG_EXIT_SYS,"time out", apidt[i].tres->sa.s + apidt[i].tres->name) ;
+            log_dieusys(LOG_EXIT_SYS,"time out", name) ;
         }
 
-        if (x.revents & IOPAUSE_READ) {
-
-            memset(buf, 0, ((UINT_FMT*2)*SS_MAX_SERVICE + 1) * sizeof(char)) ;
-            r = read(apidt[i].pipe[0], buf, sizeof(buf)) ;
-            if (r < 0)
-                log_dieu(LOG_EXIT_SYS, "read from pipe") ;
-            buf[r] = 0 ;
-
-            idx = 0 ;
-
-            while (r != -1) {
-                /** The buf might contain multiple signal coming
-                 * from the dependencies if they finished before
-                 * the start of this read process. Check every
-                 * signal received.*/
-                r = get_len_until(buf + idx, '@') ;
-
-                if (r < 0)
-                    /* no more signal */
-                    goto next ;
+        if (!(x.revents & IOPAUSE_READ))
+            continue ;
+
+        /** The pipe might contain multiple records coming from
+         * the dependencies if they finished before the start of
+         * this read process. Read them in bulk after the incomplete
+         * record left by the previous read, if any. */
+        r = read(apidt[i].pipe[0], buf + len, sizeof(buf) - len) ;
+        if (r < 0) {
+            if (errno == EINTR)
+                continue ;
+            log_dieusys(LOG_EXIT_SYS, "read from pipe") ;
+        }
 
-                char line[r + 1] ;
-                memcpy(line, buf + idx, r) ;
-                line[r] = 0 ;
+        if (!r)
+            log_die(LOG_EXIT_SYS, "notification pipe of: ", name, " closed -- please make a bug report") ;
 
-                idx += r + 1 ;
+        len += r ;
 
-                /**
-                 * the received string have the format:
-                 *      apids_array_id:signal_receive
-                 *
-                 * typically:
-                 *      - 10:D
-                 *      - 30:u
-                 *      - ...
-                 *
-                 * Split it and check the signal receive.*/
-                int sep = get_len_until(line, ':') ;
-                if (sep < 0)
-                    log_die(LOG_EXIT_SYS, "received bad signal format -- please make a bug report") ;
+        for (idx = 0 ; idx + SVC_NOTIF_SIZE <= len && pos < n ; idx += SVC_NOTIF_SIZE) {
 
-                unsigned int c = line[sep + 1] ;
-                char pc[2] = { c, 0 } ;
-                line[sep] = 0 ;
+            uint32_t id = 0 ;
+            unsigned char c = (unsigned char)buf[idx + 4] ;
+            char pc[2] = { (char)c, 0 } ;
 
-                if (!uint0_scan(line, &id))
-                    log_dieusys(LOG_EXIT_SYS, "retrieve service number -- please make a bug report") ;
+            uint32_unpack_big(buf + idx, &id) ;
 
-                log_trace(apidt[i].tres->sa.s + apidt[i].tres->name, " acknowledges: ", pc, " from: ", apidt[id].tres->sa.s + apidt[id].tres->name) ;
+            if (id >= napid || c > 127)
+                log_die(LOG_EXIT_SYS, "received bad notification -- please make a bug report") ;
 
-                if (!visit[pos]) {
+            log_trace(name, " acknowledges: ", pc, " from: ", apidt[id].tres->sa.s + apidt[id].tres->name) ;
 
-                    id = check_action(apidt, id, c, what) ;
-                    if (id < 0)
-                        log_die(LOG_EXIT_SYS, "tree dependency: ", apidt[id].tres->sa.s + apidt[id].tres->name, " of: ", apidt[id].tres->sa.s + apidt[id].tres->name," crashed") ;
+            r = check_action(apidt, id, c, what) ;
+            if (r < 0)
+                log_die(LOG_EXIT_SYS, "tree dependency: ", apidt[id].tres->sa.s + apidt[id].tres->name, " of: ", name," crashed") ;
 
-                    if (!id)
-                        continue ;
+            if (!r)
+                continue ;
 
-                    visit[pos++]++ ;
-                }
-            }
+            *last = id ;
+            pos++ ;
         }
-        next:
 
+        /** keep the incomplete record for the next read */
+        len -= idx ;
+        if (len)
+            memmove(buf, buf + idx, len) ;
     }
 
     return 1 ;
@@ -680,10 +756,15 @@ static int async(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned
 
             FLAGS_SET(apidt[i].state, FLAGS_BLOCK) ;
 
+            unsigned int last = napid ;
+
             if (apidt[i].nedge)
-                if (!async_deps(htres, apidt, i, what, info, graph, deadline))
+                if (!async_deps(htres, apidt, i, what, info, graph, deadline, &last))
                     log_warnu_return(LOG_EXIT_ZERO, !what ? "start" : "stop", " dependencies of tree: ", name) ;
 
+            trace_tree(apidt, i, TRACE_EVENT_READY, what, last < napid ? apidt[last].tres->sa.s + apidt[last].tres->name : 0, 0) ;
+            trace_tree(apidt, i, TRACE_EVENT_SENT, what, 0, 0) ;
+
             e = doit(name, info, what, deadline) ;
 
         } else {
@@ -711,12 +792,15 @@ static int waitit(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned
     unsigned int e = 0, pos = 0 ;
     int r ;
     pid_t pid ;
-    pidtree_t apidtreetable[napid] ;
-    pidtree_t_ref apidtree = apidtreetable ;
 
     tain_now_set_stopwatch_g() ;
     tain_add_g(deadline, deadline) ;
 
+    trace_open(info->live.s, info->ownerstr) ;
+
+    for (; pos < napid ; pos++)
+        trace_tree(apidt, pos, TRACE_EVENT_QUEUED, what, 0, 0) ;
+
     int spfd = selfpipe_init() ;
 
     if (spfd < 0)
@@ -731,15 +815,10 @@ static int waitit(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned
 
     iopause_fd x = { .fd = spfd, .events = IOPAUSE_READ, .revents = 0 } ;
 
-    for (; pos < napid ; pos++) {
-
-        apidtree[pos] = apidt[pos] ;
-
-        if (pipe(apidtree[pos].pipe) < 0)
+    for (pos = 0 ; pos < napid ; pos++)
+        if (pipe(apidt[pos].pipe) < 0)
             log_dieusys(LOG_EXIT_SYS, "pipe");
 
-    }
-
     for (pos = 0 ; pos < napid ; pos++) {
 
         pid = fork() ;
@@ -751,16 +830,16 @@ static int waitit(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned
 
             selfpipe_finish() ;
 
-            close(apidtree[pos].pipe[1]) ;
+            close(apidt[pos].pipe[1]) ;
 
-            e = async(htres, apidtree, pos, what, info, graph, deadline) ;
+            e = async(htres, apidt, pos, what, info, graph, deadline) ;
 
             goto end ;
         }
 
-        apidtree[pos].pid = pid ;
+        apidt[pos].pid = pid ;
 
-        close(apidtree[pos].pipe[0]) ;
+        close(apidt[pos].pipe[0]) ;
 
         npid++ ;
     }
@@ -778,18 +857,20 @@ static int waitit(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned
         }
 
         if (x.revents & IOPAUSE_READ) {
-            e = handle_signal(apidtree, what, graph, info) ;
+            e = handle_signal(apidt, what, graph, info) ;
 
             if (e)
                 break ;
         }
     }
 
+    trace_transitions() ;
+
     selfpipe_finish() ;
 
     for (pos = 0 ; pos < napid ; pos++) {
-        close(apidtree[pos].pipe[1]) ;
-        close(apidtree[pos].pipe[0]) ;
+        close(apidt[pos].pipe[1]) ;
+        close(apidt[pos].pipe[0]) ;
     }
 
 
@@ -797,49 +878,352 @@ static int waitit(struct resolve_hash_tree_s **htres, pidtree_t *apidt, unsigned
         return e ;
 }
 
-static void compute_visit_tree(char const *treename, unsigned int *visit, unsigned int *list, graph_t *graph, unsigned int *ntree, uint8_t requiredby)
+static resolve_tree_t *merged_tree(struct resolve_hash_tree_s **htres, graph_t *tgraph, unsigned int vertex)
+{
+    char *treename = tgraph->data.s + genalloc_s(graph_hash_t,&tgraph->hash)[vertex].vertex ;
+
+    struct resolve_hash_tree_s *hash = hash_search_tree(htres, treename) ;
+    if (hash == NULL)
+        log_dieu(LOG_EXIT_SYS,"find hash id of: ", treename, " -- please make a bug report") ;
+
+    return &hash->tres ;
+}
+
+/** read the resolve file of every service of every allowed tree
+ * of the selection. Each file is read once, dependencies included */
+static void merged_collect(graph_t *graph, struct resolve_hash_s **hres, struct resolve_hash_tree_s **htres, graph_t *tgraph, unsigned int *tlist, unsigned int ntree, uint8_t *allowed, ssexec_t *info, uint32_t flag)
 {
     log_flow() ;
 
-    unsigned int l[graph->mlen], c = 0, pos = 0, idx = 0 ;
+    unsigned int pos = 0 ;
 
-    idx = graph_hash_vertex_get_id(graph, treename) ;
+    for (; pos < ntree ; pos++) {
 
-    if (!visit[idx]) {
-        /** avoid double entry */
-        list[(*ntree)++] = idx ;
-        visit[idx] = 1 ;
+        if (!allowed[pos])
+            continue ;
+
+        resolve_tree_t *tres = merged_tree(htres, tgraph, tlist[pos]) ;
+        size_t len = strlen(tres->sa.s + tres->contents) ;
+        _alloc_stk_(stk, len + 1) ;
+
+        if (!stack_string_clean(&stk, tres->sa.s + tres->contents))
+            log_dieusys(LOG_EXIT_SYS, "clean string") ;
+
+        service_graph_collect_list(graph, stk.s, stk.len, hres, info, flag) ;
+    }
+}
+
+/** keep the same services as ssexec_callback() does: enabled service
+ * at up time and supervised service at down time, without loggers and
+ * services inside module. @sel receives the selection of each tree.
+ *
+ * Return the number of services which was reparsed */
+static unsigned int merged_select(stralloc *sel, struct resolve_hash_s **hres, struct resolve_hash_tree_s **htres, graph_t *tgraph, unsigned int *tlist, unsigned int ntree, uint8_t *allowed, unsigned int what, ssexec_t *info, uint8_t reparse)
+{
+    log_flow() ;
+
+    unsigned int pos = 0, nparse = 0, n = 0, i = 0 ;
+    size_t spos = 0 ;
+
+    for (; pos < ntree ; pos++) {
+
+        sel[pos].len = 0 ;
+
+        if (!allowed[pos])
+            continue ;
+
+        resolve_tree_t *tres = merged_tree(htres, tgraph, tlist[pos]) ;
+        size_t len = strlen(tres->sa.s + tres->contents) ;
+        _alloc_stk_(stk, len + 1) ;
+
+        if (!stack_string_clean(&stk, tres->sa.s + tres->contents))
+            log_dieusys(LOG_EXIT_SYS, "clean string") ;
+
+        unsigned int nelement = stack_count_element(&stk) ;
+        resolve_service_t *res[nelement + 1] ;
+        ss_state_t ste[nelement + 1] ;
+        uint8_t found[nelement + 1] ;
+
+        n = 0 ;
+
+        FOREACH_STK(&stk, spos) {
+
+            struct resolve_hash_s *hash = hash_search(hres, stk.s + spos) ;
+            if (hash == NULL)
+                continue ;
+
+            res[n++] = &hash->res ;
+        }
+
+        /** the state of the whole tree in one pass */
+        if (state_read_array(ste, found, res, n) < 0)
+            log_dieu(LOG_EXIT_SYS, "read state of services of tree: ", tres->sa.s + tres->name) ;
+
+        for (i = 0 ; i < n ; i++) {
+
+            char *name = res[i]->sa.s + res[i]->name ;
+
+            if (!found[i])
+                log_dieu(LOG_EXIT_SYS, "read state file of: ", name, " -- please make a bug report") ;
+
+            if (!(!what ? res[i]->enabled : ste[i].issupervised == STATE_FLAGS_TRUE && !res[i]->earlier))
+                continue ;
+
+            if (get_rstrlen_until(name, SS_LOG_SUFFIX) >= 0 || res[i]->inns)
+                continue ;
+
+            if (!what && reparse && ste[i].toparse == STATE_FLAGS_TRUE) {
+
+                info->treename.len = 0 ;
+                if (!auto_stra(&info->treename, tres->sa.s + tres->name))
+                    log_die_nomem("stralloc") ;
+
+                sanitize_source(name, info, STATE_FLAGS_TOPARSE) ;
+                nparse++ ;
+            }
 
+            if (!sastr_add_string(&sel[pos], name))
+                log_dieu(LOG_EXIT_SYS, "add string") ;
+        }
+    }
+
+    return nparse ;
+}
+
+/** a dependency between two trees goes through a barrier vertex
+ * named after the dependent tree: the barrier depends on each service
+ * of the trees it depends on and each service of the dependent tree
+ * depends on the barrier, see SVC_BARRIER. The edges always follow the
+ * depends direction, the reverse order at down time is made by the
+ * requiredby lookup */
+static void merged_edges(graph_t *graph, stralloc *sel, struct resolve_hash_tree_s **htres, graph_t *tgraph, unsigned int *tlist, unsigned int ntree)
+{
+    log_flow() ;
+
+    unsigned int pos = 0, q = 0, nbarrier = 0 ;
+    size_t dpos = 0, spos = 0 ;
+
+    for (; pos < ntree ; pos++) {
+
+        resolve_tree_t *tres = merged_tree(htres, tgraph, tlist[pos]) ;
+        char *treename = tres->sa.s + tres->name ;
+
+        if (!sel[pos].len || !tres->ndepends)
+            continue ;
+
+        size_t len = strlen(tres->sa.s + tres->depends) ;
+        char barrier[1 + strlen(treename) + 1] ;
+        _alloc_stk_(stk, len + 1) ;
+
+        barrier[0] = SVC_BARRIER ;
+        auto_strings(barrier + 1, treename) ;
+
+        if (!stack_string_clean(&stk, tres->sa.s + tres->depends))
+            log_dieusys(LOG_EXIT_SYS, "clean string") ;
+
+        nbarrier = 0 ;
+
+        FOREACH_STK(&stk, dpos) {
+
+            char *depends = stk.s + dpos ;
+
+            for (q = 0 ; q < ntree ; q++)
+                if (!strcmp(depends, tgraph->data.s + genalloc_s(graph_hash_t,&tgraph->hash)[tlist[q]].vertex))
+                    break ;
+
+            /** not part of the selection or nothing to wait for */
+            if (q == ntree || !sel[q].len)
+                continue ;
+
+            FOREACH_SASTR(&sel[q], spos)
+                if (!graph_csr_edge_add(graph, barrier, sel[q].s + spos))
+                    log_dieu(LOG_EXIT_SYS, "add dependencies of tree: ", treename) ;
+
+            nbarrier++ ;
+        }
+
+        if (!nbarrier)
+            continue ;
+
+        FOREACH_SASTR(&sel[pos], spos)
+            if (!graph_csr_edge_add(graph, sel[pos].s + spos, barrier))
+                log_dieu(LOG_EXIT_SYS, "add dependencies of service: ", sel[pos].s + spos) ;
+    }
+}
+
+/** merge every tree of the selection into one service graph and
+ * bring it up/down with a single svc_launch() transaction. Services
+ * of different trees only wait for each other when their trees do */
+static int merged(struct resolve_hash_tree_s **htres, graph_t *tgraph, unsigned int *tlist, unsigned int ntree, unsigned int what, ssexec_t *sinfo)
+{
+    log_flow() ;
+
+    int e = 0 ;
+    unsigned int pos = 0, nservice = 0, *list = 0 ;
+    uint8_t *visit = 0, requiredby = what ? 1 : 0, allowed[ntree] ;
+    uint32_t flag = STATE_FLAGS_TOPROPAGATE ;
+    size_t spos = 0 ;
+    graph_t graph = GRAPH_ZERO ;
+    struct resolve_hash_s *hres = NULL ;
+    ssexec_t info = SSEXEC_ZERO ;
+    stralloc sel[ntree] ;
+
+    ssexec_copy(&info, sinfo) ;
+    info.opt_tree = 1 ;
+
+    if (what)
+        FLAGS_SET(flag, STATE_FLAGS_ISSUPERVISED|STATE_FLAGS_WANTDOWN) ;
+    else
+        FLAGS_SET(flag, STATE_FLAGS_WANTUP) ;
+
+    for (; pos < ntree ; pos++) {
+
+        resolve_tree_t *tres = merged_tree(htres, tgraph, tlist[pos]) ;
+        char *treename = tres->sa.s + tres->name ;
+
+        sel[pos] = stralloc_zero ;
+        allowed[pos] = 0 ;
+
+        if (!tree_get_permissions(info.base.s, treename)) {
+            log_warn("You're not allowed to use the tree: ", treename, " -- ignoring it") ;
+            continue ;
+        }
+
+        if (!tres->ncontents) {
+            log_info("Empty tree: ", treename, " -- nothing to do") ;
+            continue ;
+        }
+
+        allowed[pos] = 1 ;
     }
 
+    merged_collect(&graph, &hres, htres, tgraph, tlist, ntree, allowed, &info, flag) ;
+
+    if (merged_select(sel, &hres, htres, tgraph, tlist, ntree, allowed, what, &info, 1)) {
+
+        /** the frontend of some services was parsed again,
+         * read the resolve files of the new state */
+        hash_free(&hres) ;
+        merged_collect(&graph, &hres, htres, tgraph, tlist, ntree, allowed, &info, flag) ;
+        merged_select(sel, &hres, htres, tgraph, tlist, ntree, allowed, what, &info, 0) ;
+    }
+
+    merged_edges(&graph, sel, htres, tgraph, tlist, ntree) ;
+
+    if (!HASH_COUNT(hres))
+        goto end ;
+
+    service_graph_compute(&graph, &hres, flag) ;
+
+    graph_visit_alloc(&graph, &list, &visit) ;
+
+    for (pos = 0 ; pos < ntree ; pos++) {
+
+        FOREACH_SASTR(&sel[pos], spos) {
+
+            struct resolve_hash_s *hash = hash_search(&hres, sel[pos].s + spos) ;
+            if (hash == NULL)
+                log_dieu(LOG_EXIT_SYS, "find hash id of: ", sel[pos].s + spos, " -- please make a bug report") ;
+
+            graph_compute_visit(*hash, visit, list, &graph, &nservice, requiredby) ;
+        }
+    }
+
+    if (!nservice)
+        goto end ;
+
+    if (!what) {
+
+        /** the barriers have nothing to sanitize */
+        unsigned int slist[nservice], nslist = 0 ;
+
+        for (pos = 0 ; pos < nservice ; pos++)
+            if (!SVC_ISBARRIER(graph.data.s + genalloc_s(graph_hash_t,&graph.hash)[list[pos]].vertex))
+                slist[nslist++] = list[pos] ;
+
+        if (nslist)
+            sanitize_init(slist, nslist, &graph, &hres) ;
+    }
+
+    {
+        svc_array_t array = SVC_ARRAY_ZERO ;
+
+        svc_init_array(&array, list, nservice, &graph, &hres, &info, requiredby, flag) ;
+
+        e = svc_launch(array.apids, array.napid, what, &graph, &hres, &info, what ? "-wD" : "-wU", 1, 0, what ? "-d" : "-u", 1) ;
+
+        svc_array_free(&array) ;
+    }
+
+    if (!e) {
+
+        for (pos = 0 ; pos < ntree ; pos++) {
+
+            if (!allowed[pos])
+                continue ;
+
+            resolve_tree_t *tres = merged_tree(htres, tgraph, tlist[pos]) ;
+            log_info("Successfully ", what ? "stopped" : "started", " tree: ", tres->sa.s + tres->name) ;
+        }
+    }
+
+    end:
+        for (pos = 0 ; pos < ntree ; pos++)
+            stralloc_free(&sel[pos]) ;
+        free(list) ;
+        free(visit) ;
+        hash_free(&hres) ;
+        graph_csr_free_all(&graph) ;
+        ssexec_free(&info) ;
+        return e ;
+}
+
+static void compute_visit_tree(char const *treename, uint8_t *visit, unsigned int *list, graph_t *graph, unsigned int *ntree, uint8_t requiredby)
+{
+    log_flow() ;
+
+    unsigned int *l = 0, pos = 0, idx = 0 ;
+    int c = 0 ;
+
+    idx = graph_csr_get_id(graph, treename) ;
+
+    /** avoid double entry */
+    if (!bitarray_testandset(visit, idx))
+        list[(*ntree)++] = idx ;
+
+    l = (unsigned int *)calloc(graph->mlen + 1, sizeof(unsigned int)) ;
+    if (!l)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
     /** find dependencies of the tree from the graph, do it recursively */
-    c = graph_matrix_get_edge_g_sorted_list(l, graph, treename, requiredby, 1) ;
+    c = graph_csr_get_edge_sorted_list(l, graph, treename, requiredby, 1) ;
+    if (c < 0)
+        log_dieu(LOG_EXIT_SYS, "get ", requiredby ? "required by" : "dependency", " list of tree: ", treename) ;
 
     /** append to the list to deal with */
-    for (; pos < c ; pos++) {
-        if (!visit[l[pos]]) {
+    for (; pos < (unsigned int)c ; pos++)
+        if (!bitarray_testandset(visit, l[pos]))
             list[(*ntree)++] = l[pos] ;
-            visit[l[pos]] = 1 ;
-        }
-    }
+
+    free(l) ;
 }
 
 int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
 {
     log_flow() ;
 
-    int r, shut = 0, fd ;
+    int r, shut = 0, merge = 0, fd ;
     tain deadline ;
     uint8_t what = 0, requiredby = 0 ;
     stralloc sa = STRALLOC_ZERO ;
     size_t pos = 0 ;
     struct resolve_hash_tree_s *htres = NULL ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1] ;
+    unsigned int *list = 0 ;
+    uint8_t *visit = 0 ;
+    pidtree_t *apidt = 0 ;
+    genalloc edges = GENALLOC_ZERO ; // unsigned int
     graph_t graph = GRAPH_ZERO ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-
     {
         subgetopt l = SUBGETOPT_ZERO ;
 
@@ -850,6 +1234,7 @@ int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
 
             switch (opt) {
                 case 'f' :  shut = 1 ; break ;
+                case 'm' :  merge = 1 ; break ;
                 default :   log_usage(info->usage, "\n", info->help) ;
             }
         }
@@ -875,6 +1260,11 @@ int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
 
     reloadmsg = what ;
 
+    if (merge && what == 2) {
+        log_warn("merged transaction is not available with the free command -- ignoring it") ;
+        merge = 0 ;
+    }
+
     if (what)
         requiredby = 1 ;
 
@@ -886,7 +1276,9 @@ int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "trees selection is not created -- creates at least one tree") ;
 
-    if (!graph_matrix_sort_tosa(&sa, &graph))
+    graph_visit_alloc(&graph, &list, &visit) ;
+
+    if (!graph_csr_sort_tosa(&sa, &graph))
         log_dieu(LOG_EXIT_SYS, "get list of trees for graph -- please make a bug report") ;
 
     /** only one tree */
@@ -914,14 +1306,19 @@ int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
         }
     }
 
-    pidtree_t apidt[graph.mlen] ;
-
     if (!napid) {
         r = 0 ;
         goto end ;
     }
 
-    pidtree_init_array(list, napid, apidt, &graph, &htres, info, requiredby, what) ;
+    if (!merge) {
+
+        apidt = (pidtree_t *)malloc(napid * sizeof(pidtree_t)) ;
+        if (!apidt)
+            log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+        pidtree_init_array(list, napid, apidt, &edges, &graph, &htres, info, requiredby, what) ;
+    }
 
     if (shut) {
 
@@ -951,7 +1348,10 @@ int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
         }
     }
 
-    r = waitit(&htres, apidt, what, &graph, &deadline, info) ;
+    if (merge)
+        r = merged(&htres, &graph, list, napid, what, info) ;
+    else
+        r = waitit(&htres, apidt, what, &graph, &deadline, info) ;
 
     end:
 
@@ -967,7 +1367,11 @@ int ssexec_tree_signal(int argc, char const *const *argv, ssexec_t *info)
             fd_close(fd) ;
         }
 
-        graph_free_all(&graph) ;
+        free(apidt) ;
+        free(list) ;
+        free(visit) ;
+        genalloc_free(unsigned int, &edges) ;
+        graph_csr_free_all(&graph) ;
         stralloc_free(&sa) ;
         hash_free_tree(&htres) ;
 
@@ -239,7 +239,7 @@ static void info_display_depends(char const *field, char const *treename)
 
     graph_build_tree(&graph, &htres, pinfo->base.s, E_RESOLVE_TREE_MASTER_CONTENTS) ;
 
-    r = graph_matrix_get_edge_g_sorted_sa(&sa, &graph, treename, 0, 0) ;
+    r = graph_csr_get_edge_sorted_sa(&sa, &graph, treename, 0, 0) ;
     if (r < 0)
         log_dieu(LOG_EXIT_SYS, "get the dependencies list") ;
 
@@ -283,7 +283,7 @@ static void info_display_depends(char const *field, char const *treename)
         }
 
     freed:
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         stralloc_free(&sa) ;
         hash_free_tree(&htres) ;
 }
@@ -301,7 +301,7 @@ static void info_display_requiredby(char const *field, char const *treename)
 
     graph_build_tree(&graph, &htres, pinfo->base.s, E_RESOLVE_TREE_MASTER_CONTENTS) ;
 
-    r = graph_matrix_get_edge_g_sorted_sa(&sa, &graph, treename, 1, 0) ;
+    r = graph_csr_get_edge_sorted_sa(&sa, &graph, treename, 1, 0) ;
     if (r < 0)
         log_dieu(LOG_EXIT_SYS, "get the dependencies list") ;
 
@@ -347,7 +347,7 @@ static void info_display_requiredby(char const *field, char const *treename)
         }
 
     freed:
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         stralloc_free(&sa) ;
         hash_free_tree(&htres) ;
 }
@@ -415,7 +415,7 @@ static void info_display_contents(char const *field, char const *treename)
         }
 
     freed:
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
         hash_free(&hres) ;
         stralloc_free(&sa) ;
 }
@@ -559,10 +559,10 @@ int ssexec_tree_status(int argc, char const *const *argv, ssexec_t *info)
 
         graph_build_tree(&graph, &htres, pinfo->base.s, E_RESOLVE_TREE_MASTER_CONTENTS) ;
 
-        if (!graph_matrix_sort_tosa(&sa, &graph))
+        if (!graph_csr_sort_tosa(&sa, &graph))
             log_dieu(LOG_EXIT_SYS, "get the sorted list of trees") ;
 
-        graph_free_all(&graph) ;
+        graph_csr_free_all(&graph) ;
 
         if (sa.len) {
 
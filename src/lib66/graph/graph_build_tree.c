@@ -31,6 +31,7 @@ void graph_build_tree(graph_t *g, struct resolve_hash_tree_s **htres, char const
 {
     log_flow() ;
 
+    int r ;
     size_t pos = 0 ;
     stralloc sa = STRALLOC_ZERO ;
 
@@ -50,7 +51,7 @@ void graph_build_tree(graph_t *g, struct resolve_hash_tree_s **htres, char const
             if (resolve_read_g(wres, base, name) <= 0)
                 log_dieu(LOG_EXIT_SYS, "read resolve file of: ", name) ;
 
-            if (!graph_vertex_add(g, name))
+            if (graph_csr_vertex_add(g, name) < 0)
                 log_dieu(LOG_EXIT_SYS, "add vertex of: ", name) ;
 
             if (tres.ndepends)
@@ -69,14 +70,14 @@ void graph_build_tree(graph_t *g, struct resolve_hash_tree_s **htres, char const
         }
     }
 
-    if (!graph_matrix_build(g))
+    r = graph_csr_build(g) ;
+    if (r < 0)
         log_dieu(LOG_EXIT_SYS, "build the graph") ;
 
-    if (!graph_matrix_analyze_cycle(g))
-        log_dieu(LOG_EXIT_SYS, "found cycle") ;
-
-    if (!graph_matrix_sort(g))
-        log_dieu(LOG_EXIT_SYS, "sort the graph") ;
+    if (!r) {
+        graph_csr_cycle(g, "tree", 0, 0) ;
+        log_die(LOG_EXIT_SYS, "found cycle") ;
+    }
 
     stralloc_free(&sa) ;
 }
@@ -20,29 +20,42 @@
 
 #include <skalibs/stralloc.h>
 
+#include <66/graph.h>
+
 int graph_compute_dependencies(graph_t *g, char const *vertex, char const *edge, uint8_t requiredby)
 {
     log_flow() ;
 
     stralloc sa = STRALLOC_ZERO ;
+    size_t pos = 0 ;
     int e = 0 ;
     if (!sastr_clean_string(&sa, edge)) {
         log_warnu("clean string") ;
         goto freed ;
     }
 
-    if (!requiredby) {
+    if (graph_csr_vertex_add(g, vertex) < 0) {
+        log_warnu("add vertex: ", vertex) ;
+        goto freed ;
+    }
+
+    FOREACH_SASTR(&sa, pos) {
 
-        if (!graph_vertex_add_with_nedge(g, vertex, &sa)) {
-            log_warnu("add edges at vertex: ", vertex) ;
-            goto freed ;
-        }
+        /** @vertex is required by each element of @edge,
+         * meaning that each one depends on @vertex */
+        if (!requiredby) {
+
+            if (!graph_csr_edge_add(g, vertex, sa.s + pos)) {
+                log_warnu("add edges at vertex: ", vertex) ;
+                goto freed ;
+            }
 
-    } else {
+        } else {
 
-        if (!graph_vertex_add_with_nrequiredby(g, vertex, &sa)) {
-            log_warnu("add requiredby at vertex: ", vertex) ;
-            goto freed ;
+            if (!graph_csr_edge_add(g, sa.s + pos, vertex)) {
+                log_warnu("add requiredby at vertex: ", vertex) ;
+                goto freed ;
+            }
         }
     }
     e = 1 ;
@@ -13,38 +13,57 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 
+#include <skalibs/bitarray.h>
+
 #include <66/graph.h>
 #include <66/service.h>
 #include <66/enum.h>
-#include <stdio.h>
-void graph_compute_visit(struct resolve_hash_s hash, unsigned int *visit, unsigned int *list, graph_t *graph, unsigned int *nservice, uint8_t requiredby)
+
+/** @list receives the vertex id of the selection in order of visit,
+ * @visit is a bitset of the vertex already part of the list.
+ * Both are sized from the graph and must be freed by the caller */
+void graph_visit_alloc(graph_t *graph, unsigned int **list, uint8_t **visit)
+{
+    log_flow() ;
+
+    *list = (unsigned int *)calloc(graph->mlen + 1, sizeof(unsigned int)) ;
+    *visit = (uint8_t *)calloc(bitarray_div8(graph->mlen + 1), sizeof(uint8_t)) ;
+
+    if (!*list || !*visit)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+}
+
+void graph_compute_visit(struct resolve_hash_s hash, uint8_t *visit, unsigned int *list, graph_t *graph, unsigned int *nservice, uint8_t requiredby)
 {
     log_flow() ;
 
-    unsigned int l[graph->mlen], c = 0, pos = 0 ;
-    memset(l, 0, sizeof(unsigned int) * graph->mlen) ;
-    ssize_t idx = 0 ;
+    unsigned int *l = 0, pos = 0 ;
+    int c = 0, idx = 0 ;
 
-    idx = graph_hash_vertex_get_id(graph, hash.res.sa.s + hash.res.name) ;
+    idx = graph_csr_get_id(graph, hash.res.sa.s + hash.res.name) ;
     if (idx < 0)
         log_dieu(LOG_EXIT_SYS, "get id of service: ", hash.res.sa.s + hash.res.name, " -- please make a bug report") ;
 
-    if (!visit[idx]) {
+    if (!bitarray_testandset(visit, idx))
         list[(*nservice)++] = idx ;
-        visit[idx] = 1 ;
-    }
+
+    l = (unsigned int *)calloc(graph->mlen + 1, sizeof(unsigned int)) ;
+    if (!l)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
 
     /** find dependencies of the service from the graph, do it recursively */
-    c = graph_matrix_get_edge_g_list(l, graph, hash.res.sa.s + hash.res.name, requiredby, 1) ;
+    c = graph_csr_get_edge_list(l, graph, hash.res.sa.s + hash.res.name, requiredby, 1) ;
+    if (c < 0)
+        log_dieu(LOG_EXIT_SYS, "get ", requiredby ? "required by" : "dependency", " list of service: ", hash.res.sa.s + hash.res.name) ;
 
     /** append to the list to deal with */
-    for (pos = 0 ; pos < c ; pos++) {
-        if (!visit[l[pos]]) {
+    for (pos = 0 ; pos < (unsigned int)c ; pos++)
+        if (!bitarray_testandset(visit, l[pos]))
             list[(*nservice)++] = l[pos] ;
-            visit[l[pos]] = 1 ;
-        }
-    }
+
+    free(l) ;
 }
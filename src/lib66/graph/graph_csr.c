@@ -0,0 +1,521 @@
+/*
+ * graph_csr.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+
+#include <oblibs/log.h>
+#include <oblibs/graph.h>
+#include <oblibs/sastr.h>
+
+#include <skalibs/genalloc.h>
+#include <skalibs/stralloc.h>
+#include <skalibs/bitarray.h>
+
+#include <66/graph.h>
+#include <66/hash.h>
+
+/**
+ * oblibs keeps the vertices of a graph_t, the edges live here. They
+ * are recorded as pairs while the graph is computed then compressed
+ * by graph_csr_build() into one row by vertex, in both directions.
+ * Nothing is quadratic: building, sorting and walking the graph cost
+ * O(V + E). The view of a graph_t is found at a table keyed by its
+ * address and released by graph_csr_free_all().
+ * */
+
+typedef struct graph_csr_pair_s graph_csr_pair_t ;
+struct graph_csr_pair_s
+{
+    unsigned int from ; // depends on
+    unsigned int to ;
+} ;
+
+struct graph_csr_id_s {
+    char *name ; // key
+    unsigned int id ;
+    UT_hash_handle hh ;
+} ;
+
+struct graph_csr_entry_s {
+    graph_t *g ; // key
+    genalloc pairs ; // graph_csr_pair_t
+    struct graph_csr_id_s *ids ;
+    uint8_t built ;
+    graph_csr_t csr ;
+    UT_hash_handle hh ;
+} ;
+
+static struct graph_csr_entry_s *graphs = NULL ;
+
+static struct graph_csr_entry_s *entry_get(graph_t *g, uint8_t create)
+{
+    struct graph_csr_entry_s *e = NULL ;
+    graph_csr_t zero = GRAPH_CSR_ZERO ;
+
+    HASH_FIND_PTR(graphs, &g, e) ;
+
+    if (e || !create)
+        return e ;
+
+    e = (struct graph_csr_entry_s *)malloc(sizeof(struct graph_csr_entry_s)) ;
+    if (!e)
+        return 0 ;
+
+    memset(e, 0, sizeof(struct graph_csr_entry_s)) ;
+    e->g = g ;
+    e->pairs = (genalloc)GENALLOC_ZERO ;
+    e->ids = NULL ;
+    e->built = 0 ;
+    e->csr = zero ;
+
+    HASH_ADD_PTR(graphs, g, e) ;
+
+    return e ;
+}
+
+static void csr_free(graph_csr_t *csr)
+{
+    graph_csr_t zero = GRAPH_CSR_ZERO ;
+
+    free(csr->offset) ;
+    free(csr->edge) ;
+    free(csr->roffset) ;
+    free(csr->redge) ;
+    free(csr->sort) ;
+    free(csr->rank) ;
+
+    *csr = zero ;
+}
+
+static int id_get(struct graph_csr_entry_s *e, char const *vertex)
+{
+    struct graph_csr_id_s *c = NULL ;
+
+    HASH_FIND_STR(e->ids, vertex, c) ;
+
+    return c ? (int)c->id : -1 ;
+}
+
+/** a row of a direction: @idx at @adj holds all the edges of @from.
+ * Duplicated pairs are dropped, @last is a scratch of @nvertex */
+static void csr_fill(unsigned int *idx, unsigned int *adj, unsigned int *last, graph_csr_pair_t const *p, unsigned int npair, unsigned int nvertex, uint8_t reverse)
+{
+    unsigned int pos = 0, v = 0, w = 0, j = 0 ;
+
+    memset(idx, 0, (nvertex + 1) * sizeof(unsigned int)) ;
+
+    for (; pos < npair ; pos++)
+        idx[(reverse ? p[pos].to : p[pos].from) + 1]++ ;
+
+    for (v = 0 ; v < nvertex ; v++)
+        idx[v + 1] += idx[v] ;
+
+    /** last is used as the insert cursor of each row */
+    memcpy(last, idx, nvertex * sizeof(unsigned int)) ;
+
+    for (pos = 0 ; pos < npair ; pos++) {
+        v = reverse ? p[pos].to : p[pos].from ;
+        adj[last[v]++] = reverse ? p[pos].from : p[pos].to ;
+    }
+
+    /** compact the rows, keeping the first occurrence of an edge */
+    for (v = 0 ; v < nvertex ; v++)
+        last[v] = nvertex ;
+
+    for (v = 0, w = 0 ; v < nvertex ; v++) {
+
+        unsigned int start = idx[v], end = idx[v + 1] ;
+
+        idx[v] = w ;
+
+        for (j = start ; j < end ; j++) {
+
+            if (last[adj[j]] == v)
+                continue ;
+
+            last[adj[j]] = v ;
+            adj[w++] = adj[j] ;
+        }
+    }
+
+    idx[nvertex] = w ;
+}
+
+/** Kahn's algorithm, dependencies first. The vertices part of a cycle
+ * are appended at the end in id order to keep @csr->sort a complete
+ * permutation. Return 1 if the graph is acyclic, 0 otherwise */
+static int csr_sort(graph_csr_t *csr, unsigned int *deg)
+{
+    unsigned int head = 0, tail = 0, v = 0, j = 0 ;
+    unsigned int n = csr->nvertex ;
+
+    for (; v < n ; v++) {
+        deg[v] = csr->offset[v + 1] - csr->offset[v] ;
+        if (!deg[v])
+            csr->sort[tail++] = v ;
+    }
+
+    while (head < tail) {
+
+        v = csr->sort[head++] ;
+
+        for (j = csr->roffset[v] ; j < csr->roffset[v + 1] ; j++)
+            if (!--deg[csr->redge[j]])
+                csr->sort[tail++] = csr->redge[j] ;
+    }
+
+    if (tail == n)
+        goto rank ;
+
+    for (v = 0, j = tail ; v < n ; v++)
+        if (deg[v])
+            csr->sort[j++] = v ;
+
+    rank:
+        for (v = 0 ; v < n ; v++)
+            csr->rank[csr->sort[v]] = v ;
+
+    return tail == n ;
+}
+
+static int rank_cmp(void const *a, void const *b)
+{
+    unsigned int x = *(unsigned int const *)a, y = *(unsigned int const *)b ;
+
+    return (x > y) - (x < y) ;
+}
+
+static int collect(unsigned int *list, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive, uint8_t sorted)
+{
+    int id ;
+    unsigned int n = 0, sp = 0, v = 0, j = 0, *stack = 0 ;
+    uint8_t *visit = 0 ;
+    struct graph_csr_entry_s *e = entry_get(g, 0) ;
+
+    if (!e || !e->built) {
+        errno = EINVAL ;
+        return -1 ;
+    }
+
+    graph_csr_t *csr = &e->csr ;
+    unsigned int *idx = requiredby ? csr->roffset : csr->offset ;
+    unsigned int *adj = requiredby ? csr->redge : csr->edge ;
+
+    id = id_get(e, vertex) ;
+    if (id < 0) {
+        errno = ENOENT ;
+        return -1 ;
+    }
+
+    visit = (uint8_t *)calloc(bitarray_div8(csr->nvertex + 1), sizeof(uint8_t)) ;
+    stack = (unsigned int *)malloc((csr->nvertex + 1) * sizeof(unsigned int)) ;
+    if (!visit || !stack) {
+        free(visit) ;
+        free(stack) ;
+        return -1 ;
+    }
+
+    bitarray_set(visit, id) ;
+    stack[sp++] = id ;
+
+    while (sp) {
+
+        v = stack[--sp] ;
+
+        for (j = idx[v] ; j < idx[v + 1] ; j++) {
+
+            if (bitarray_testandset(visit, adj[j]))
+                continue ;
+
+            list[n++] = adj[j] ;
+
+            if (recursive)
+                stack[sp++] = adj[j] ;
+        }
+    }
+
+    if (sorted) {
+
+        /** order the selection by its position at the sort */
+        for (j = 0 ; j < n ; j++)
+            stack[j] = csr->rank[list[j]] ;
+
+        qsort(stack, n, sizeof(unsigned int), &rank_cmp) ;
+
+        for (j = 0 ; j < n ; j++)
+            list[j] = csr->sort[stack[j]] ;
+    }
+
+    free(visit) ;
+    free(stack) ;
+
+    return (int)n ;
+}
+
+static int collect_sa(stralloc *sa, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive, uint8_t sorted)
+{
+    int n = 0, pos = 0 ;
+    unsigned int *list = (unsigned int *)malloc((genalloc_len(graph_hash_t, &g->hash) + 1) * sizeof(unsigned int)) ;
+
+    if (!list)
+        return -1 ;
+
+    n = collect(list, g, vertex, requiredby, recursive, sorted) ;
+
+    for (; pos < n ; pos++) {
+
+        if (!sastr_add_string(sa, g->data.s + genalloc_s(graph_hash_t, &g->hash)[list[pos]].vertex)) {
+            n = -1 ;
+            break ;
+        }
+    }
+
+    free(list) ;
+
+    return n ;
+}
+
+/** Return the id of @vertex, -1 on error */
+int graph_csr_vertex_add(graph_t *g, char const *vertex)
+{
+    int id ;
+    size_t n = genalloc_len(graph_hash_t, &g->hash) ;
+    struct graph_csr_id_s *c = NULL ;
+    struct graph_csr_entry_s *e = entry_get(g, 1) ;
+
+    if (!e)
+        return -1 ;
+
+    id = id_get(e, vertex) ;
+    if (id >= 0)
+        return id ;
+
+    if (!graph_vertex_add(g, vertex))
+        return -1 ;
+
+    /** the id of a vertex is its index at the hash of the graph */
+    id = genalloc_len(graph_hash_t, &g->hash) > n ? (int)n : graph_hash_vertex_get_id(g, vertex) ;
+    if (id < 0)
+        return -1 ;
+
+    c = (struct graph_csr_id_s *)malloc(sizeof(struct graph_csr_id_s)) ;
+    if (!c)
+        return -1 ;
+
+    c->name = strdup(vertex) ;
+    if (!c->name) {
+        free(c) ;
+        return -1 ;
+    }
+
+    c->id = id ;
+    HASH_ADD_KEYPTR(hh, e->ids, c->name, strlen(c->name), c) ;
+
+    return id ;
+}
+
+/** @vertex depends on @edge */
+int graph_csr_edge_add(graph_t *g, char const *vertex, char const *edge)
+{
+    graph_csr_pair_t p ;
+    int from = graph_csr_vertex_add(g, vertex) ;
+    int to = graph_csr_vertex_add(g, edge) ;
+
+    if (from < 0 || to < 0)
+        return 0 ;
+
+    p.from = from ;
+    p.to = to ;
+
+    return genalloc_append(graph_csr_pair_t, &entry_get(g, 0)->pairs, &p) ;
+}
+
+/** The view must be built again with graph_csr_build() afterward */
+int graph_csr_edge_remove(graph_t *g, char const *vertex, char const *edge)
+{
+    unsigned int pos = 0, w = 0, npair ;
+    int from, to ;
+    struct graph_csr_entry_s *e = entry_get(g, 0) ;
+
+    if (!e)
+        return 0 ;
+
+    from = id_get(e, vertex) ;
+    to = id_get(e, edge) ;
+    if (from < 0 || to < 0)
+        return 0 ;
+
+    graph_csr_pair_t *p = genalloc_s(graph_csr_pair_t, &e->pairs) ;
+    npair = genalloc_len(graph_csr_pair_t, &e->pairs) ;
+
+    for (; pos < npair ; pos++)
+        if (p[pos].from != (unsigned int)from || p[pos].to != (unsigned int)to)
+            p[w++] = p[pos] ;
+
+    genalloc_setlen(graph_csr_pair_t, &e->pairs, w) ;
+
+    return 1 ;
+}
+
+/**
+ * Compress the edges recorded so far and sort the graph. The number
+ * of vertices is reported at g->mlen as the matrix of oblibs did.
+ *
+ * Return 1 on success, 0 if the graph contains a cycle, -1 on error.
+ * */
+int graph_csr_build(graph_t *g)
+{
+    log_flow() ;
+
+    int r ;
+    unsigned int *scratch = 0 ;
+    struct graph_csr_entry_s *e = entry_get(g, 1) ;
+
+    if (!e)
+        return -1 ;
+
+    graph_csr_t *csr = &e->csr ;
+    graph_csr_pair_t const *p = genalloc_s(graph_csr_pair_t, &e->pairs) ;
+    unsigned int npair = genalloc_len(graph_csr_pair_t, &e->pairs) ;
+    unsigned int n = genalloc_len(graph_hash_t, &g->hash) ;
+
+    csr_free(csr) ;
+    e->built = 0 ;
+
+    csr->nvertex = n ;
+    csr->offset = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    csr->roffset = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    csr->edge = (unsigned int *)malloc((npair + 1) * sizeof(unsigned int)) ;
+    csr->redge = (unsigned int *)malloc((npair + 1) * sizeof(unsigned int)) ;
+    csr->sort = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    csr->rank = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    scratch = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+
+    if (!csr->offset || !csr->roffset || !csr->edge || !csr->redge || !csr->sort || !csr->rank || !scratch) {
+        free(scratch) ;
+        csr_free(csr) ;
+        return -1 ;
+    }
+
+    csr_fill(csr->offset, csr->edge, scratch, p, npair, n, 0) ;
+    csr_fill(csr->roffset, csr->redge, scratch, p, npair, n, 1) ;
+    csr->nedge = csr->offset[n] ;
+
+    r = csr_sort(csr, scratch) ;
+
+    free(scratch) ;
+
+    g->mlen = n ;
+    e->built = 1 ;
+
+    return r ;
+}
+
+graph_csr_t *graph_csr_get(graph_t *g)
+{
+    struct graph_csr_entry_s *e = entry_get(g, 0) ;
+
+    return e && e->built ? &e->csr : 0 ;
+}
+
+int graph_csr_get_id(graph_t *g, char const *vertex)
+{
+    struct graph_csr_entry_s *e = entry_get(g, 0) ;
+
+    return e ? id_get(e, vertex) : -1 ;
+}
+
+/**
+ * Store at @list the id of the dependencies of @vertex, its
+ * requiredby if @requiredby is set. @recursive walks the transitive
+ * closure. @list must hold g->mlen elements.
+ *
+ * Return the number of ids stored, -1 on error.
+ * */
+int graph_csr_get_edge_list(unsigned int *list, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive)
+{
+    log_flow() ;
+
+    return collect(list, g, vertex, requiredby, recursive, 0) ;
+}
+
+/** As graph_csr_get_edge_list() in the order of the sort */
+int graph_csr_get_edge_sorted_list(unsigned int *list, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive)
+{
+    log_flow() ;
+
+    return collect(list, g, vertex, requiredby, recursive, 1) ;
+}
+
+/** As graph_csr_get_edge_list() appending the names at @sa */
+int graph_csr_get_edge_sa(stralloc *sa, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive)
+{
+    log_flow() ;
+
+    return collect_sa(sa, g, vertex, requiredby, recursive, 0) ;
+}
+
+int graph_csr_get_edge_sorted_sa(stralloc *sa, graph_t *g, char const *vertex, uint8_t requiredby, uint8_t recursive)
+{
+    log_flow() ;
+
+    return collect_sa(sa, g, vertex, requiredby, recursive, 1) ;
+}
+
+/** Append every vertex at @sa in the order of the sort */
+int graph_csr_sort_tosa(stralloc *sa, graph_t *g)
+{
+    log_flow() ;
+
+    unsigned int pos = 0 ;
+    graph_csr_t *csr = graph_csr_get(g) ;
+
+    if (!csr)
+        return (errno = EINVAL, 0) ;
+
+    for (; pos < csr->nvertex ; pos++)
+        if (!sastr_add_string(sa, g->data.s + genalloc_s(graph_hash_t, &g->hash)[csr->sort[pos]].vertex))
+            return 0 ;
+
+    return 1 ;
+}
+
+/** Free the view of @g and @g itself */
+void graph_csr_free_all(graph_t *g)
+{
+    log_flow() ;
+
+    struct graph_csr_entry_s *e = entry_get(g, 0) ;
+
+    if (e) {
+
+        struct graph_csr_id_s *c, *tmp ;
+
+        HASH_ITER(hh, e->ids, c, tmp) {
+            HASH_DEL(e->ids, c) ;
+            free(c->name) ;
+            free(c) ;
+        }
+
+        csr_free(&e->csr) ;
+        genalloc_free(graph_csr_pair_t, &e->pairs) ;
+
+        HASH_DEL(graphs, e) ;
+        free(e) ;
+    }
+
+    graph_free_all(g) ;
+}
@@ -0,0 +1,300 @@
+/*
+ * graph_csr_cycle.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <oblibs/log.h>
+#include <oblibs/graph.h>
+#include <oblibs/string.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/genalloc.h>
+
+#include <66/graph.h>
+
+#define CYCLE_UNSET ((unsigned int)-1)
+
+static char const *vertex_name(graph_t *g, unsigned int v)
+{
+    return g->data.s + genalloc_s(graph_hash_t, &g->hash)[v].vertex ;
+}
+
+/** Iterative Tarjan's algorithm. @comp[v] receives the component of v,
+ * components are numbered in the order they are closed.
+ * Return the number of components, -1 on error */
+static int tarjan(graph_csr_t *csr, unsigned int *comp)
+{
+    unsigned int n = csr->nvertex, v = 0, w = 0, counter = 0, ncomp = 0, sp = 0, cp = 0 ;
+    unsigned int *index = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    unsigned int *low = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    unsigned int *stack = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    unsigned int *call = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    unsigned int *next = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    int e = -1 ;
+
+    if (!index || !low || !stack || !call || !next)
+        goto freed ;
+
+    for (; v < n ; v++) {
+        index[v] = CYCLE_UNSET ;
+        comp[v] = CYCLE_UNSET ;
+    }
+
+    for (v = 0 ; v < n ; v++) {
+
+        if (index[v] != CYCLE_UNSET)
+            continue ;
+
+        index[v] = low[v] = counter++ ;
+        stack[sp++] = v ;
+        call[cp] = v ;
+        next[cp++] = csr->offset[v] ;
+
+        while (cp) {
+
+            unsigned int u = call[cp - 1] ;
+
+            if (next[cp - 1] < csr->offset[u + 1]) {
+
+                w = csr->edge[next[cp - 1]++] ;
+
+                if (index[w] == CYCLE_UNSET) {
+
+                    index[w] = low[w] = counter++ ;
+                    stack[sp++] = w ;
+                    call[cp] = w ;
+                    next[cp++] = csr->offset[w] ;
+
+                } else if (comp[w] == CYCLE_UNSET && index[w] < low[u]) {
+                    /** w is still on the stack */
+                    low[u] = index[w] ;
+                }
+
+                continue ;
+            }
+
+            /** every edge of u was walked */
+            cp-- ;
+
+            if (cp && low[u] < low[call[cp - 1]])
+                low[call[cp - 1]] = low[u] ;
+
+            if (low[u] == index[u]) {
+
+                do {
+                    w = stack[--sp] ;
+                    comp[w] = ncomp ;
+                } while (w != u) ;
+
+                ncomp++ ;
+            }
+        }
+    }
+
+    e = (int)ncomp ;
+
+    freed:
+        free(index) ;
+        free(low) ;
+        free(stack) ;
+        free(call) ;
+        free(next) ;
+        return e ;
+}
+
+/** Find a closed walk from @root to itself inside its component and
+ * append it at @sa as "root -> a -> b -> root". @parent and @next are
+ * scratch of nvertex elements. The walk visits each vertex and edge
+ * of the component at most once */
+static int chain(stralloc *sa, graph_t *g, graph_csr_t *csr, unsigned int const *comp, unsigned int root, unsigned int *parent, unsigned int *next)
+{
+    unsigned int u = root, w = 0, last = CYCLE_UNSET ;
+
+    parent[root] = root ;
+    next[root] = csr->offset[root] ;
+
+    while (last == CYCLE_UNSET) {
+
+        if (next[u] >= csr->offset[u + 1]) {
+
+            /** dead end, go back. It cannot happen at the root of a
+             * strongly connected component */
+            if (u == root)
+                return 0 ;
+
+            u = parent[u] ;
+            continue ;
+        }
+
+        w = csr->edge[next[u]++] ;
+
+        if (comp[w] != comp[root])
+            continue ;
+
+        if (w == root) {
+            last = u ;
+            break ;
+        }
+
+        if (parent[w] != CYCLE_UNSET)
+            continue ;
+
+        parent[w] = u ;
+        next[w] = csr->offset[w] ;
+        u = w ;
+    }
+
+    {
+        /** the path is read backward from last to root */
+        unsigned int len = 1, pos = 0 ;
+
+        for (u = last ; u != root ; u = parent[u])
+            len++ ;
+
+        unsigned int path[len] ;
+
+        for (u = last, pos = len ; pos ; u = parent[u])
+            path[--pos] = u ;
+
+        for (pos = 0 ; pos < len ; pos++)
+            if (!auto_stra(sa, vertex_name(g, path[pos]), " -> "))
+                return 0 ;
+
+        if (!auto_stra(sa, vertex_name(g, root)))
+            return 0 ;
+    }
+
+    return 1 ;
+}
+
+/**
+ * Report every cycle of @g once graph_csr_build() found one. Each
+ * strongly connected component of more than one vertex, or with a
+ * vertex depending on itself, is reported with a closed chain of
+ * dependencies and the list of its vertices. @func, if set, gives the
+ * file defining a vertex e.g. the frontend file of a service.
+ * It costs O(V + E).
+ *
+ * Return the number of cycles found, -1 on error.
+ * */
+int graph_csr_cycle(graph_t *g, char const *what, graph_cycle_func *func, void *data)
+{
+    log_flow() ;
+
+    int r, ncycle = -1 ;
+    unsigned int v = 0, c = 0, j = 0, n = 0, ncomp = 0 ;
+    unsigned int *comp = 0, *start = 0, *member = 0, *parent = 0, *next = 0 ;
+    uint8_t *cyclic = 0 ;
+    stralloc sa = STRALLOC_ZERO ;
+    graph_csr_t *csr = graph_csr_get(g) ;
+
+    if (!csr)
+        return -1 ;
+
+    n = csr->nvertex ;
+
+    comp = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    member = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    parent = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    next = (unsigned int *)malloc((n + 1) * sizeof(unsigned int)) ;
+    if (!comp || !member || !parent || !next)
+        goto freed ;
+
+    r = tarjan(csr, comp) ;
+    if (r < 0)
+        goto freed ;
+
+    ncomp = r ;
+
+    start = (unsigned int *)calloc(ncomp + 1, sizeof(unsigned int)) ;
+    cyclic = (uint8_t *)calloc(ncomp + 1, sizeof(uint8_t)) ;
+    if (!start || !cyclic)
+        goto freed ;
+
+    /** the vertices grouped by component, in id order */
+    for (v = 0 ; v < n ; v++) {
+
+        start[comp[v] + 1]++ ;
+        parent[v] = CYCLE_UNSET ;
+
+        /** a self dependency makes a cycle of one vertex */
+        for (j = csr->offset[v] ; j < csr->offset[v + 1] ; j++)
+            if (csr->edge[j] == v)
+                cyclic[comp[v]] = 1 ;
+    }
+
+    for (c = 0 ; c < ncomp ; c++)
+        start[c + 1] += start[c] ;
+
+    /** next is the insert cursor of each component here */
+    memcpy(next, start, ncomp * sizeof(unsigned int)) ;
+
+    for (v = 0 ; v < n ; v++)
+        member[next[comp[v]]++] = v ;
+
+    ncycle = 0 ;
+
+    for (c = 0 ; c < ncomp ; c++) {
+
+        unsigned int first = start[c], end = start[c + 1] ;
+
+        if (end - first < 2 && !cyclic[c])
+            continue ;
+
+        sa.len = 0 ;
+        if (!chain(&sa, g, csr, comp, member[first], parent, next) || !stralloc_0(&sa))
+            goto err ;
+
+        log_warn("cycle between ", what, "s: ", sa.s) ;
+
+        sa.len = 0 ;
+        for (j = first ; j < end ; j++)
+            if (!auto_stra(&sa, " ", vertex_name(g, member[j])))
+                goto err ;
+
+        if (!stralloc_0(&sa))
+            goto err ;
+
+        log_warn("strongly connected ", what, "s:", sa.s) ;
+
+        if (func) {
+
+            for (j = first ; j < end ; j++) {
+
+                char const *file = (*func)(vertex_name(g, member[j]), data) ;
+
+                if (file)
+                    log_warn(what, ": ", vertex_name(g, member[j]), " is defined at: ", file) ;
+            }
+        }
+
+        ncycle++ ;
+    }
+
+    goto freed ;
+
+    err:
+        ncycle = -1 ;
+
+    freed:
+        free(comp) ;
+        free(start) ;
+        free(member) ;
+        free(parent) ;
+        free(next) ;
+        free(cyclic) ;
+        stralloc_free(&sa) ;
+        return ncycle ;
+}
@@ -43,14 +43,14 @@ int info_graph_display_service(char const *name)
     ss_state_t sta = STATE_ZERO ;
     s6_svstatus_t status = S6_SVSTATUS_ZERO ;
     resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    resolve_view_t view = RESOLVE_VIEW_ZERO ;
 
     char base[SS_MAX_PATH_LEN + SS_SYSTEM_LEN + 1] ;
 
     if (!set_ownersysdir_stack(base, getuid()))
         log_warn_return(LOG_EXIT_ZERO, "set owner directory") ;
 
-    if (resolve_read_g(wres, base, name) <= 0) {
+    if (service_resolve_view_g(&view, &res, base, name) <= 0) {
         log_warnu("read resolve file of: ",name) ;
         goto freed ;
     }
@@ -121,7 +121,7 @@ int info_graph_display_service(char const *name)
     err = 1 ;
 
     freed:
-        resolve_free(wres) ;
+        resolve_view_free(&view) ;
 
     return err ;
 }
@@ -35,14 +35,14 @@ int info_walk(graph_t *g, char const *name, char const *treename, info_graph_fun
         return 1 ;
 
     if (!name) {
-        if (!graph_matrix_sort_tosa(&sa, g))
+        if (!graph_csr_sort_tosa(&sa, g))
             return 0 ;
 
         count = sastr_nelement(&sa) ;
 
     } else {
 
-        count = graph_matrix_get_edge_g_sorted_sa(&sa, g, name, requiredby, 0) ;
+        count = graph_csr_get_edge_sorted_sa(&sa, g, name, requiredby, 0) ;
     }
 
     if (count == -1)
@@ -97,7 +97,7 @@ int info_walk(graph_t *g, char const *name, char const *treename, info_graph_fun
         if (!info_graph_display(name, func, depth, last, padding, style))
             return 0 ;
 
-        if (graph_matrix_get_edge_g_sorted_sa(&sa, g, name, requiredby, 0) == -1)
+        if (graph_csr_get_edge_sorted_sa(&sa, g, name, requiredby, 0) == -1)
             return 0 ;
 
         if (sa.len) {
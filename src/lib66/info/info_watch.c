@@ -0,0 +1,298 @@
+/*
+ * info_watch.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+#include <oblibs/sastr.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/buffer.h>
+#include <skalibs/tai.h>
+#include <skalibs/iopause.h>
+
+#include <s6/ftrigr.h>
+#include <s6/ftrigw.h>
+
+#include <66/info.h>
+#include <66/state.h>
+#include <66/service.h>
+#include <66/constants.h>
+#include <66/enum.h>
+
+typedef struct watch_s watch_t ;
+struct watch_s
+{
+    resolve_service_t *res ;
+    ss_state_t sta ;
+    uint16_t id ; // ftrigr subscription of a supervised classic service
+} ;
+
+static uint8_t JSON = 0 ;
+
+static void watch_deadline(tain *deadline)
+{
+    tain_now_set_stopwatch_g() ;
+    tain_addsec_g(deadline, 3) ;
+}
+
+static void watch_print(char const *name, char const *event)
+{
+    if (JSON) {
+
+        struct timeval tv ;
+
+        tain_now_g() ;
+        if (!timeval_from_tain(&tv, &STAMP))
+            log_dieusys(LOG_EXIT_SYS, "get the current time") ;
+
+        /** service names are restricted to a safe set of characters
+         * by the parser, nothing to escape */
+        if (!bprintf(buffer_1, "{\"time\":%lld.%03ld,\"service\":\"%s\",\"event\":\"%s\"}\n", (long long)tv.tv_sec, (long)tv.tv_usec / 1000, name, event))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+
+    } else {
+
+        if (!bprintf(buffer_1, "%s%s%s %s\n", log_color->info, name, log_color->off, event))
+            log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+    }
+
+    if (!buffer_flush(buffer_1))
+        log_dieusys(LOG_EXIT_SYS, "write to stdout") ;
+}
+
+/** events sent by s6-supervise at the event directory */
+static char const *watch_event(char c)
+{
+    switch (c) {
+
+        case 'u' : return "up" ;
+        case 'U' : return "ready" ;
+        case 'd' : return "down" ;
+        case 'D' : return "finished" ;
+        case 'O' : return "once" ;
+        default : return 0 ;
+    }
+}
+
+static void watch_subscribe(ftrigr_t *fifo, watch_t *w, tain *deadline)
+{
+    log_flow() ;
+
+    char const *eventdir = w->res->sa.s + w->res->live.eventdir ;
+
+    if (w->res->type != TYPE_CLASSIC || w->id || w->sta.issupervised != STATE_FLAGS_TRUE)
+        return ;
+
+    log_trace("subcribe to fifo: ", eventdir) ;
+    w->id = ftrigr_subscribe_g(fifo, eventdir, "[uUdDOx]", FTRIGR_REPEAT, deadline) ;
+    if (!w->id)
+        log_warnusys("subcribe to fifo: ", eventdir) ;
+}
+
+static void watch_unsubscribe(ftrigr_t *fifo, watch_t *w, tain *deadline)
+{
+    log_flow() ;
+
+    if (!w->id)
+        return ;
+
+    ftrigr_unsubscribe_g(fifo, w->id, deadline) ;
+    w->id = 0 ;
+}
+
+/** The state of the services was written, compare it with the
+ * previous one. The transitions of the supervision come from here
+ * for every type, the up and down ones of the classic services come
+ * from their event directory. */
+static void watch_rescan(ftrigr_t *fifo, watch_t *w, resolve_service_t *const *res, unsigned int n, tain *deadline)
+{
+    log_flow() ;
+
+    unsigned int pos = 0 ;
+    ss_state_t sta[n] ;
+
+    if (state_read_array(sta, 0, res, n) < 0) {
+        log_warnu("read state of the services") ;
+        return ;
+    }
+
+    watch_deadline(deadline) ;
+
+    for (; pos < n ; pos++) {
+
+        char const *name = res[pos]->sa.s + res[pos]->name ;
+        uint8_t classic = res[pos]->type == TYPE_CLASSIC ;
+
+        if (sta[pos].issupervised != w[pos].sta.issupervised)
+            watch_print(name, sta[pos].issupervised == STATE_FLAGS_TRUE ? "supervised" : "unsupervised") ;
+
+        if (!classic && sta[pos].isup != w[pos].sta.isup)
+            watch_print(name, sta[pos].isup == STATE_FLAGS_TRUE ? "up" : "down") ;
+
+        w[pos].sta = sta[pos] ;
+
+        if (classic) {
+
+            if (w[pos].sta.issupervised == STATE_FLAGS_TRUE)
+                watch_subscribe(fifo, &w[pos], deadline) ;
+            else
+                watch_unsubscribe(fifo, &w[pos], deadline) ;
+        }
+    }
+}
+
+/**
+ * Print the transitions of the @n services of @res until the process
+ * is killed. Nothing is polled: the classic services are followed at
+ * their event directory, every state write wakes up the event
+ * directory of the owner at the state directory.
+ *
+ * @json: print one JSON object by line instead of text
+ * */
+void info_watch(resolve_service_t *const *res, unsigned int n, uint8_t json)
+{
+    log_flow() ;
+
+    int r ;
+    unsigned int pos = 0, nevent = 0 ;
+    ftrigr_t fifo = FTRIGR_ZERO ;
+    tain deadline ;
+    watch_t w[n] ;
+    ss_state_t sta[n] ;
+    uint16_t evid[n] ;
+    _alloc_sa_(sa) ;
+    _alloc_sa_(evdir) ;
+
+    JSON = json ;
+
+    watch_deadline(&deadline) ;
+
+    if (!ftrigr_startf_g(&fifo, &deadline))
+        log_dieusys(LOG_EXIT_SYS, "initiate fifo") ;
+
+    /** one event directory by owner, e.g. /run/66/state/0/.event */
+    for (; pos < n ; pos++) {
+
+        size_t livelen = strlen(res[pos]->sa.s + res[pos]->live.livedir) ;
+        size_t ownerlen = strlen(res[pos]->sa.s + res[pos]->ownerstr) ;
+        char event[livelen + SS_STATE_LEN + 1 + ownerlen + SS_STATE_EVENT_LEN + 1] ;
+
+        auto_strings(event, res[pos]->sa.s + res[pos]->live.livedir, SS_STATE + 1, "/", res[pos]->sa.s + res[pos]->ownerstr, SS_STATE_EVENT) ;
+
+        if (sastr_cmp(&evdir, event) >= 0)
+            continue ;
+
+        if (!sastr_add_string(&evdir, event))
+            log_die_nomem("stralloc") ;
+
+        if (!ftrigw_fifodir_make(event, getgid(), 0)) {
+            log_warnusys("create fifo: ", event, " -- only the classic services will be followed") ;
+            continue ;
+        }
+
+        log_trace("subcribe to fifo: ", event) ;
+        evid[nevent] = ftrigr_subscribe_g(&fifo, event, "s", FTRIGR_REPEAT, &deadline) ;
+        if (!evid[nevent]) {
+            log_warnusys("subcribe to fifo: ", event, " -- only the classic services will be followed") ;
+            continue ;
+        }
+
+        nevent++ ;
+    }
+
+    /** subscribe first, a write happening in between is caught
+     * at the next rescan */
+    if (state_read_array(sta, 0, res, n) < 0)
+        log_dieu(LOG_EXIT_SYS, "read state of the services") ;
+
+    for (pos = 0 ; pos < n ; pos++) {
+
+        w[pos].res = res[pos] ;
+        w[pos].sta = sta[pos] ;
+        w[pos].id = 0 ;
+
+        watch_subscribe(&fifo, &w[pos], &deadline) ;
+    }
+
+    for (;;) {
+
+        uint8_t rescan = 0 ;
+        tain dead ;
+        iopause_fd x = { .fd = ftrigr_fd(&fifo), .events = IOPAUSE_READ, .revents = 0 } ;
+
+        tain_now_set_stopwatch_g() ;
+        tain_add_g(&dead, &tain_infinite_relative) ;
+
+        r = iopause_g(&x, 1, &dead) ;
+        if (r < 0)
+            log_dieusys(LOG_EXIT_SYS, "iopause") ;
+
+        if (!r)
+            continue ;
+
+        if (ftrigr_updateb(&fifo) < 0)
+            log_dieusys(LOG_EXIT_SYS, "update fifo") ;
+
+        for (pos = 0 ; pos < nevent ; pos++) {
+
+            sa.len = 0 ;
+            r = ftrigr_checksa(&fifo, evid[pos], &sa) ;
+            if (r < 0)
+                log_dieusys(LOG_EXIT_SYS, "check events of the state directory") ;
+
+            if (sa.len)
+                rescan = 1 ;
+        }
+
+        watch_deadline(&deadline) ;
+
+        for (pos = 0 ; pos < n ; pos++) {
+
+            size_t i = 0 ;
+            char const *name = res[pos]->sa.s + res[pos]->name ;
+
+            if (!w[pos].id)
+                continue ;
+
+            sa.len = 0 ;
+            r = ftrigr_checksa(&fifo, w[pos].id, &sa) ;
+            if (r < 0) {
+                log_warnusys("check events of: ", name) ;
+                watch_unsubscribe(&fifo, &w[pos], &deadline) ;
+                continue ;
+            }
+
+            for (; i < sa.len ; i++) {
+
+                /** the supervisor exited, 66 writes the state
+                 * afterward and the rescan reports it */
+                if (sa.s[i] == 'x') {
+                    watch_unsubscribe(&fifo, &w[pos], &deadline) ;
+                    break ;
+                }
+
+                char const *event = watch_event(sa.s[i]) ;
+                if (event)
+                    watch_print(name, event) ;
+            }
+        }
+
+        if (rescan)
+            watch_rescan(&fifo, w, res, n, &deadline) ;
+    }
+}
@@ -0,0 +1,161 @@
+/*
+ * migrate_record.c
+ *
+ * Copyright (c) 2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+#include <oblibs/sastr.h>
+#include <oblibs/files.h>
+#include <oblibs/stack.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/djbunix.h>
+#include <skalibs/types.h>
+
+#include <66/ssexec.h>
+#include <66/resolve.h>
+#include <66/service.h>
+#include <66/constants.h>
+#include <66/config.h>
+
+#include <66/migrate_record.h>
+
+/** return 1 if the resolve file at @path for @name is already a binary record */
+static int record_isbinary(char const *path, char const *name)
+{
+    char file[strlen(path) + SS_RESOLVE_LEN + 1 + strlen(name) + 1] ;
+    char magic[RESOLVE_RECORD_MAGIC_LEN] ;
+
+    auto_strings(file, path, SS_RESOLVE, "/", name) ;
+
+    if (openreadnclose(file, magic, RESOLVE_RECORD_MAGIC_LEN) < (ssize_t)RESOLVE_RECORD_MAGIC_LEN)
+        return 0 ;
+
+    return !memcmp(magic, RESOLVE_RECORD_MAGIC, RESOLVE_RECORD_MAGIC_LEN) ;
+}
+
+static int migrate_service_record(char const *base, char const *name)
+{
+    log_flow() ;
+
+    int r, e = 0 ;
+    size_t baselen = strlen(base), namelen = strlen(name) ;
+    resolve_service_t res = RESOLVE_SERVICE_ZERO ;
+    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    char path[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + 1] ;
+
+    auto_strings(path, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", name) ;
+
+    if (record_isbinary(path, name)) {
+        e = 1 ;
+        goto freed ;
+    }
+
+    r = resolve_read_g(wres, base, name) ;
+    if (r <= 0) {
+        log_warnu("read resolve file of: ", name) ;
+        goto freed ;
+    }
+
+    log_trace("convert resolve file of: ", name, " to binary record") ;
+    if (!resolve_write(wres, path, name)) {
+        log_warnu("write resolve file of: ", name) ;
+        goto freed ;
+    }
+
+    e = 2 ;
+
+    freed:
+        resolve_free(wres) ;
+        return e ;
+}
+
+/**
+ * Rewrite every cdb resolve file of services as binary record.
+ * The stamp file keeps the version of the format already converted,
+ * so this is only made once per base and per version of the format.
+ * On failure, the stamp is not written and the conversion is retried
+ * at the next invocation, cdb resolve files being still readable.
+ * */
+void migrate_record(ssexec_t *info)
+{
+    log_flow() ;
+
+    int r ;
+    size_t pos = 0 ;
+    char const *exclude[1] = { 0 } ;
+    char version[UINT32_FMT + 1] ;
+    char current[UINT32_FMT + 1] ;
+    _alloc_sa_(sa) ;
+    _alloc_sa_(converted) ;
+    _alloc_stk_(stamp, info->base.len + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_RESOLVE_RECORD_LEN + 1) ;
+    _alloc_stk_(path, info->base.len + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1) ;
+
+    version[uint32_fmt(version, RESOLVE_RECORD_VERSION)] = 0 ;
+
+    auto_strings(stamp.s, info->base.s, SS_SYSTEM, SS_RESOLVE, SS_RESOLVE_RECORD) ;
+
+    r = openreadnclose(stamp.s, current, UINT32_FMT) ;
+    if (r > 0) {
+
+        current[r] = 0 ;
+        if (!strcmp(current, version))
+            return ;
+    }
+
+    auto_strings(path.s, info->base.s, SS_SYSTEM, SS_RESOLVE, SS_SERVICE) ;
+
+    if (access(path.s, F_OK) < 0) {
+
+        if (errno != ENOENT) {
+            log_warnusys("access: ", path.s) ;
+            return ;
+        }
+
+    } else if (!sastr_dir_get_recursive(&sa, path.s, exclude, S_IFLNK, 0)) {
+
+        log_warnu("get resolve files of: ", path.s) ;
+        return ;
+    }
+
+    FOREACH_SASTR(&sa, pos) {
+
+        char *name = sa.s + pos ;
+
+        r = migrate_service_record(info->base.s, name) ;
+        if (!r)
+            return ;
+
+        if (r == 2 && !sastr_add_string(&converted, name))
+            log_die_nomem("stralloc") ;
+    }
+
+    if (converted.len) {
+
+        log_info("Converted resolve files of services to binary record version: ", version) ;
+
+        if (SS_RESOLVE_DB)
+            resolve_db_sync(info->base.s, DATA_SERVICE, converted.s, converted.len) ;
+    }
+
+    log_trace("write resolve record version file: ", stamp.s) ;
+    if (!file_write_unsafe_g(stamp.s, version))
+        log_warnusys("write resolve record version file: ", stamp.s) ;
+}
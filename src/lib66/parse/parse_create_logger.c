@@ -273,9 +273,6 @@ void parse_create_logger(struct resolve_hash_s **hres, resolve_service_t *res, s
         res->logger.execute.run.run = resolve_add_string(wres, lres.sa.s + lres.execute.run.run) ;
         res->logger.execute.run.run_user = resolve_add_string(wres, lres.sa.s + lres.execute.run.run_user) ;
 
-        if (hash_count(hres) > SS_MAX_SERVICE)
-            log_die(LOG_EXIT_SYS, "too many services to parse -- compile again 66 changing the --max-service options") ;
-
         log_trace("add service: ", logname, " to the service selection") ;
         if (!hash_add(hres, logname, lres))
             log_dieu(LOG_EXIT_SYS, "append service selection with: ", logname) ;
@@ -317,9 +317,6 @@ int parse_frontend(char const *sv,
     hash = hash_search(hres, res.sa.s + res.name) ;
     if (hash == NULL) {
 
-        if (hash_count(hres) > SS_MAX_SERVICE)
-            log_die(LOG_EXIT_SYS, "too many services to parse -- compile again 66 changing the --max-service options") ;
-
         log_trace("add service: ", res.sa.s + res.name, " to the service selection") ;
         char *name = res.sa.s + res.name ; // hash_add + log_dieu doesn't accept res.sa.s + res.name
         if (!hash_add(hres, name, res))
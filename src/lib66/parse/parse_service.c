@@ -15,6 +15,9 @@
 #include <string.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h> //rename
 #include <sys/stat.h>
 #include <unistd.h> //access
 
@@ -25,6 +28,8 @@
 #include <oblibs/directory.h>
 
 #include <skalibs/djbunix.h>
+#include <skalibs/direntry.h>
+#include <skalibs/stralloc.h>
 
 #include <66/enum.h>
 #include <66/constants.h>
@@ -170,7 +175,111 @@ void parse_cleanup(resolve_service_t *res, char const *tmpdir, uint8_t force)
     }
 }
 
-void parse_copy_to_source(char const *dst, char const *src, resolve_service_t *res, uint8_t force)
+/** move every entry of @src into @dst, merging the directories
+ * which exist on both sides. Files are replaced by rename, so a reader
+ * sees either the old or the new file. @dirs receives the directories
+ * changed, their entries are synced at the end of the batch */
+static int parse_move_entries(char const *src, char const *dst, stralloc *dirs)
+{
+    log_flow() ;
+
+    int e = 0 ;
+    size_t srclen = strlen(src), dstlen = strlen(dst) ;
+    direntry *d ;
+    DIR *dir = opendir(src) ;
+    if (!dir)
+        log_warnusys_return(LOG_EXIT_ZERO, "opendir: ", src) ;
+
+    if (!sastr_add_string(dirs, dst))
+        goto err ;
+
+    for (;;) {
+
+        struct stat sst, dst_st ;
+
+        errno = 0 ;
+        d = readdir(dir) ;
+        if (!d)
+            break ;
+
+        if (d->d_name[0] == '.' && (!d->d_name[1] || (d->d_name[1] == '.' && !d->d_name[2])))
+            continue ;
+
+        size_t namelen = strlen(d->d_name) ;
+        char s[srclen + 1 + namelen + 1] ;
+        char t[dstlen + 1 + namelen + 1] ;
+
+        auto_strings(s, src, "/", d->d_name) ;
+        auto_strings(t, dst, "/", d->d_name) ;
+
+        if (lstat(s, &sst) < 0) {
+            log_warnusys("stat: ", s) ;
+            goto err ;
+        }
+
+        if (lstat(t, &dst_st) < 0) {
+
+            if (errno != ENOENT) {
+                log_warnusys("stat: ", t) ;
+                goto err ;
+            }
+
+        } else if (S_ISDIR(sst.st_mode) && S_ISDIR(dst_st.st_mode)) {
+
+            if (!parse_move_entries(s, t, dirs))
+                goto err ;
+
+            continue ;
+
+        } else if (S_ISDIR(sst.st_mode) || S_ISDIR(dst_st.st_mode)) {
+
+            /** a directory can not replace a file by rename, neither
+             * the opposite */
+            log_trace("remove element: ", t) ;
+            if (!dir_rm_rf(t)) {
+                log_warnusys("remove element: ", t) ;
+                goto err ;
+            }
+        }
+
+        log_trace("move: ", s, " to: ", t) ;
+        if (rename(s, t) < 0) {
+            log_warnusys("rename: ", s, " to: ", t) ;
+            goto err ;
+        }
+    }
+
+    if (errno) {
+        log_warnusys("readdir: ", src) ;
+        goto err ;
+    }
+
+    e = 1 ;
+
+    err:
+        dir_close(dir) ;
+        return e ;
+}
+
+/** make the changes of the batch durable, one sync per directory */
+static void parse_sync_dirs(stralloc *dirs)
+{
+    log_flow() ;
+
+    size_t pos = 0 ;
+
+    FOREACH_SASTR(dirs, pos) {
+
+        int fd = open(dirs->s + pos, O_RDONLY | O_DIRECTORY | O_CLOEXEC) ;
+        if (fd < 0 || fsync(fd) < 0)
+            log_warnusys("sync directory: ", dirs->s + pos) ;
+
+        if (fd >= 0)
+            close(fd) ;
+    }
+}
+
+void parse_move_to_source(char const *dst, char const *src, resolve_service_t *res, uint8_t force, stralloc *dirs)
 {
     log_flow() ;
 
@@ -222,15 +331,17 @@ void parse_copy_to_source(char const *dst, char const *src, resolve_service_t *r
         }
     }
 
-    log_trace("copy:", src, " to: ", dst) ;
-    if (!hiercopy(src, dst)) {
+    /** src lives on the same filesystem as dst,
+     * nothing is copied */
+    log_trace("move: ", src, " to: ", dst) ;
+    if (!parse_move_entries(src, dst, dirs)) {
         parse_cleanup(res, src, force) ;
-        log_dieusys(LOG_EXIT_SYS, "copy: ", src, " to: ", dst) ;
+        log_dieu(LOG_EXIT_SYS, "move: ", src, " to: ", dst) ;
     }
 
-    /** be paranoid after the use of hiercopy and be sure
-     * to have dst in 0755 mode. If not the log cannot be
-     * executed with other permissions than root */
+    /** be paranoid and be sure to have dst in 0755 mode.
+     * If not the log cannot be executed with other
+     * permissions than root */
     if (chmod(dst, 0755)< 0) {
         parse_cleanup(res, src, force) ;
         log_dieusys(LOG_EXIT_SYS,"chmod: ", dst) ;
@@ -262,6 +373,9 @@ void parse_service(struct resolve_hash_s **hres, char const *sv, ssexec_t *info,
     int r ;
     uint8_t rforce = 0 ;
     _alloc_sa_(sa) ;
+    _alloc_sa_(parsed) ;
+    _alloc_sa_(dirs) ;
+    resolve_txn_t txn = RESOLVE_TXN_ZERO ;
     struct resolve_hash_s *c, *tmp ;
 
     char main[strlen(sv) + 1] ;
@@ -286,10 +400,12 @@ void parse_service(struct resolve_hash_s **hres, char const *sv, ssexec_t *info,
 
             auto_strings(servicedir, c->res.sa.s + c->res.path.home, SS_SYSTEM, SS_SERVICE, SS_SVC, "/", c->res.sa.s + c->res.name) ;
 
-            if (sanitize_write(&c->res, force))
+            if (sanitize_write(&txn, &c->res, force))
                 rforce = 1 ;
 
-            if (!auto_stra(&sa, "/tmp/", c->res.sa.s + c->res.name, ":XXXXXX"))
+            /** the temporary directory is a sibling of the service
+             * directory to be able to rename its files into place */
+            if (!auto_stra(&sa, c->res.sa.s + c->res.path.home, SS_SYSTEM, SS_SERVICE, SS_SVC, "/.", c->res.sa.s + c->res.name, ":XXXXXX"))
                 log_die_nomem("stralloc") ;
 
             if (!mkdtemp(sa.s))
@@ -301,14 +417,14 @@ void parse_service(struct resolve_hash_s **hres, char const *sv, ssexec_t *info,
 
             service_resolve_write_remote(&c->res, sa.s, rforce) ;
 
-            parse_copy_to_source(servicedir, sa.s, &c->res, rforce) ;
+            parse_move_to_source(servicedir, sa.s, &c->res, rforce, &dirs) ;
 
             /** do not die here, just warn the user */
             log_trace("remove temporary directory: ", sa.s) ;
             if (!dir_rm_rf(sa.s))
                 log_warnu("remove temporary directory: ", sa.s) ;
 
-            tree_service_add(c->res.sa.s + c->res.treename, c->res.sa.s + c->res.name, info) ;
+            tree_service_add(&txn, c->res.sa.s + c->res.treename, c->res.sa.s + c->res.name, info) ;
 
             if (!symlink_make(&c->res))
                 log_dieusys(LOG_EXIT_SYS, "make service symlink") ;
@@ -320,7 +436,24 @@ void parse_service(struct resolve_hash_s **hres, char const *sv, ssexec_t *info,
 
             log_info("Parsed successfully: ", c->res.sa.s + c->res.name, " at tree: ", c->res.sa.s + c->res.treename) ;
 
+            if (SS_RESOLVE_DB && !sastr_add_string(&parsed, c->res.sa.s + c->res.name))
+                log_die_nomem("stralloc") ;
+
             c->visit = 1 ;
         }
     }
+
+    parse_sync_dirs(&dirs) ;
+
+    /** a tree receiving many services of the
+     * frontend file is written once */
+    if (!resolve_txn_commit(&txn))
+        log_dieu(LOG_EXIT_SYS, "write resolve files of trees") ;
+
+    resolve_txn_free(&txn) ;
+
+    /** the resolve files were moved from the temporary
+     * directory, import them at once */
+    if (parsed.len)
+        resolve_db_sync(info->base.s, DATA_SERVICE, parsed.s, parsed.len) ;
 }
\ No newline at end of file
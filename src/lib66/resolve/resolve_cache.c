@@ -0,0 +1,129 @@
+/*
+ * resolve_cache.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/djbunix.h>
+
+#include <66/resolve.h>
+#include <66/hash.h>
+
+/** images of the files read by the process. An entry is reused
+ * while the file keeps the same inode, modification time and size,
+ * writers of the process drop the entry of the file they change */
+struct resolve_cache_s {
+    char *file ; // key
+    dev_t dev ;
+    ino_t ino ;
+    struct timespec mtim ;
+    off_t size ;
+    stralloc image ;
+    UT_hash_handle hh ;
+} ;
+
+static struct resolve_cache_s *cache = NULL ;
+
+static void cache_delete(struct resolve_cache_s *c)
+{
+    HASH_DEL(cache, c) ;
+    stralloc_free(&c->image) ;
+    free(c->file) ;
+    free(c) ;
+}
+
+/**
+ * Give at @map and @len the image of @file, read from the disk only
+ * if the cached one is stale. The image stays valid until the next
+ * call for @file or resolve_cache_remove().
+ *
+ * Return 1 on success, 0 if @file does not exist, -1 on error.
+ * */
+int resolve_cache_get(char const *file, char const **map, size_t *len)
+{
+    log_flow() ;
+
+    struct stat st ;
+    struct resolve_cache_s *c = NULL ;
+
+    if (stat(file, &st) < 0)
+        return errno == ENOENT ? 0 : -1 ;
+
+    HASH_FIND_STR(cache, file, c) ;
+
+    if (c) {
+
+        if (c->dev == st.st_dev && c->ino == st.st_ino && c->size == st.st_size &&
+            c->mtim.tv_sec == st.st_mtim.tv_sec && c->mtim.tv_nsec == st.st_mtim.tv_nsec) {
+
+            *map = c->image.s ;
+            *len = c->image.len ;
+            return 1 ;
+        }
+
+        c->image.len = 0 ;
+
+    } else {
+
+        c = (struct resolve_cache_s *)malloc(sizeof(*c)) ;
+        if (c == NULL)
+            return -1 ;
+
+        memset(c, 0, sizeof(*c)) ;
+
+        c->file = strdup(file) ;
+        if (c->file == NULL) {
+            free(c) ;
+            return -1 ;
+        }
+
+        HASH_ADD_KEYPTR(hh, cache, c->file, strlen(c->file), c) ;
+    }
+
+    if (!openslurpclose(&c->image, file)) {
+        int e = errno ;
+        cache_delete(c) ;
+        errno = e ;
+        return errno == ENOENT ? 0 : -1 ;
+    }
+
+    /** a file replaced between stat and read gets a new stat at the
+     * next call as its inode or modification time differs */
+    c->dev = st.st_dev ;
+    c->ino = st.st_ino ;
+    c->mtim = st.st_mtim ;
+    c->size = st.st_size ;
+
+    *map = c->image.s ;
+    *len = c->image.len ;
+
+    return 1 ;
+}
+
+void resolve_cache_remove(char const *file)
+{
+    log_flow() ;
+
+    struct resolve_cache_s *c = NULL ;
+
+    HASH_FIND_STR(cache, file, c) ;
+
+    if (c)
+        cache_delete(c) ;
+}
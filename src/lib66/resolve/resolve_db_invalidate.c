@@ -0,0 +1,65 @@
+/*
+ * resolve_db_invalidate.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/djbunix.h>
+#include <skalibs/posixplz.h>//unlink_void
+
+#include <66/resolve.h>
+#include <66/constants.h>
+
+/**
+ * Drop the resolve database of @base after the write or the removal
+ * of a single resolve file. Regenerating it for each file would copy
+ * the whole database every time. The readers use the resolve files
+ * until the next resolve_db_sync() of a batch rebuilds it in one pass.
+ *
+ * The lock keeps a regeneration started before the write from
+ * renaming a copy of the previous record over the removal.
+ * */
+void resolve_db_invalidate(char const *base)
+{
+    log_flow() ;
+
+    int lfd ;
+    size_t baselen = strlen(base) ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_DBFILE_LEN + 1] ;
+    char lock[baselen + SS_SYSTEM_LEN + SS_RESOLVE_DBLOCK_LEN + 1] ;
+
+    auto_strings(file, base, SS_SYSTEM, SS_RESOLVE_DBFILE) ;
+    auto_strings(lock, base, SS_SYSTEM, SS_RESOLVE_DBLOCK) ;
+
+    if (access(file, F_OK) < 0)
+        return ;
+
+    lfd = open(lock, O_RDWR | O_CREAT | O_CLOEXEC, 0644) ;
+    if (lfd < 0) {
+        log_warnusys("open: ", lock) ;
+        unlink_void(file) ;
+        return ;
+    }
+
+    if (fd_lock(lfd, 1, 0) < 1)
+        log_warnusys("lock: ", lock) ;
+
+    unlink_void(file) ;
+
+    fd_unlock(lfd) ;
+    close(lfd) ;
+}
@@ -0,0 +1,125 @@
+/*
+ * resolve_db_read.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <sys/stat.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/cdb.h>
+#include <skalibs/stralloc.h>
+
+#include <66/resolve.h>
+#include <66/constants.h>
+
+/** the database stays mapped for the whole process. A regeneration
+ * made by any process replaces the file, so a different inode or
+ * modification time means a new mapping is needed */
+static cdb db = CDB_ZERO ;
+static stralloc dbfile = STRALLOC_ZERO ;
+static dev_t dbdev = 0 ;
+static ino_t dbino = 0 ;
+static struct timespec dbmtim = { 0, 0 } ;
+
+static void db_close(void)
+{
+    cdb_free(&db) ;
+    db = cdb_zero ;
+    dbfile.len = 0 ;
+}
+
+static int db_open(char const *file)
+{
+    struct stat st ;
+
+    if (stat(file, &st) < 0) {
+
+        if (db.map)
+            db_close() ;
+
+        return errno == ENOENT ? 0 : -1 ;
+    }
+
+    if (db.map && !strcmp(dbfile.s, file) &&
+        st.st_dev == dbdev && st.st_ino == dbino &&
+        st.st_mtim.tv_sec == dbmtim.tv_sec && st.st_mtim.tv_nsec == dbmtim.tv_nsec)
+            return 1 ;
+
+    if (db.map)
+        db_close() ;
+
+    if (!cdb_init(&db, file))
+        return errno == ENOENT ? 0 : -1 ;
+
+    if (!auto_stra(&dbfile, file)) {
+        db_close() ;
+        return -1 ;
+    }
+
+    dbdev = st.st_dev ;
+    dbino = st.st_ino ;
+    dbmtim = st.st_mtim ;
+
+    return 1 ;
+}
+
+/**
+ * Return 1 if the record was found and read, 0 if the database
+ * does not exist or does not know the record, -1 on error.
+ * The caller falls back to the resolve file on 0.
+ * */
+int resolve_db_read(resolve_wrapper_t *wres, char const *base, char const *name)
+{
+    log_flow() ;
+
+    int r ;
+    cdb_data data ;
+    size_t baselen = strlen(base), namelen = strlen(name) ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_DBFILE_LEN + 1] ;
+    char key[2 + namelen + 1] ;
+
+    if (wres->type > DATA_TREE_MASTER)
+        return 0 ;
+
+    auto_strings(file, base, SS_SYSTEM, SS_RESOLVE_DBFILE) ;
+
+    r = db_open(file) ;
+    if (r <= 0) {
+        if (r < 0)
+            log_warnusys("open resolve database: ", file) ;
+        return r ;
+    }
+
+    key[0] = RESOLVE_DB_KEY(wres->type) ;
+    key[1] = ':' ;
+    memcpy(key + 2, name, namelen) ;
+    key[2 + namelen] = 0 ;
+
+    r = cdb_find(&db, &data, key, 2 + namelen) ;
+    if (r < 0)
+        log_warnusys_return(LOG_EXIT_LESSONE, "search on resolve database: ", file) ;
+
+    if (!r)
+        return 0 ;
+
+    /** a bad record is not fatal, the resolve file is still there */
+    if (!resolve_read_map(wres, data.s, data.len)) {
+        log_warn("invalid record of: ", name, " at resolve database: ", file, " -- reading its resolve file") ;
+        return 0 ;
+    }
+
+    return 1 ;
+}
@@ -0,0 +1,253 @@
+/*
+ * resolve_db_sync.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>//rename
+#include <sys/stat.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+#include <oblibs/sastr.h>
+
+#include <skalibs/cdb.h>
+#include <skalibs/cdbmake.h>
+#include <skalibs/djbunix.h>
+#include <skalibs/stralloc.h>
+#include <skalibs/posixplz.h>//unlink_void
+
+#include <66/resolve.h>
+#include <66/constants.h>
+
+/** add the resolve file of @name to the database under construction.
+ * A missing resolve file means the record was removed */
+static int db_add(cdbmaker *c, char const *base, uint8_t type, char const *name, stralloc *sa)
+{
+    size_t baselen = strlen(base), namelen = strlen(name) ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + SS_RESOLVE_LEN + 1 + namelen + 1] ;
+    char key[2 + namelen + 1] ;
+
+    if (type == DATA_SERVICE)
+        auto_strings(file, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", name, SS_RESOLVE, "/", name) ;
+    else
+        auto_strings(file, base, SS_SYSTEM, SS_RESOLVE, "/", name) ;
+
+    sa->len = 0 ;
+    if (!openslurpclose(sa, file)) {
+        if (errno == ENOENT)
+            return 1 ;
+        log_warnusys_return(LOG_EXIT_ZERO, "read: ", file) ;
+    }
+
+    key[0] = RESOLVE_DB_KEY(type) ;
+    key[1] = ':' ;
+    memcpy(key + 2, name, namelen) ;
+    key[2 + namelen] = 0 ;
+
+    if (!cdbmake_add(c, key, 2 + namelen, sa->s, sa->len))
+        log_warnusys_return(LOG_EXIT_ZERO, "add record: ", key) ;
+
+    return 1 ;
+}
+
+static int db_inlist(char const *list, size_t len, char const *name, uint32_t namelen)
+{
+    size_t pos = 0 ;
+
+    for (; pos < len ; pos += strlen(list + pos) + 1)
+        if (strlen(list + pos) == namelen && !memcmp(list + pos, name, namelen))
+            return 1 ;
+
+    return 0 ;
+}
+
+/** first creation of the database, every resolve file of the base */
+static int db_addall(cdbmaker *c, char const *base, stralloc *sa)
+{
+    int e = 0 ;
+    size_t pos = 0, baselen = strlen(base) ;
+    stralloc list = STRALLOC_ZERO ;
+    char const *exclude[1] = { 0 } ;
+    char dir[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1] ;
+
+    auto_strings(dir, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE) ;
+
+    /** no service was parsed yet */
+    if (access(dir, F_OK) < 0) {
+
+        if (errno != ENOENT) {
+            log_warnusys("access: ", dir) ;
+            goto freed ;
+        }
+
+    } else if (!sastr_dir_get_recursive(&list, dir, exclude, S_IFLNK, 0)) {
+        log_warnusys("get resolve files of: ", dir) ;
+        goto freed ;
+    }
+
+    /** dot files are temporaries of resolve_write_cdb() */
+    FOREACH_SASTR(&list, pos)
+        if (list.s[pos] != '.' && !db_add(c, base, DATA_SERVICE, list.s + pos, sa))
+            goto freed ;
+
+    list.len = 0 ;
+    dir[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN] = 0 ;
+
+    if (!sastr_dir_get(&list, dir, exclude, S_IFREG)) {
+        log_warnusys("get resolve files of: ", dir) ;
+        goto freed ;
+    }
+
+    FOREACH_SASTR(&list, pos) {
+
+        char *name = list.s + pos ;
+
+        if (name[0] == '.')
+            continue ;
+
+        if (!db_add(c, base, !strcmp(name, SS_MASTER + 1) ? DATA_TREE_MASTER : DATA_TREE, name, sa))
+            goto freed ;
+    }
+
+    e = 1 ;
+
+    freed:
+        stralloc_free(&list) ;
+        return e ;
+}
+
+/**
+ * Regenerate the resolve database of @base from the resolve files.
+ * @list contains @len bytes of null terminated names of type @type
+ * which were written or removed. The other records are copied from
+ * the current database, or read from their resolve file if the
+ * database does not exist yet.
+ *
+ * The new database is made in the same directory and renamed over
+ * the old one. On failure, the database is removed and the readers
+ * use the resolve files.
+ * */
+int resolve_db_sync(char const *base, uint8_t type, char const *list, size_t len)
+{
+    log_flow() ;
+
+    int fd, lfd, e = 0, r ;
+    size_t baselen = strlen(base) ;
+    cdb old = CDB_ZERO ;
+    cdbmaker c = CDBMAKER_ZERO ;
+    stralloc sa = STRALLOC_ZERO ;
+    size_t pos = 0 ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_DBFILE_LEN + 1] ;
+    char lock[baselen + SS_SYSTEM_LEN + SS_RESOLVE_DBLOCK_LEN + 1] ;
+    char tfile[baselen + SS_SYSTEM_LEN + SS_RESOLVE_DBFILE_LEN + 8] ;
+
+    auto_strings(file, base, SS_SYSTEM, SS_RESOLVE_DBFILE) ;
+    auto_strings(lock, base, SS_SYSTEM, SS_RESOLVE_DBLOCK) ;
+    auto_strings(tfile, file, ":XXXXXX") ;
+
+    /** serialize the regeneration between processes */
+    lfd = open(lock, O_RDWR | O_CREAT | O_CLOEXEC, 0644) ;
+    if (lfd < 0)
+        log_warnusys_return(LOG_EXIT_ZERO, "open: ", lock) ;
+
+    if (fd_lock(lfd, 1, 0) < 1) {
+        log_warnusys("lock: ", lock) ;
+        close(lfd) ;
+        return 0 ;
+    }
+
+    r = cdb_init(&old, file) ;
+    if (!r && errno != ENOENT) {
+        log_warnusys("open resolve database: ", file) ;
+        goto err_lock ;
+    }
+
+    fd = mkstemp(tfile) ;
+    if (fd < 0 || ndelay_off(fd) < 0) {
+        log_warnusys("mkstemp: ", tfile) ;
+        goto err_old ;
+    }
+
+    if (!cdbmake_start(&c, fd)) {
+        log_warnusys("cdbmake_start") ;
+        goto err ;
+    }
+
+    if (r) {
+
+        cdb_data key, data ;
+        uint32_t cpos = CDB_TRAVERSE_INIT() ;
+
+        for (;;) {
+
+            int n = cdb_traverse_next(&old, &key, &data, &cpos) ;
+            if (n < 0) {
+                log_warnusys("traverse resolve database: ", file) ;
+                goto err ;
+            }
+
+            if (!n)
+                break ;
+
+            if (key.len > 2 && key.s[0] == RESOLVE_DB_KEY(type) && db_inlist(list, len, key.s + 2, key.len - 2))
+                continue ;
+
+            if (!cdbmake_add(&c, key.s, key.len, data.s, data.len)) {
+                log_warnusys("copy record of resolve database: ", file) ;
+                goto err ;
+            }
+        }
+
+        for (; pos < len ; pos += strlen(list + pos) + 1)
+            if (!db_add(&c, base, type, list + pos, &sa))
+                goto err ;
+
+    } else if (!db_addall(&c, base, &sa))
+        goto err ;
+
+    if (!cdbmake_finish(&c) || fsync(fd) < 0) {
+        log_warnusys("write: ", tfile) ;
+        goto err ;
+    }
+
+    close(fd) ;
+
+    if (rename(tfile, file) < 0) {
+        log_warnusys("rename: ", tfile, " to: ", file) ;
+        unlink_void(tfile) ;
+        goto err_old ;
+    }
+
+    e = 1 ;
+    goto end ;
+
+    err:
+        close(fd) ;
+        unlink_void(tfile) ;
+    err_old:
+        /** never let a stale database behind */
+        unlink_void(file) ;
+    end:
+        if (r)
+            cdb_free(&old) ;
+    err_lock:
+        fd_unlock(lfd) ;
+        close(lfd) ;
+        stralloc_free(&sa) ;
+        return e ;
+}
@@ -12,49 +12,55 @@
  * except according to the terms contained in the LICENSE file./
  */
 
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
 #include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
 
 #include <oblibs/log.h>
+#include <oblibs/string.h>
 
-#include <skalibs/cdb.h>
+#include <skalibs/djbunix.h>
 
 #include <66/resolve.h>
-#include <66/service.h>
-#include <66/tree.h>
 
+/** the file is a binary record or a cdb, resolve_read_map
+ * knows both so only map it here */
 int resolve_read_cdb(resolve_wrapper_t *wres, char const *path, const char *name)
 {
     log_flow() ;
 
-    int fd, e = 0 ;
-    cdb c = CDB_ZERO ;
+    int fd, e = 0, err = errno ;
+    struct stat st ;
+    char *map = 0 ;
+    char file[strlen(path) + strlen(name) + 1] ;
 
-    e = resolve_open_cdb(&fd, &c, path, name) ;
-    if (e <= 0)
-        return e ;
+    auto_strings(file, path, name) ;
 
-    e = 0 ;
+    errno = 0 ;
 
-    if (wres->type == DATA_SERVICE) {
+    fd = open_readb(file) ;
+    if (fd < 0)
+        log_warnusys_return(errno == ENOENT ? 0 : -1, "open: ", file) ;
 
-        if (!service_resolve_read_cdb(&c, ((resolve_service_t *)wres->obj)))
-            goto err ;
+    errno = err ;
 
-    } else if (wres->type == DATA_TREE){
-
-        if (!tree_resolve_read_cdb(&c, ((resolve_tree_t *)wres->obj)))
-            goto err ;
+    if (fstat(fd, &st) < 0 || !st.st_size || st.st_size > UINT32_MAX) {
+        log_warnusys("stat: ", file) ;
+        fd_close(fd) ;
+        return -1 ;
+    }
 
-    } else if (wres->type == DATA_TREE_MASTER) {
+    map = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0) ;
+    fd_close(fd) ;
+    if (map == MAP_FAILED)
+        log_warnusys_return(LOG_EXIT_LESSONE, "map: ", file) ;
 
-        if (!tree_resolve_master_read_cdb(&c, ((resolve_tree_master_t *)wres->obj)))
-            goto err ;
-    }
+    e = resolve_read_map(wres, map, (uint32_t)st.st_size) ;
 
-    e = 1 ;
+    munmap(map, st.st_size) ;
 
-    err:
-        close(fd) ;
-        cdb_free(&c) ;
-        return e ;
+    return e ;
 }
@@ -13,34 +13,51 @@
  */
 
 #include <string.h>
+#include <stdint.h>
 
 #include <oblibs/log.h>
 #include <oblibs/string.h>
 
 #include <66/resolve.h>
 #include <66/constants.h>
+#include <66/config.h>
 
 int resolve_read_g(resolve_wrapper_t *wres, char const *base, char const *name)
 {
     log_flow() ;
 
-    if (!resolve_check_g(wres, base, name))
-        return 0 ;
+    if (SS_RESOLVE_DB && resolve_db_read(wres, base, name) > 0)
+        return 1 ;
 
+    int r ;
+    char const *map = 0 ;
+    size_t len = 0 ;
     size_t baselen = strlen(base) ;
     size_t namelen = strlen(name) ;
 
-    char path[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + 1] ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + SS_RESOLVE_LEN + 1 + namelen + 1] ;
 
     if (wres->type == DATA_SERVICE) {
 
-        auto_strings(path, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", name) ;
+        auto_strings(file, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", name, SS_RESOLVE, "/", name) ;
 
     } else if (wres->type == DATA_TREE || wres->type == DATA_TREE_MASTER) {
 
-        auto_strings(path, base, SS_SYSTEM) ;
+        auto_strings(file, base, SS_SYSTEM, SS_RESOLVE, "/", name) ;
+
+    } else return 0 ;
 
+    /** the same resolve file is read many times by a command,
+     * only the first read and a change of the file hit the disk */
+    r = resolve_cache_get(file, &map, &len) ;
+    if (r <= 0) {
+        if (r < 0)
+            log_warnusys("read: ", file) ;
+        return r ;
     }
 
-    return resolve_read(wres, path, name) ;
+    if (!len || len > UINT32_MAX)
+        return 0 ;
+
+    return resolve_read_map(wres, map, (uint32_t)len) ;
 }
@@ -0,0 +1,61 @@
+/*
+ * resolve_read_map.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <stdint.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/cdb.h>
+
+#include <66/resolve.h>
+#include <66/service.h>
+#include <66/tree.h>
+
+/** @map is the image of a resolve file, either mapped
+ * from its own file or from the resolve database */
+int resolve_read_map(resolve_wrapper_t *wres, char const *map, uint32_t len)
+{
+    log_flow() ;
+
+    cdb c = CDB_ZERO ;
+
+    c.map = map ;
+    c.size = len ;
+
+    if (wres->type == DATA_SERVICE) {
+
+        /** resolve files written before the binary record
+         * are still cdb, read them as is until their migration */
+        if (RESOLVE_ISRECORD(map, len)) {
+
+            if (!service_resolve_read_record(map, len, ((resolve_service_t *)wres->obj)))
+                return 0 ;
+
+        } else if (!service_resolve_read_cdb(&c, ((resolve_service_t *)wres->obj)))
+            return 0 ;
+
+    } else if (wres->type == DATA_TREE){
+
+        if (!tree_resolve_read_cdb(&c, ((resolve_tree_t *)wres->obj)))
+            return 0 ;
+
+    } else if (wres->type == DATA_TREE_MASTER) {
+
+        if (!tree_resolve_master_read_cdb(&c, ((resolve_tree_master_t *)wres->obj)))
+            return 0 ;
+
+    } else return 0 ;
+
+    return 1 ;
+}
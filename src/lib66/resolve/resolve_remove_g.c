@@ -22,6 +22,7 @@
 
 #include <66/resolve.h>
 #include <66/constants.h>
+#include <66/config.h>
 
 void resolve_remove_g(char const *base, char const *name, uint8_t data_type)
 {
@@ -31,10 +32,12 @@ void resolve_remove_g(char const *base, char const *name, uint8_t data_type)
     size_t baselen = strlen(base) ;
     size_t namelen = strlen(name) ;
     char path[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + 1] ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + SS_RESOLVE_LEN + 1 + namelen + 1] ;
 
     if (data_type == DATA_SERVICE) {
 
         auto_strings(path, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", name) ;
+        auto_strings(file, path, SS_RESOLVE, "/", name) ;
 
         resolve_remove(path, name) ;
 
@@ -44,7 +47,16 @@ void resolve_remove_g(char const *base, char const *name, uint8_t data_type)
     } else if (data_type == DATA_TREE || data_type == DATA_TREE_MASTER) {
 
         auto_strings(path, base, SS_SYSTEM) ;
+        auto_strings(file, path, SS_RESOLVE, "/", name) ;
 
         resolve_remove(path, name) ;
-    }
+
+    } else return ;
+
+    resolve_cache_remove(file) ;
+
+    if (SS_RESOLVE_DB)
+        resolve_db_invalidate(base) ;
+
+    errno = e ;
 }
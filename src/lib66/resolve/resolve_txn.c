@@ -0,0 +1,299 @@
+/*
+ * resolve_txn.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+#include <oblibs/sastr.h>
+
+#include <skalibs/stralloc.h>
+
+#include <66/resolve.h>
+#include <66/service.h>
+#include <66/tree.h>
+#include <66/constants.h>
+#include <66/config.h>
+#include <66/hash.h>
+
+/** a resolve file loaded by the transaction. The key is the
+ * type, the base and the name of the file, the record is written
+ * back at commit only if it was modified through
+ * resolve_txn_modify_field() or marked by resolve_txn_touch() */
+struct resolve_txn_entry_s {
+    char *key ; // key
+    uint8_t type ;
+    char *base ;
+    char *name ;
+    union {
+        resolve_service_t service ;
+        resolve_tree_t tree ;
+        resolve_tree_master_t master ;
+    } obj ;
+    resolve_wrapper_t wres ;
+    uint8_t dirty ;
+    uint8_t synced ;
+    UT_hash_handle hh ;
+} ;
+
+static void txn_delete(resolve_txn_t *txn, struct resolve_txn_entry_s *e)
+{
+    HASH_DEL(txn->entries, e) ;
+    resolve_wrapper_t_ref wres = &e->wres ;
+    RESOLVE_SET_SAWRES(wres) ;
+    stralloc_free(sawres) ;
+    free(e->key) ;
+    free(e) ;
+}
+
+/** make the renames of the commit durable, one sync per directory */
+static void txn_sync_dirs(stralloc *dirs)
+{
+    size_t pos = 0 ;
+
+    FOREACH_SASTR(dirs, pos) {
+
+        int fd = open(dirs->s + pos, O_RDONLY | O_DIRECTORY | O_CLOEXEC) ;
+        if (fd < 0 || fsync(fd) < 0)
+            log_warnusys("sync directory: ", dirs->s + pos) ;
+
+        if (fd >= 0)
+            close(fd) ;
+    }
+}
+
+static int txn_write(struct resolve_txn_entry_s *e, stralloc *dirs)
+{
+    size_t baselen = strlen(e->base) ;
+    size_t namelen = strlen(e->name) ;
+
+    char path[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + 1] ;
+
+    if (e->type == DATA_SERVICE)
+        auto_strings(path, e->base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", e->name) ;
+    else
+        auto_strings(path, e->base, SS_SYSTEM) ;
+
+    if (!resolve_write(&e->wres, path, e->name))
+        return 0 ;
+
+    char file[strlen(path) + SS_RESOLVE_LEN + 1 + namelen + 1] ;
+    auto_strings(file, path, SS_RESOLVE, "/", e->name) ;
+    resolve_cache_remove(file) ;
+
+    /** the directory of the resolve file */
+    file[strlen(path) + SS_RESOLVE_LEN] = 0 ;
+    if (sastr_cmp(dirs, file) < 0 && !sastr_add_string(dirs, file))
+        return 0 ;
+
+    return 1 ;
+}
+
+static struct resolve_txn_entry_s *txn_find(resolve_txn_t *txn, uint8_t type, char const *base, char const *name)
+{
+    struct resolve_txn_entry_s *e = NULL ;
+    char key[1 + strlen(base) + 1 + strlen(name) + 1] ;
+
+    key[0] = '0' + type ;
+    auto_strings(key + 1, base, ":", name) ;
+
+    HASH_FIND_STR(txn->entries, key, e) ;
+
+    return e ;
+}
+
+/**
+ * Give at @wres the record of @name of type @type, read from @base
+ * at the first request only. Reading the record does not write it
+ * back: change it through resolve_txn_modify_field(), or through @wres
+ * followed by resolve_txn_touch(). @wres stays valid until
+ * resolve_txn_free().
+ *
+ * Return 1 on success, 0 if the resolve file does not exist, -1 on error.
+ * */
+int resolve_txn_get(resolve_wrapper_t **wres, resolve_txn_t *txn, uint8_t type, char const *base, char const *name)
+{
+    log_flow() ;
+
+    int r ;
+    size_t baselen = strlen(base), namelen = strlen(name) ;
+    struct resolve_txn_entry_s *e = NULL ;
+
+    if (type != DATA_SERVICE && type != DATA_TREE && type != DATA_TREE_MASTER)
+        return 0 ;
+
+    e = txn_find(txn, type, base, name) ;
+
+    if (e) {
+        *wres = &e->wres ;
+        return 1 ;
+    }
+
+    char key[1 + baselen + 1 + namelen + 1] ;
+    key[0] = '0' + type ;
+    auto_strings(key + 1, base, ":", name) ;
+
+    e = (struct resolve_txn_entry_s *)malloc(sizeof(*e) + baselen + 1 + namelen + 1) ;
+    if (e == NULL)
+        return -1 ;
+
+    memset(e, 0, sizeof(*e)) ;
+
+    e->key = strdup(key) ;
+    if (e->key == NULL) {
+        free(e) ;
+        return -1 ;
+    }
+
+    e->type = type ;
+    e->base = (char *)(e + 1) ;
+    e->name = e->base + baselen + 1 ;
+    auto_strings(e->base, base) ;
+    auto_strings(e->name, name) ;
+
+    if (type == DATA_SERVICE) {
+        e->obj.service = service_resolve_zero ;
+    } else if (type == DATA_TREE) {
+        e->obj.tree = tree_resolve_zero ;
+    } else {
+        e->obj.master = tree_resolve_master_zero ;
+    }
+
+    e->wres.type = type ;
+    e->wres.obj = &e->obj ;
+
+    HASH_ADD_KEYPTR(hh, txn->entries, e->key, strlen(e->key), e) ;
+
+    r = resolve_read_g(&e->wres, base, name) ;
+    if (r <= 0) {
+        txn_delete(txn, e) ;
+        return r ;
+    }
+
+    *wres = &e->wres ;
+
+    return 1 ;
+}
+
+int resolve_txn_modify_field(resolve_txn_t *txn, uint8_t type, char const *base, char const *name, uint8_t field, char const *value)
+{
+    log_flow() ;
+
+    resolve_wrapper_t_ref wres = 0 ;
+
+    if (resolve_txn_get(&wres, txn, type, base, name) <= 0)
+        return 0 ;
+
+    if (!resolve_modify_field(wres, field, value))
+        return 0 ;
+
+    return resolve_txn_touch(txn, type, base, name) ;
+}
+
+/**
+ * Mark the record of @name as modified, for the callers changing it
+ * directly through the wrapper given by resolve_txn_get().
+ *
+ * Return 1 on success, 0 if the record was not loaded by @txn.
+ * */
+int resolve_txn_touch(resolve_txn_t *txn, uint8_t type, char const *base, char const *name)
+{
+    log_flow() ;
+
+    struct resolve_txn_entry_s *e = txn_find(txn, type, base, name) ;
+
+    if (e == NULL)
+        return 0 ;
+
+    e->dirty = 1 ;
+
+    return 1 ;
+}
+
+/**
+ * Write every modified record of @txn, each file once whatever the
+ * number of modifications it received. The records stay loaded and
+ * @txn can be used again.
+ *
+ * Return 1 on success, 0 on failure with the name of the failing
+ * record already logged.
+ * */
+int resolve_txn_commit(resolve_txn_t *txn)
+{
+    log_flow() ;
+
+    struct resolve_txn_entry_s *e, *tmp, *f, *ftmp ;
+    _alloc_sa_(dirs) ;
+
+    HASH_ITER(hh, txn->entries, e, tmp) {
+
+        e->synced = 0 ;
+
+        if (!e->dirty)
+            continue ;
+
+        log_trace("write resolve file of: ", e->name) ;
+        if (!txn_write(e, &dirs))
+            log_warnusys_return(LOG_EXIT_ZERO, "write resolve file of: ", e->name) ;
+
+        e->dirty = 0 ;
+        e->synced = 1 ;
+    }
+
+    txn_sync_dirs(&dirs) ;
+
+    if (!SS_RESOLVE_DB)
+        return 1 ;
+
+    /** one import of the database for each base and type */
+    HASH_ITER(hh, txn->entries, e, tmp) {
+
+        if (!e->synced)
+            continue ;
+
+        _alloc_sa_(list) ;
+
+        HASH_ITER(hh, e, f, ftmp) {
+
+            if (!f->synced || f->type != e->type || strcmp(f->base, e->base))
+                continue ;
+
+            if (!stralloc_catb(&list, f->name, strlen(f->name) + 1))
+                log_warnsys_return(LOG_EXIT_ZERO, "stralloc") ;
+
+            f->synced = 0 ;
+        }
+
+        /** the database is a copy of the resolve files, a failure
+         * to regenerate it is not an error of the commit */
+        resolve_db_sync(e->base, e->type, list.s, list.len) ;
+    }
+
+    return 1 ;
+}
+
+void resolve_txn_free(resolve_txn_t *txn)
+{
+    log_flow() ;
+
+    struct resolve_txn_entry_s *e, *tmp ;
+
+    HASH_ITER(hh, txn->entries, e, tmp)
+        txn_delete(txn, e) ;
+
+    txn->entries = NULL ;
+}
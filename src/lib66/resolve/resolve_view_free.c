@@ -0,0 +1,34 @@
+/*
+ * resolve_view_free.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <sys/mman.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/stralloc.h>
+
+#include <66/resolve.h>
+
+void resolve_view_free(resolve_view_t *view)
+{
+    log_flow() ;
+
+    if (view->map)
+        munmap(view->map, view->len) ;
+
+    stralloc_free(&view->sa) ;
+
+    view->map = 0 ;
+    view->len = 0 ;
+}
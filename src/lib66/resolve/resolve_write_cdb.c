@@ -20,8 +20,11 @@
 
 #include <oblibs/log.h>
 #include <oblibs/string.h>
+#include <oblibs/sastr.h>
 
 #include <skalibs/djbunix.h>
+#include <skalibs/allreadwrite.h>
+#include <skalibs/stralloc.h>
 #include <skalibs/cdbmake.h>
 #include <skalibs/posixplz.h>//unlink
 
@@ -37,10 +40,14 @@ int resolve_write_cdb(resolve_wrapper_t *wres, const char *path, const char *nam
     size_t pathlen = strlen(path), namelen = strlen(name) ;
     cdbmaker c = CDBMAKER_ZERO ;
     char file[pathlen + namelen + 1] ;
-    char tfile[5 + strlen(name) + 8] ;
+    char tfile[pathlen + 1 + namelen + 8] ;
 
+    /** the temporary file lives next to the resolve file, so
+     * readers see either the old or the new one after the rename.
+     * It is hidden from the listings of the resolve directory,
+     * see tree_master_modify_contents() and resolve_db_sync() */
     auto_strings(file, path, name) ;
-    auto_strings(tfile, "/tmp/", name, ":", "XXXXXX") ;
+    auto_strings(tfile, path, ".", name, ":XXXXXX") ;
 
     fd = mkstemp(tfile) ;
     if (fd < 0 || ndelay_off(fd)) {
@@ -48,15 +55,22 @@ int resolve_write_cdb(resolve_wrapper_t *wres, const char *path, const char *nam
         goto err_fd ;
     }
 
-    if (!cdbmake_start(&c, fd)) {
-        log_warnusys("cdbmake_start") ;
-        goto err ;
-    }
-
     if (wres->type == DATA_SERVICE) {
 
-        if (!service_resolve_write_cdb(&c, ((resolve_service_t *)wres->obj)))
-            goto err ;
+        /** services are written as binary record, see
+         * service_resolve_write_record */
+        _alloc_sa_(sa) ;
+
+        if (!service_resolve_write_record(&sa, ((resolve_service_t *)wres->obj)) ||
+            allwrite(fd, sa.s, sa.len) < sa.len) {
+                log_warnusys("write to: ", tfile) ;
+                goto err ;
+        }
+
+    } else if (!cdbmake_start(&c, fd)) {
+
+        log_warnusys("cdbmake_start") ;
+        goto err ;
 
     } else if (wres->type == DATA_TREE) {
 
@@ -70,20 +84,18 @@ int resolve_write_cdb(resolve_wrapper_t *wres, const char *path, const char *nam
 
     }
 
-    if (!cdbmake_finish(&c) || fsync(fd) < 0) {
+    if ((wres->type != DATA_SERVICE && !cdbmake_finish(&c)) || fsync(fd) < 0) {
         log_warnusys("write to: ", tfile) ;
         goto err ;
     }
 
     close(fd) ;
 
-    if (!filecopy_unsafe(tfile, file, 0600)) {
-        log_warnusys("copy: ", tfile, " to ", file) ;
+    if (rename(tfile, file) < 0) {
+        log_warnusys("rename: ", tfile, " to: ", file) ;
         goto err_fd ;
     }
 
-    unlink_void(tfile) ;
-
     return 1 ;
 
     err:
@@ -19,6 +19,7 @@
 
 #include <66/resolve.h>
 #include <66/constants.h>
+#include <66/config.h>
 
 int resolve_write_g(resolve_wrapper_t *wres, char const *base, char const *name)
 {
@@ -39,5 +40,18 @@ int resolve_write_g(resolve_wrapper_t *wres, char const *base, char const *name)
 
     } else return 0 ;
 
-    return resolve_write(wres, path, name) ;
+    if (!resolve_write(wres, path, name))
+        return 0 ;
+
+    {
+        char file[strlen(path) + SS_RESOLVE_LEN + 1 + namelen + 1] ;
+        auto_strings(file, path, SS_RESOLVE, "/", name) ;
+        resolve_cache_remove(file) ;
+    }
+
+    /** the database is rebuilt by the next batch, see resolve_db_invalidate() */
+    if (SS_RESOLVE_DB)
+        resolve_db_invalidate(base) ;
+
+    return 1 ;
 }
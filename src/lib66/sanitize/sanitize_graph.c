@@ -60,7 +60,7 @@ void sanitize_graph(ssexec_t *info)
         char name[strlen(c->res.sa.s + c->res.name) + 1] ;
         auto_strings(name, c->res.sa.s + c->res.name) ;
 
-        if (graph_matrix_get_edge_g_sa(&sa, &graph, name, 0, 0) < 0)
+        if (graph_csr_get_edge_sa(&sa, &graph, name, 0, 0) < 0)
             log_dieu(LOG_EXIT_SYS, "get dependencies of service: ", name) ;
 
         c->res.dependencies.ndepends = 0 ;
@@ -76,7 +76,7 @@ void sanitize_graph(ssexec_t *info)
 
         sa.len = 0 ;
 
-        if (graph_matrix_get_edge_g_sa(&sa, &graph, name, 1, 0) < 0)
+        if (graph_csr_get_edge_sa(&sa, &graph, name, 1, 0) < 0)
             log_dieu(LOG_EXIT_SYS, "get requiredby of service: ", name) ;
 
         c->res.dependencies.nrequiredby = 0 ;
@@ -97,5 +97,5 @@ void sanitize_graph(ssexec_t *info)
     }
 
     hash_free(&hres) ;
-    graph_free_all(&graph) ;
+    graph_csr_free_all(&graph) ;
 }
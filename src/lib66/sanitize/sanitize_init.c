@@ -61,6 +61,8 @@ void cleanup(struct resolve_hash_s *hash, unsigned int alen)
         if (!dir_rm_rf(pres->sa.s + pres->live.servicedir))
             log_warnusys("remove live directory: ", pres->sa.s + pres->live.servicedir) ;
 
+        state_table_release(pres) ;
+
         log_trace("remove symlink: ", pres->sa.s + pres->live.scandir) ;
         unlink(pres->sa.s + pres->live.scandir) ;
 
@@ -90,6 +92,10 @@ void sanitize_init(unsigned int *alist, unsigned int alen, graph_t *g, struct re
     struct resolve_hash_s toclean[alen] ;
     struct resolve_hash_s real[alen] ;
     unsigned int ntoclean = 0 ;
+    struct resolve_hash_s *ahash[alen] ;
+    resolve_service_t *ares[alen] ;
+    ss_state_t asta[alen] ;
+    uint8_t found[alen] ;
 
     memset(msg, 0, alen * sizeof(unsigned int)) ;
     memset(toclean, 0, alen * sizeof(struct resolve_hash_s)) ;
@@ -99,10 +105,22 @@ void sanitize_init(unsigned int *alist, unsigned int alen, graph_t *g, struct re
 
         char *name = g->data.s + genalloc_s(graph_hash_t,&g->hash)[alist[pos]].vertex ;
 
-        struct resolve_hash_s *hash = hash_search(hres,name) ;
-        if (hash == NULL)
+        ahash[pos] = hash_search(hres,name) ;
+        if (ahash[pos] == NULL)
             log_dieu(LOG_EXIT_SYS,"find ares id -- please make a bug reports") ;
 
+        ares[pos] = &ahash[pos]->res ;
+    }
+
+    /** the state of the selection in one pass */
+    if (state_read_array(asta, found, ares, alen) < 0)
+        log_dieu(LOG_EXIT_SYS, "read state of the selection") ;
+
+    for (pos = 0 ; pos < alen ; pos++) {
+
+        struct resolve_hash_s *hash = ahash[pos] ;
+        char *name = hash->res.sa.s + hash->res.name ;
+
         pres = &hash->res ;
 
         toclean[ntoclean++] = *hash ;
@@ -110,11 +128,11 @@ void sanitize_init(unsigned int *alist, unsigned int alen, graph_t *g, struct re
         char *scandir = pres->sa.s + pres->live.scandir ;
         size_t scandirlen = strlen(scandir) ;
 
-        int r = state_read(&sta, pres) ;
-
-        if (!r)
+        if (!found[pos])
             log_dieu(LOG_EXIT_SYS, "read state file of: ", name, " -- please make a bug reports") ;
 
+        sta = asta[pos] ;
+
         if (!sanitize_livestate(pres, &sta)) {
             cleanup(toclean, ntoclean) ;
             log_dieu(LOG_EXIT_SYS, "sanitize state directory: ", pres->sa.s + pres->name) ;
@@ -259,21 +277,21 @@ void sanitize_init(unsigned int *alist, unsigned int alen, graph_t *g, struct re
      * We need to write the state file anyway. Thus can always
      * be consider as initialized.
      * */
+    /** the states were written by the first pass */
+    if (state_read_array(asta, found, ares, alen) < 0) {
+        cleanup(toclean, ntoclean) ;
+        log_dieusys(LOG_EXIT_SYS, "read state of the selection") ;
+    }
+
     for (pos = 0 ; pos < alen ; pos++) {
 
-        ss_state_t sta = STATE_ZERO ;
+        ss_state_t sta = asta[pos] ;
         char *name = g->data.s + genalloc_s(graph_hash_t,&g->hash)[alist[pos]].vertex ;
 
-        struct resolve_hash_s *hash = hash_search(hres, name) ;
-        if (hash == NULL) {
-            cleanup(toclean, ntoclean) ;
-            log_dieu(LOG_EXIT_SYS, "find hash id of: ", name, " -- please make a bug reports") ;
-        }
-
-        pres = &hash->res ;
+        pres = ares[pos] ;
         char *sa = pres->sa.s ;
 
-        if (!state_read(&sta, pres)) {
+        if (!found[pos]) {
             cleanup(toclean, ntoclean) ;
             log_dieusys(LOG_EXIT_SYS, "read status file of: ", sa + pres->name) ;
         }
@@ -85,6 +85,10 @@ static int sanitize_copy_source(resolve_service_t *res)
     if (!sanitize_livestate_directory(res))
         return 0 ;
 
+    /** a slot left by a previous live directory would hide
+     * the status file copied from the source */
+    state_table_release(res) ;
+
     log_trace("copy: ", home, " to: ", live) ;
     if (!hiercopy(home, live))
         log_warnusys_return(LOG_EXIT_ZERO, "copy: ", home, " to: ", live) ;
@@ -120,6 +124,8 @@ int sanitize_livestate(resolve_service_t *res, ss_state_t *sta)
         log_trace("remove directory: ", res->sa.s + res->live.servicedir) ;
         if (!dir_rm_rf(res->sa.s + res->live.servicedir))
             log_warnusys_return(LOG_EXIT_ZERO, "remove live directory: ", res->sa.s + res->live.servicedir) ;
+
+        state_table_release(res) ;
     }
     return 1 ;
 }
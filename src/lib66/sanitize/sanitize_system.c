@@ -35,6 +35,7 @@
 #include <66/write.h>
 #include <66/parse.h>
 #include <66/resolve.h>
+#include <66/migrate.h>
 
 static void auto_dir(char const *dst, mode_t mode)
 {
@@ -199,4 +200,7 @@ void sanitize_system(ssexec_t *info)
         }
     }
 
+    /** resolve files of services written as cdb are converted
+     * to binary record once per base */
+    migrate_record(info) ;
 }
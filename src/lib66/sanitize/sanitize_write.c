@@ -35,7 +35,7 @@
 #include <66/state.h>
 #include <66/svc.h>
 
-static void resolve_compare(resolve_service_t *res)
+static void resolve_compare(resolve_txn_t *txn, resolve_service_t *res)
 {
     log_flow() ;
 
@@ -61,13 +61,13 @@ static void resolve_compare(resolve_service_t *res)
         }
 
         if (strcmp(res->sa.s + res->treename, fres.sa.s + fres.treename))
-            tree_service_remove(fres.sa.s + fres.path.home, fres.sa.s + fres.treename, name) ;
+            tree_service_remove(txn, fres.sa.s + fres.path.home, fres.sa.s + fres.treename, name) ;
     }
 
     resolve_free(wres) ;
 }
 
-static int preserve(resolve_service_t *res, uint8_t force)
+static int preserve(resolve_txn_t *txn, resolve_service_t *res, uint8_t force)
 {
     log_flow() ;
 
@@ -85,7 +85,7 @@ static int preserve(resolve_service_t *res, uint8_t force)
 
         if (force) {
 
-            resolve_compare(res) ;
+            resolve_compare(txn, res) ;
 
         } else
             /** This info should only be executed with reconfigure process as long as the parse_frontend
@@ -96,10 +96,10 @@ static int preserve(resolve_service_t *res, uint8_t force)
     return r ;
 }
 
-int sanitize_write(resolve_service_t *res, uint8_t force)
+int sanitize_write(resolve_txn_t *txn, resolve_service_t *res, uint8_t force)
 {
     log_flow() ;
 
-    return preserve(res, force) ;
+    return preserve(txn, res, force) ;
 }
 
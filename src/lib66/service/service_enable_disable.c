@@ -29,7 +29,18 @@
 #include <66/enum.h>
 #include <66/ssexec.h>
 
-static void service_enable_disable_deps(graph_t *g, struct resolve_hash_s *hash, struct resolve_hash_s **hres, uint8_t action, uint8_t propagate, ssexec_t *info)
+/** the resolve file is written at the commit of @txn */
+static void service_enable_disable_write(resolve_txn_t *txn, resolve_service_t *res, uint8_t action)
+{
+    log_flow() ;
+
+    res->enabled = action ;
+
+    if (!resolve_txn_modify_field(txn, DATA_SERVICE, res->sa.s + res->path.home, res->sa.s + res->name, E_RESOLVE_SERVICE_ENABLED, action ? "1" : "0"))
+        log_dieu(LOG_EXIT_SYS, "modify resolve file of: ", res->sa.s + res->name) ;
+}
+
+static void service_enable_disable_deps(resolve_txn_t *txn, graph_t *g, struct resolve_hash_s *hash, struct resolve_hash_s **hres, uint8_t action, uint8_t propagate, ssexec_t *info)
 {
     log_flow() ;
 
@@ -37,7 +48,7 @@ static void service_enable_disable_deps(graph_t *g, struct resolve_hash_s *hash,
     stralloc sa = STRALLOC_ZERO ;
     resolve_service_t_ref res = &hash->res ;
 
-    if (graph_matrix_get_edge_g_sa(&sa, g, res->sa.s + res->name, action ? 0 : 1, 0) < 0)
+    if (graph_csr_get_edge_sa(&sa, g, res->sa.s + res->name, action ? 0 : 1, 0) < 0)
         log_dieu(LOG_EXIT_SYS, "get ", action ? "dependencies" : "required by" ," of: ", res->sa.s + res->name) ;
 
     if (sa.len) {
@@ -56,7 +67,7 @@ static void service_enable_disable_deps(graph_t *g, struct resolve_hash_s *hash,
             }
 
             if (!h->visit) {
-                service_enable_disable(g, h, hres, action, propagate, info) ;
+                service_enable_disable(txn, g, h, hres, action, propagate, info) ;
                 h->visit = 1 ;
             }
         }
@@ -66,15 +77,16 @@ static void service_enable_disable_deps(graph_t *g, struct resolve_hash_s *hash,
 }
 
 /** @action -> 0 disable
- * @action -> 1 enable */
-void service_enable_disable(graph_t *g, struct resolve_hash_s *hash, struct resolve_hash_s **hres, uint8_t action, uint8_t propagate, ssexec_t *info)
+ * @action -> 1 enable
+ * The trees and the services are modified through @txn,
+ * the caller commits it */
+void service_enable_disable(resolve_txn_t *txn, graph_t *g, struct resolve_hash_s *hash, struct resolve_hash_s **hres, uint8_t action, uint8_t propagate, ssexec_t *info)
 {
     log_flow() ;
 
     if (!hash->visit) {
 
         resolve_service_t_ref res = &hash->res ;
-        resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, res) ;
         char const *treename = 0 ;
         if (info->opt_tree)
             treename = info->treename.s ;
@@ -85,20 +97,15 @@ void service_enable_disable(graph_t *g, struct resolve_hash_s *hash, struct reso
         if (action) {
 
             if (info->opt_tree)
-                service_switch_tree(res, res->sa.s + res->path.home, treename, info) ;
+                service_switch_tree(txn, res, res->sa.s + res->path.home, treename, info) ;
             else
-                tree_service_add(treename, res->sa.s + res->name, info) ;
+                tree_service_add(txn, treename, res->sa.s + res->name, info) ;
         }
 
-        res->enabled = action ;
-
-        if (!resolve_write_g(wres, res->sa.s + res->path.home, res->sa.s + res->name))
-            log_dieu(LOG_EXIT_SYS, "write  resolve file of: ", res->sa.s + res->name) ;
+        service_enable_disable_write(txn, res, action) ;
 
         if (propagate)
-            service_enable_disable_deps(g, hash, hres, action, propagate, info) ;
-
-        free(wres) ;
+            service_enable_disable_deps(txn, g, hash, hres, action, propagate, info) ;
 
         /** the logger must be disabled to avoid to start it
          * with the 66 tree start <tree> command */
@@ -112,18 +119,11 @@ void service_enable_disable(graph_t *g, struct resolve_hash_s *hash, struct reso
 
             if (!h->visit) {
 
-                wres = resolve_set_struct(DATA_SERVICE,  &h->res) ;
-
-                h->res.enabled = action ;
-
-                if (!resolve_write_g(wres, h->res.sa.s + h->res.path.home, h->res.sa.s + h->res.name))
-                    log_dieu(LOG_EXIT_SYS, "write  resolve file of: ", h->res.sa.s + h->res.name) ;
+                service_enable_disable_write(txn, &h->res, action) ;
 
                 log_info("Disabled successfully: ", name) ;
 
                 h->visit = 1 ;
-
-                free(wres) ;
             }
         }
 
@@ -147,28 +147,21 @@ void service_enable_disable(graph_t *g, struct resolve_hash_s *hash, struct reso
 
                     if (!h->visit) {
 
-                        wres = resolve_set_struct(DATA_SERVICE,  &h->res) ;
-
                         if (action) {
 
                             if (info->opt_tree)
-                                service_switch_tree(&h->res, h->res.sa.s + h->res.path.home, treename, info) ;
+                                service_switch_tree(txn, &h->res, h->res.sa.s + h->res.path.home, treename, info) ;
                             else
-                                tree_service_add(treename, h->res.sa.s + h->res.name, info) ;
+                                tree_service_add(txn, treename, h->res.sa.s + h->res.name, info) ;
                         }
 
-                        h->res.enabled = action ;
-
-                        if (!resolve_write_g(wres, h->res.sa.s + h->res.path.home, h->res.sa.s + h->res.name))
-                            log_dieu(LOG_EXIT_SYS, "write  resolve file of: ", h->res.sa.s + h->res.name) ;
+                        service_enable_disable_write(txn, &h->res, action) ;
 
-                        service_enable_disable_deps(g, h, hres, action, propagate, info) ;
+                        service_enable_disable_deps(txn, g, h, hres, action, propagate, info) ;
 
                         h->visit = 1 ;
 
                         log_info(!action ? "Disabled" : "Enabled"," successfully: ", h->res.sa.s + h->res.name) ;
-
-                        free(wres) ;
                     }
                 }
             }
@@ -29,7 +29,7 @@
 static void issupervised(char *store, struct resolve_hash_s **hres, char const *str)
 {
     size_t pos = 0, len = strlen(str) ;
-    ss_state_t ste = STATE_ZERO ;
+    unsigned int n = 0, i = 0 ;
 
     _alloc_stk_(stk, len + 1) ;
     memset(store, 0, len * sizeof(char)) ;
@@ -37,6 +37,11 @@ static void issupervised(char *store, struct resolve_hash_s **hres, char const *
     if (!stack_string_clean(&stk, str))
         log_dieu(LOG_EXIT_SYS, "clean string") ;
 
+    unsigned int nelement = stack_count_element(&stk) ;
+    resolve_service_t *res[nelement + 1] ;
+    ss_state_t ste[nelement + 1] ;
+    uint8_t found[nelement + 1] ;
+
     FOREACH_STK(&stk, pos) {
 
         char *name = stk.s + pos ;
@@ -47,38 +52,52 @@ static void issupervised(char *store, struct resolve_hash_s **hres, char const *
             continue ;
         }
 
-        if (!state_check(&hash->res))
-            continue ;
+        res[n++] = &hash->res ;
+    }
 
-        if (!state_read(&ste, &hash->res))
-            continue ;
+    if (state_read_array(ste, found, res, n) < 0)
+        log_dieu(LOG_EXIT_SYS, "read state of services: ", str) ;
 
-        if (ste.issupervised == STATE_FLAGS_TRUE)
-            auto_strings(store + strlen(store), name, " ") ;
-        else
-            continue ;
-    }
+    for (; i < n ; i++)
+        if (found[i] && ste[i].issupervised == STATE_FLAGS_TRUE)
+            auto_strings(store + strlen(store), res[i]->sa.s + res[i]->name, " ") ;
 
     store[strlen(store) - 1] = 0 ;
 }
 
+static char const *frontend(char const *vertex, void *data)
+{
+    struct resolve_hash_s *hash = hash_search((struct resolve_hash_s **)data, vertex) ;
+
+    return hash ? hash->res.sa.s + hash->res.path.frontend : 0 ;
+}
+
 void service_graph_compute(graph_t *g, struct resolve_hash_s **hres, uint32_t flag)
 {
     log_flow() ;
 
-    ss_state_t ste = STATE_ZERO ;
+    int r ;
+    unsigned int n = 0, pos = 0, nhash = HASH_COUNT(*hres) ;
     resolve_service_t_ref pres = 0 ;
     struct resolve_hash_s *c, *tmp ;
+    resolve_service_t *res[nhash + 1] ;
+    ss_state_t state[nhash + 1] ;
+    uint8_t found[nhash + 1] ;
 
-    HASH_ITER(hh, *hres, c, tmp) {
+    HASH_ITER(hh, *hres, c, tmp)
+        res[n++] = &c->res ;
 
-        pres = &c->res ;
-        char *service = pres->sa.s + pres->name ;
+    /** the state of the whole collection in one pass */
+    if (state_read_array(state, found, res, n) < 0)
+        log_dieu(LOG_EXIT_SYS, "read state of services") ;
 
-        if (!state_check(pres))
-            continue ;
+    for (; pos < n ; pos++) {
 
-        if (!state_read(&ste, pres))
+        pres = res[pos] ;
+        char *service = pres->sa.s + pres->name ;
+        ss_state_t ste = state[pos] ;
+
+        if (!found[pos])
             continue ;
 
         if (ste.issupervised == STATE_FLAGS_FALSE && FLAGS_ISSET(flag, STATE_FLAGS_ISSUPERVISED)) {
@@ -86,7 +105,7 @@ void service_graph_compute(graph_t *g, struct resolve_hash_s **hres, uint32_t fl
             continue ;
         }
 
-        if (!graph_vertex_add(g, service))
+        if (graph_csr_vertex_add(g, service) < 0)
             log_dieu(LOG_EXIT_SYS, "add vertex: ", service) ;
 
         if (FLAGS_ISSET(flag, STATE_FLAGS_TOPROPAGATE)) {
@@ -130,12 +149,12 @@ void service_graph_compute(graph_t *g, struct resolve_hash_s **hres, uint32_t fl
         }
     }
 
-    if (!graph_matrix_build(g))
+    r = graph_csr_build(g) ;
+    if (r < 0)
         log_dieu(LOG_EXIT_SYS, "build the graph") ;
 
-    if (!graph_matrix_analyze_cycle(g))
+    if (!r) {
+        graph_csr_cycle(g, "service", &frontend, hres) ;
         log_die(LOG_EXIT_SYS, "cyclic graph detected") ;
-
-    if (!graph_matrix_sort(g))
-        log_dieu(LOG_EXIT_SYS, "sort the graph") ;
+    }
 }
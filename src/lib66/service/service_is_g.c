@@ -65,14 +65,12 @@ int service_get_treename(char *atree, char const *name, uint32_t flag)
 
     int e = 0, r = -1 ;
     resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    resolve_view_t view = RESOLVE_VIEW_ZERO ;
 
     char base[SS_MAX_PATH_LEN + SS_SYSTEM_LEN + 1] ;
 
-    if (!set_ownersysdir_stack(base, getuid())) {
-        resolve_free(wres) ;
+    if (!set_ownersysdir_stack(base, getuid()))
         log_warnusys_return(LOG_EXIT_ZERO, "set owner directory") ;
-    }
 
     size_t baselen = strlen(base) ;
     auto_strings(base + baselen, SS_SYSTEM) ;
@@ -83,7 +81,7 @@ int service_get_treename(char *atree, char const *name, uint32_t flag)
 
     base[baselen] = 0 ;
 
-    r = resolve_read_g(wres, base, name) ;
+    r = service_resolve_view_g(&view, &res, base, name) ;
     if (r == -1 || !r)
         goto freed ;
 
@@ -97,7 +95,7 @@ int service_get_treename(char *atree, char const *name, uint32_t flag)
     e = 1 ;
 
     freed:
-        resolve_free(wres) ;
+        resolve_view_free(&view) ;
         return e ;
 }
 
@@ -112,14 +110,13 @@ int service_is_g(char const *name, uint32_t flag)
 
     ss_state_t ste = STATE_ZERO ;
     resolve_service_t res = RESOLVE_SERVICE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, &res) ;
+    resolve_view_t view = RESOLVE_VIEW_ZERO ;
     int e = -1, r = -1 ;
     char base[SS_MAX_PATH_LEN + SS_SYSTEM_LEN + 1] ;
 
     if (!set_ownersysdir_stack(base, getuid())) {
 
         log_warnusys("set owner directory") ;
-        resolve_free(wres) ;
         return e ;
     }
 
@@ -134,7 +131,7 @@ int service_is_g(char const *name, uint32_t flag)
 
     base[baselen] = 0 ;
 
-    r = resolve_read_g(wres, base, name) ;
+    r = service_resolve_view_g(&view, &res, base, name) ;
     if (r == -1)
         goto freed ;
     else if (!r) {
@@ -150,7 +147,7 @@ int service_is_g(char const *name, uint32_t flag)
     e = service_is(&ste, flag) ;
 
     freed:
-        resolve_free(wres) ;
+        resolve_view_free(&view) ;
         return e ;
 }
 
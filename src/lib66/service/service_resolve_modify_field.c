@@ -12,6 +12,7 @@
  * except according to the terms contained in the LICENSE file./
  */
 
+#include <stddef.h>//offsetof
 #include <stdint.h>
 #include <stdlib.h>//free
 
@@ -20,104 +21,107 @@
 #include <66/resolve.h>
 #include <66/service.h>
 
+#define RESOLVE_SERVICE_OFFSET(field) offsetof(resolve_service_t, field)
+
 resolve_field_table_t resolve_service_field_table[] = {
 
-    [E_RESOLVE_SERVICE_RVERSION] = { .field = "rversion" },
+    [E_RESOLVE_SERVICE_RVERSION] = { .field = "rversion", .offset = RESOLVE_SERVICE_OFFSET(rversion) },
 
     // configuration
-    [E_RESOLVE_SERVICE_NAME] = { .field = "name" },
-    [E_RESOLVE_SERVICE_DESCRIPTION] = { .field = "description" },
-    [E_RESOLVE_SERVICE_VERSION] = { .field = "version" },
-    [E_RESOLVE_SERVICE_TYPE] = { .field = "type" },
-    [E_RESOLVE_SERVICE_NOTIFY] = { .field = "notify" },
-    [E_RESOLVE_SERVICE_MAXDEATH] = { .field = "maxdeath" },
-    [E_RESOLVE_SERVICE_EARLIER] = { .field = "earlier" },
-    [E_RESOLVE_SERVICE_HIERCOPY] = { .field = "hiercopy" },
-    [E_RESOLVE_SERVICE_INTREE] = { .field = "intree" },
-    [E_RESOLVE_SERVICE_OWNERSTR] = { .field = "ownerstr" },
-    [E_RESOLVE_SERVICE_OWNER] = { .field = "owner" },
-    [E_RESOLVE_SERVICE_TREENAME] = { .field = "treename" },
-    [E_RESOLVE_SERVICE_USER] = { .field = "user" },
-    [E_RESOLVE_SERVICE_INNS] = { .field = "inns" },
-    [E_RESOLVE_SERVICE_ENABLED] = { .field = "enabled" },
-    [E_RESOLVE_SERVICE_ISLOG] = { .field = "islog" },
+    [E_RESOLVE_SERVICE_NAME] = { .field = "name", .offset = RESOLVE_SERVICE_OFFSET(name) },
+    [E_RESOLVE_SERVICE_DESCRIPTION] = { .field = "description", .offset = RESOLVE_SERVICE_OFFSET(description) },
+    [E_RESOLVE_SERVICE_VERSION] = { .field = "version", .offset = RESOLVE_SERVICE_OFFSET(version) },
+    [E_RESOLVE_SERVICE_TYPE] = { .field = "type", .offset = RESOLVE_SERVICE_OFFSET(type) },
+    [E_RESOLVE_SERVICE_NOTIFY] = { .field = "notify", .offset = RESOLVE_SERVICE_OFFSET(notify) },
+    [E_RESOLVE_SERVICE_MAXDEATH] = { .field = "maxdeath", .offset = RESOLVE_SERVICE_OFFSET(maxdeath) },
+    [E_RESOLVE_SERVICE_EARLIER] = { .field = "earlier", .offset = RESOLVE_SERVICE_OFFSET(earlier) },
+    [E_RESOLVE_SERVICE_HIERCOPY] = { .field = "hiercopy", .offset = RESOLVE_SERVICE_OFFSET(hiercopy) },
+    [E_RESOLVE_SERVICE_INTREE] = { .field = "intree", .offset = RESOLVE_SERVICE_OFFSET(intree) },
+    [E_RESOLVE_SERVICE_OWNERSTR] = { .field = "ownerstr", .offset = RESOLVE_SERVICE_OFFSET(ownerstr) },
+    [E_RESOLVE_SERVICE_OWNER] = { .field = "owner", .offset = RESOLVE_SERVICE_OFFSET(owner) },
+    [E_RESOLVE_SERVICE_TREENAME] = { .field = "treename", .offset = RESOLVE_SERVICE_OFFSET(treename) },
+    [E_RESOLVE_SERVICE_USER] = { .field = "user", .offset = RESOLVE_SERVICE_OFFSET(user) },
+    [E_RESOLVE_SERVICE_INNS] = { .field = "inns", .offset = RESOLVE_SERVICE_OFFSET(inns) },
+    [E_RESOLVE_SERVICE_ENABLED] = { .field = "enabled", .offset = RESOLVE_SERVICE_OFFSET(enabled) },
+    [E_RESOLVE_SERVICE_ISLOG] = { .field = "islog", .offset = RESOLVE_SERVICE_OFFSET(islog) },
 
     // path
-    [E_RESOLVE_SERVICE_HOME] = { .field = "home" },
-    [E_RESOLVE_SERVICE_FRONTEND] = { .field = "frontend" },
-    [E_RESOLVE_SERVICE_SERVICEDIR] = { .field = "servicedir" },
+    [E_RESOLVE_SERVICE_HOME] = { .field = "home", .offset = RESOLVE_SERVICE_OFFSET(path.home) },
+    [E_RESOLVE_SERVICE_FRONTEND] = { .field = "frontend", .offset = RESOLVE_SERVICE_OFFSET(path.frontend) },
+    [E_RESOLVE_SERVICE_SERVICEDIR] = { .field = "servicedir", .offset = RESOLVE_SERVICE_OFFSET(path.servicedir) },
 
     // dependencies
-    [E_RESOLVE_SERVICE_DEPENDS] = { .field = "depends" },
-    [E_RESOLVE_SERVICE_REQUIREDBY] = { .field = "requiredby" },
-    [E_RESOLVE_SERVICE_OPTSDEPS] = { .field = "optsdeps" },
-    [E_RESOLVE_SERVICE_CONTENTS] = { .field = "contents" },
-    [E_RESOLVE_SERVICE_NDEPENDS] = { .field = "ndepends" },
-    [E_RESOLVE_SERVICE_NREQUIREDBY] = { .field = "nrequiredby" },
-    [E_RESOLVE_SERVICE_NOPTSDEPS] = { .field = "noptsdeps" },
-    [E_RESOLVE_SERVICE_NCONTENTS] = { .field = "ncontents" },
+    [E_RESOLVE_SERVICE_DEPENDS] = { .field = "depends", .offset = RESOLVE_SERVICE_OFFSET(dependencies.depends) },
+    [E_RESOLVE_SERVICE_REQUIREDBY] = { .field = "requiredby", .offset = RESOLVE_SERVICE_OFFSET(dependencies.requiredby) },
+    [E_RESOLVE_SERVICE_OPTSDEPS] = { .field = "optsdeps", .offset = RESOLVE_SERVICE_OFFSET(dependencies.optsdeps) },
+    [E_RESOLVE_SERVICE_CONTENTS] = { .field = "contents", .offset = RESOLVE_SERVICE_OFFSET(dependencies.contents) },
+    [E_RESOLVE_SERVICE_NDEPENDS] = { .field = "ndepends", .offset = RESOLVE_SERVICE_OFFSET(dependencies.ndepends) },
+    [E_RESOLVE_SERVICE_NREQUIREDBY] = { .field = "nrequiredby", .offset = RESOLVE_SERVICE_OFFSET(dependencies.nrequiredby) },
+    [E_RESOLVE_SERVICE_NOPTSDEPS] = { .field = "noptsdeps", .offset = RESOLVE_SERVICE_OFFSET(dependencies.noptsdeps) },
+    [E_RESOLVE_SERVICE_NCONTENTS] = { .field = "ncontents", .offset = RESOLVE_SERVICE_OFFSET(dependencies.ncontents) },
 
     // execute
-    [E_RESOLVE_SERVICE_RUN] = { .field = "run" },
-    [E_RESOLVE_SERVICE_RUN_USER] = { .field = "run_user" },
-    [E_RESOLVE_SERVICE_RUN_BUILD] = { .field = "run_build" },
-    [E_RESOLVE_SERVICE_RUN_RUNAS] = { .field = "run_runas" },
-    [E_RESOLVE_SERVICE_FINISH] = { .field = "finish" },
-    [E_RESOLVE_SERVICE_FINISH_USER] = { .field = "finish_user" },
-    [E_RESOLVE_SERVICE_FINISH_BUILD] = { .field = "finish_build" },
-    [E_RESOLVE_SERVICE_FINISH_RUNAS] = { .field = "finish_runas" },
-    [E_RESOLVE_SERVICE_TIMEOUTSTART] = { .field = "timeoutstart" },
-    [E_RESOLVE_SERVICE_TIMEOUTSTOP] = { .field = "timeoutstop" },
-    [E_RESOLVE_SERVICE_DOWN] = { .field = "down" },
-    [E_RESOLVE_SERVICE_DOWNSIGNAL] = { .field = "downsignal" },
+    [E_RESOLVE_SERVICE_RUN] = { .field = "run", .offset = RESOLVE_SERVICE_OFFSET(execute.run.run) },
+    [E_RESOLVE_SERVICE_RUN_USER] = { .field = "run_user", .offset = RESOLVE_SERVICE_OFFSET(execute.run.run_user) },
+    [E_RESOLVE_SERVICE_RUN_BUILD] = { .field = "run_build", .offset = RESOLVE_SERVICE_OFFSET(execute.run.build) },
+    [E_RESOLVE_SERVICE_RUN_RUNAS] = { .field = "run_runas", .offset = RESOLVE_SERVICE_OFFSET(execute.run.runas) },
+    [E_RESOLVE_SERVICE_FINISH] = { .field = "finish", .offset = RESOLVE_SERVICE_OFFSET(execute.finish.run) },
+    [E_RESOLVE_SERVICE_FINISH_USER] = { .field = "finish_user", .offset = RESOLVE_SERVICE_OFFSET(execute.finish.run_user) },
+    [E_RESOLVE_SERVICE_FINISH_BUILD] = { .field = "finish_build", .offset = RESOLVE_SERVICE_OFFSET(execute.finish.build) },
+    [E_RESOLVE_SERVICE_FINISH_RUNAS] = { .field = "finish_runas", .offset = RESOLVE_SERVICE_OFFSET(execute.finish.runas) },
+    [E_RESOLVE_SERVICE_TIMEOUTSTART] = { .field = "timeoutstart", .offset = RESOLVE_SERVICE_OFFSET(execute.timeout.start) },
+    [E_RESOLVE_SERVICE_TIMEOUTSTOP] = { .field = "timeoutstop", .offset = RESOLVE_SERVICE_OFFSET(execute.timeout.stop) },
+    [E_RESOLVE_SERVICE_DOWN] = { .field = "down", .offset = RESOLVE_SERVICE_OFFSET(execute.down) },
+    [E_RESOLVE_SERVICE_DOWNSIGNAL] = { .field = "downsignal", .offset = RESOLVE_SERVICE_OFFSET(execute.downsignal) },
 
     // live
-    [E_RESOLVE_SERVICE_LIVEDIR] = { .field = "livedir" },
-    [E_RESOLVE_SERVICE_STATUS] = { .field = "status" },
-    [E_RESOLVE_SERVICE_SERVICEDIR_LIVE] = { .field = "servicedir" },
-    [E_RESOLVE_SERVICE_SCANDIR] = { .field = "scandirdir" },
-    [E_RESOLVE_SERVICE_STATEDIR] = { .field = "statedir" },
-    [E_RESOLVE_SERVICE_EVENTDIR] = { .field = "eventdir" },
-    [E_RESOLVE_SERVICE_NOTIFDIR] = { .field = "notifdir" },
-    [E_RESOLVE_SERVICE_SUPERVISEDIR] = { .field = "supervisedir" },
-    [E_RESOLVE_SERVICE_FDHOLDERDIR] = { .field = "fdholderdir" },
-    [E_RESOLVE_SERVICE_ONESHOTDDIR] = { .field = "oneshotddir" },
+    [E_RESOLVE_SERVICE_LIVEDIR] = { .field = "livedir", .offset = RESOLVE_SERVICE_OFFSET(live.livedir) },
+    [E_RESOLVE_SERVICE_STATUS] = { .field = "status", .offset = RESOLVE_SERVICE_OFFSET(live.status) },
+    [E_RESOLVE_SERVICE_SERVICEDIR_LIVE] = { .field = "servicedir", .offset = RESOLVE_SERVICE_OFFSET(live.servicedir) },
+    [E_RESOLVE_SERVICE_SCANDIR] = { .field = "scandirdir", .offset = RESOLVE_SERVICE_OFFSET(live.scandir) },
+    [E_RESOLVE_SERVICE_STATEDIR] = { .field = "statedir", .offset = RESOLVE_SERVICE_OFFSET(live.statedir) },
+    [E_RESOLVE_SERVICE_EVENTDIR] = { .field = "eventdir", .offset = RESOLVE_SERVICE_OFFSET(live.eventdir) },
+    [E_RESOLVE_SERVICE_NOTIFDIR] = { .field = "notifdir", .offset = RESOLVE_SERVICE_OFFSET(live.notifdir) },
+    [E_RESOLVE_SERVICE_SUPERVISEDIR] = { .field = "supervisedir", .offset = RESOLVE_SERVICE_OFFSET(live.supervisedir) },
+    [E_RESOLVE_SERVICE_FDHOLDERDIR] = { .field = "fdholderdir", .offset = RESOLVE_SERVICE_OFFSET(live.fdholderdir) },
+    [E_RESOLVE_SERVICE_ONESHOTDDIR] = { .field = "oneshotddir", .offset = RESOLVE_SERVICE_OFFSET(live.oneshotddir) },
 
     // logger
-    [E_RESOLVE_SERVICE_LOGNAME] = { .field = "logname" },
+    [E_RESOLVE_SERVICE_LOGNAME] = { .field = "logname", .offset = RESOLVE_SERVICE_OFFSET(logger.name) },
+    // not kept at the structure, see io.fdout.destination
     [E_RESOLVE_SERVICE_LOGDESTINATION] = { .field = "logdestination" },
-    [E_RESOLVE_SERVICE_LOGBACKUP] = { .field = "logbackup" },
-    [E_RESOLVE_SERVICE_LOGMAXSIZE] = { .field = "logmaxsize" },
-    [E_RESOLVE_SERVICE_LOGTIMESTAMP] = { .field = "logtimestamp" },
-    [E_RESOLVE_SERVICE_LOGWANT] = { .field = "logwant" },
-    [E_RESOLVE_SERVICE_LOGRUN] = { .field = "logrun" },
-    [E_RESOLVE_SERVICE_LOGRUN_USER] = { .field = "logrun_user" },
-    [E_RESOLVE_SERVICE_LOGRUN_BUILD] = { .field = "logrun_build" },
-    [E_RESOLVE_SERVICE_LOGRUN_RUNAS] = { .field = "logrun_runas" },
-    [E_RESOLVE_SERVICE_LOGTIMEOUTSTART] = { .field = "logtimeoutstart" },
-    [E_RESOLVE_SERVICE_LOGTIMEOUTSTOP] = { .field = "logtimeoutstop" },
+    [E_RESOLVE_SERVICE_LOGBACKUP] = { .field = "logbackup", .offset = RESOLVE_SERVICE_OFFSET(logger.backup) },
+    [E_RESOLVE_SERVICE_LOGMAXSIZE] = { .field = "logmaxsize", .offset = RESOLVE_SERVICE_OFFSET(logger.maxsize) },
+    [E_RESOLVE_SERVICE_LOGTIMESTAMP] = { .field = "logtimestamp", .offset = RESOLVE_SERVICE_OFFSET(logger.timestamp) },
+    [E_RESOLVE_SERVICE_LOGWANT] = { .field = "logwant", .offset = RESOLVE_SERVICE_OFFSET(logger.want) },
+    [E_RESOLVE_SERVICE_LOGRUN] = { .field = "logrun", .offset = RESOLVE_SERVICE_OFFSET(logger.execute.run.run) },
+    [E_RESOLVE_SERVICE_LOGRUN_USER] = { .field = "logrun_user", .offset = RESOLVE_SERVICE_OFFSET(logger.execute.run.run_user) },
+    [E_RESOLVE_SERVICE_LOGRUN_BUILD] = { .field = "logrun_build", .offset = RESOLVE_SERVICE_OFFSET(logger.execute.run.build) },
+    [E_RESOLVE_SERVICE_LOGRUN_RUNAS] = { .field = "logrun_runas", .offset = RESOLVE_SERVICE_OFFSET(logger.execute.run.runas) },
+    [E_RESOLVE_SERVICE_LOGTIMEOUTSTART] = { .field = "logtimeoutstart", .offset = RESOLVE_SERVICE_OFFSET(logger.timeout.start) },
+    [E_RESOLVE_SERVICE_LOGTIMEOUTSTOP] = { .field = "logtimeoutstop", .offset = RESOLVE_SERVICE_OFFSET(logger.timeout.stop) },
 
     // environment
-    [E_RESOLVE_SERVICE_ENV] = { .field = "env" },
-    [E_RESOLVE_SERVICE_ENVDIR] = { .field = "envdir" },
-    [E_RESOLVE_SERVICE_ENV_OVERWRITE] = { .field = "env_overwrite" },
+    [E_RESOLVE_SERVICE_ENV] = { .field = "env", .offset = RESOLVE_SERVICE_OFFSET(environ.env) },
+    [E_RESOLVE_SERVICE_ENVDIR] = { .field = "envdir", .offset = RESOLVE_SERVICE_OFFSET(environ.envdir) },
+    [E_RESOLVE_SERVICE_ENV_OVERWRITE] = { .field = "env_overwrite", .offset = RESOLVE_SERVICE_OFFSET(environ.env_overwrite) },
 
     // regex
-    [E_RESOLVE_SERVICE_REGEX_CONFIGURE] = { .field = "configure" },
-    [E_RESOLVE_SERVICE_REGEX_DIRECTORIES] = { .field = "directories" },
-    [E_RESOLVE_SERVICE_REGEX_FILES] = { .field = "files" },
-    [E_RESOLVE_SERVICE_REGEX_INFILES] = { .field = "infiles" },
-    [E_RESOLVE_SERVICE_REGEX_NDIRECTORIES] = { .field = "ndirectories" },
-    [E_RESOLVE_SERVICE_REGEX_NFILES] = { .field = "nfiles" },
-    [E_RESOLVE_SERVICE_REGEX_NINFILES] = { .field = "ninfiles" },
+    [E_RESOLVE_SERVICE_REGEX_CONFIGURE] = { .field = "configure", .offset = RESOLVE_SERVICE_OFFSET(regex.configure) },
+    [E_RESOLVE_SERVICE_REGEX_DIRECTORIES] = { .field = "directories", .offset = RESOLVE_SERVICE_OFFSET(regex.directories) },
+    [E_RESOLVE_SERVICE_REGEX_FILES] = { .field = "files", .offset = RESOLVE_SERVICE_OFFSET(regex.files) },
+    [E_RESOLVE_SERVICE_REGEX_INFILES] = { .field = "infiles", .offset = RESOLVE_SERVICE_OFFSET(regex.infiles) },
+    [E_RESOLVE_SERVICE_REGEX_NDIRECTORIES] = { .field = "ndirectories", .offset = RESOLVE_SERVICE_OFFSET(regex.ndirectories) },
+    [E_RESOLVE_SERVICE_REGEX_NFILES] = { .field = "nfiles", .offset = RESOLVE_SERVICE_OFFSET(regex.nfiles) },
+    [E_RESOLVE_SERVICE_REGEX_NINFILES] = { .field = "ninfiles", .offset = RESOLVE_SERVICE_OFFSET(regex.ninfiles) },
 
     // IO
-    [E_RESOLVE_SERVICE_STDIN] = { .field = "stdintype" },
-    [E_RESOLVE_SERVICE_STDINDEST] = { .field = "stdindest" },
-    [E_RESOLVE_SERVICE_STDOUT] = { .field = "stdouttype" },
-    [E_RESOLVE_SERVICE_STDOUTDEST] = { .field = "stdoutdest" },
-    [E_RESOLVE_SERVICE_STDERR] = { .field = "stderrtype" },
-    [E_RESOLVE_SERVICE_STDERRDEST] = { .field = "stderrdest" },
+    [E_RESOLVE_SERVICE_STDIN] = { .field = "stdintype", .offset = RESOLVE_SERVICE_OFFSET(io.fdin.type) },
+    [E_RESOLVE_SERVICE_STDINDEST] = { .field = "stdindest", .offset = RESOLVE_SERVICE_OFFSET(io.fdin.destination) },
+    [E_RESOLVE_SERVICE_STDOUT] = { .field = "stdouttype", .offset = RESOLVE_SERVICE_OFFSET(io.fdout.type) },
+    [E_RESOLVE_SERVICE_STDOUTDEST] = { .field = "stdoutdest", .offset = RESOLVE_SERVICE_OFFSET(io.fdout.destination) },
+    [E_RESOLVE_SERVICE_STDERR] = { .field = "stderrtype", .offset = RESOLVE_SERVICE_OFFSET(io.fderr.type) },
+    [E_RESOLVE_SERVICE_STDERRDEST] = { .field = "stderrdest", .offset = RESOLVE_SERVICE_OFFSET(io.fderr.destination) },
 
     [E_RESOLVE_SERVICE_ENDOFKEY] = { .field = 0 }
 } ;
@@ -0,0 +1,47 @@
+/*
+ * service_resolve_read_record.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <stdint.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/stralloc.h>
+
+#include <66/resolve.h>
+#include <66/service.h>
+
+/**
+ * Fill @res from the binary record @map of @len bytes, the string
+ * area is copied at res->sa. See service_resolve_view_record.
+ * */
+int service_resolve_read_record(char const *map, size_t len, resolve_service_t *res)
+{
+    log_flow() ;
+
+    stralloc sa = res->sa ;
+
+    if (!service_resolve_view_record(map, len, res)) {
+        res->sa = sa ;
+        return 0 ;
+    }
+
+    if (!stralloc_copyb(&sa, res->sa.s, res->sa.len)) {
+        res->sa = sa ;
+        return 0 ;
+    }
+
+    res->sa = sa ;
+
+    return 1 ;
+}
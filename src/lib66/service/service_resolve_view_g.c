@@ -0,0 +1,110 @@
+/*
+ * service_resolve_view_g.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>//free
+#include <unistd.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/djbunix.h>
+#include <skalibs/stralloc.h>
+
+#include <66/resolve.h>
+#include <66/service.h>
+#include <66/constants.h>
+
+/**
+ * Read-only counterpart of resolve_read_g for a service. The resolve
+ * file is mapped and @res points inside it, nothing is copied. A cdb
+ * resolve file not migrated yet is read as usual, @view then keeps
+ * its string area. @view is released and @res reset first, so both
+ * can be reused in a loop. @res must not be passed to resolve_free.
+ *
+ * Return 1 on success, 0 if the service does not exist or its resolve
+ * file is invalid, -1 on system error.
+ * */
+int service_resolve_view_g(resolve_view_t *view, resolve_service_t *res, char const *base, char const *name)
+{
+    log_flow() ;
+
+    int fd, r ;
+    struct stat st ;
+    char *map = 0 ;
+    size_t baselen = strlen(base), namelen = strlen(name) ;
+    char file[baselen + SS_SYSTEM_LEN + SS_RESOLVE_LEN + SS_SERVICE_LEN + 1 + namelen + SS_RESOLVE_LEN + 1 + namelen + 1] ;
+
+    /** the string area of @res belonged to the previous view, and no
+     * field of the previous service must survive a shorter record */
+    resolve_view_free(view) ;
+    *res = service_resolve_zero ;
+
+    auto_strings(file, base, SS_SYSTEM, SS_RESOLVE, SS_SERVICE, "/", name, SS_RESOLVE, "/", name) ;
+
+    fd = open_readb(file) ;
+    if (fd < 0)
+        return errno == ENOENT ? 0 : -1 ;
+
+    if (fstat(fd, &st) < 0) {
+        fd_close(fd) ;
+        log_warnusys_return(LOG_EXIT_LESSONE, "stat: ", file) ;
+    }
+
+    if (st.st_size >= (off_t)RESOLVE_RECORD_HEADER_LEN) {
+
+        map = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0) ;
+        if (map == MAP_FAILED) {
+            fd_close(fd) ;
+            log_warnusys_return(LOG_EXIT_LESSONE, "map: ", file) ;
+        }
+    }
+
+    fd_close(fd) ;
+
+    if (map && RESOLVE_ISRECORD(map, (size_t)st.st_size)) {
+
+        if (!service_resolve_view_record(map, st.st_size, res)) {
+            munmap(map, st.st_size) ;
+            log_warnu_return(LOG_EXIT_ZERO, "read resolve file: ", file) ;
+        }
+
+        view->map = map ;
+        view->len = st.st_size ;
+
+        return 1 ;
+    }
+
+    if (map)
+        munmap(map, st.st_size) ;
+
+    /** resolve file written before the binary record */
+    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, res) ;
+
+    r = resolve_read_g(wres, base, name) ;
+    free(wres) ;
+
+    if (r <= 0) {
+        stralloc_free(&res->sa) ;
+        return r ;
+    }
+
+    view->sa = res->sa ;
+
+    return 1 ;
+}
@@ -0,0 +1,135 @@
+/*
+ * service_resolve_view_record.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/uint32.h>
+
+#include <66/resolve.h>
+#include <66/service.h>
+
+/** fields holding a plain value, every other field of the table
+ * holds an offset inside the string area */
+static int field_isuint(uint32_t field)
+{
+    switch (field) {
+
+        case E_RESOLVE_SERVICE_TYPE:
+        case E_RESOLVE_SERVICE_NOTIFY:
+        case E_RESOLVE_SERVICE_MAXDEATH:
+        case E_RESOLVE_SERVICE_EARLIER:
+        case E_RESOLVE_SERVICE_OWNER:
+        case E_RESOLVE_SERVICE_ENABLED:
+        case E_RESOLVE_SERVICE_ISLOG:
+        case E_RESOLVE_SERVICE_NDEPENDS:
+        case E_RESOLVE_SERVICE_NREQUIREDBY:
+        case E_RESOLVE_SERVICE_NOPTSDEPS:
+        case E_RESOLVE_SERVICE_NCONTENTS:
+        case E_RESOLVE_SERVICE_TIMEOUTSTART:
+        case E_RESOLVE_SERVICE_TIMEOUTSTOP:
+        case E_RESOLVE_SERVICE_DOWN:
+        case E_RESOLVE_SERVICE_DOWNSIGNAL:
+        case E_RESOLVE_SERVICE_LOGBACKUP:
+        case E_RESOLVE_SERVICE_LOGMAXSIZE:
+        case E_RESOLVE_SERVICE_LOGTIMESTAMP:
+        case E_RESOLVE_SERVICE_LOGWANT:
+        case E_RESOLVE_SERVICE_LOGTIMEOUTSTART:
+        case E_RESOLVE_SERVICE_LOGTIMEOUTSTOP:
+        case E_RESOLVE_SERVICE_ENV_OVERWRITE:
+        case E_RESOLVE_SERVICE_REGEX_NDIRECTORIES:
+        case E_RESOLVE_SERVICE_REGEX_NFILES:
+        case E_RESOLVE_SERVICE_REGEX_NINFILES:
+        case E_RESOLVE_SERVICE_STDIN:
+        case E_RESOLVE_SERVICE_STDINDEST:
+        case E_RESOLVE_SERVICE_STDOUT:
+        case E_RESOLVE_SERVICE_STDOUTDEST:
+        case E_RESOLVE_SERVICE_STDERR:
+        case E_RESOLVE_SERVICE_STDERRDEST:
+            return 1 ;
+
+        default:
+            return 0 ;
+    }
+}
+
+/**
+ * Fill @res from the binary record @map of @len bytes written by
+ * service_resolve_write_record without copying it: the string area
+ * of @res points inside @map and must not be grown or freed.
+ *
+ * Fields unknown by the writer keep the value of @res, fields unknown
+ * by the reader are ignored. Every string offset is checked against
+ * the string area before @res is touched. Return 0 with errno set on
+ * a bad record.
+ * */
+int service_resolve_view_record(char const *map, size_t len, resolve_service_t *res)
+{
+    log_flow() ;
+
+    uint32_t version = 0, nfield = 0, salen = 0, pos = 0 ;
+    char const *s = map + RESOLVE_RECORD_MAGIC_LEN, *sa = 0 ;
+
+    if (!RESOLVE_ISRECORD(map, len))
+        return (errno = EINVAL, 0) ;
+
+    uint32_unpack_big(s, &version) ;
+    uint32_unpack_big(s + 4, &nfield) ;
+    uint32_unpack_big(s + 8, &salen) ;
+    s += 12 ;
+
+    if (version != RESOLVE_RECORD_VERSION)
+        return (errno = EPROTO, 0) ;
+
+    /** the string area must be the exact remainder of the record
+     * and end with a NUL */
+    if (nfield > (len - RESOLVE_RECORD_HEADER_LEN) >> 2 ||
+        len - RESOLVE_RECORD_HEADER_LEN - ((size_t)nfield << 2) != salen ||
+        !salen || map[len - 1])
+            return (errno = EINVAL, 0) ;
+
+    sa = s + ((size_t)nfield << 2) ;
+
+    if (nfield > E_RESOLVE_SERVICE_ENDOFKEY)
+        nfield = E_RESOLVE_SERVICE_ENDOFKEY ;
+
+    for (; pos < nfield ; pos++) {
+
+        uint32_t value = 0 ;
+
+        if (!resolve_service_field_table[pos].offset || field_isuint(pos))
+            continue ;
+
+        uint32_unpack_big(s + (pos << 2), &value) ;
+        if (value >= salen)
+            return (errno = EINVAL, 0) ;
+    }
+
+    res->sa.s = (char *)sa ;
+    res->sa.len = salen ;
+    res->sa.a = 0 ;
+
+    for (pos = 0 ; pos < nfield ; pos++, s += 4) {
+
+        size_t offset = resolve_service_field_table[pos].offset ;
+        if (offset)
+            uint32_unpack_big(s, (uint32_t *)((char *)res + offset)) ;
+    }
+
+    return 1 ;
+}
@@ -0,0 +1,70 @@
+/*
+ * service_resolve_write_record.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>//free
+
+#include <oblibs/log.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/uint32.h>
+
+#include <66/resolve.h>
+#include <66/service.h>
+
+/**
+ * Append to @sa the binary record of @res.
+ *
+ * The record is made of a header holding the magic, the version of
+ * the format, the number of fields and the length of the string area,
+ * followed by the fields as big endian uint32 in resolve_service_enum_t
+ * order, followed by the string area itself.
+ * */
+int service_resolve_write_record(stralloc *sa, resolve_service_t *res)
+{
+    log_flow() ;
+
+    uint32_t pos = 0, value = 0 ;
+    size_t len = RESOLVE_RECORD_HEADER_LEN + (E_RESOLVE_SERVICE_ENDOFKEY << 2) ;
+    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_SERVICE, res) ;
+
+    log_trace("resolve file version for: ", res->sa.s + res->name, " set to: ", SS_VERSION) ;
+    res->rversion = resolve_add_string(wres, SS_VERSION) ;
+    free(wres) ;
+
+    if (!stralloc_readyplus(sa, len + res->sa.len))
+        return 0 ;
+
+    char *s = sa->s + sa->len ;
+
+    memcpy(s, RESOLVE_RECORD_MAGIC, RESOLVE_RECORD_MAGIC_LEN) ;
+    s += RESOLVE_RECORD_MAGIC_LEN ;
+    uint32_pack_big(s, RESOLVE_RECORD_VERSION) ;
+    uint32_pack_big(s + 4, E_RESOLVE_SERVICE_ENDOFKEY) ;
+    uint32_pack_big(s + 8, (uint32_t)res->sa.len) ;
+    s += 12 ;
+
+    for (; pos < E_RESOLVE_SERVICE_ENDOFKEY ; pos++, s += 4) {
+
+        size_t offset = resolve_service_field_table[pos].offset ;
+        value = offset ? *(uint32_t *)((char *)res + offset) : 0 ;
+        uint32_pack_big(s, value) ;
+    }
+
+    memcpy(s, res->sa.s, res->sa.len) ;
+    sa->len += len + res->sa.len ;
+
+    return 1 ;
+}
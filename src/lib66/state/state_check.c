@@ -25,8 +25,13 @@
 int state_check(resolve_service_t *res)
 {
     log_flow() ;
+
+    ss_state_t sta = STATE_ZERO ;
     char status[strlen(res->sa.s + res->live.statedir) + 1 + SS_STATUS_LEN + 1] ;
 
+    if (state_table_read(&sta, res) > 0)
+        return 1 ;
+
     auto_strings(status, res->sa.s + res->live.statedir, "/", SS_STATUS) ;
 
     if (access(status, F_OK) < 0 && access(res->sa.s + res->live.status, F_OK) < 0)
@@ -0,0 +1,83 @@
+/*
+ * state_latency.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/uint32.h>
+#include <skalibs/djbunix.h>
+
+#include <66/state.h>
+#include <66/constants.h>
+#include <66/service.h>
+
+/** The latency file lives next to the status file of the service, at
+ * the system directory, so it survives a reboot. It contains the
+ * smoothed duration in milliseconds of the last up transitions. */
+static void latency_path(char *dst, resolve_service_t *res)
+{
+    char const *status = res->sa.s + res->live.status ;
+    size_t len = strlen(status) - SS_STATUS_LEN ;
+
+    memcpy(dst, status, len) ;
+    auto_strings(dst + len, SS_LATENCY) ;
+}
+
+uint32_t state_read_latency(resolve_service_t *res)
+{
+    log_flow() ;
+
+    uint32_t ms = 0 ;
+    char pack[4] ;
+    char path[strlen(res->sa.s + res->live.status) + SS_LATENCY_LEN + 1] ;
+
+    latency_path(path, res) ;
+
+    if (openreadnclose(path, pack, 4) < 4)
+        return 0 ;
+
+    uint32_unpack_big(pack, &ms) ;
+
+    return ms ;
+}
+
+int state_write_latency(resolve_service_t *res, uint32_t ms)
+{
+    log_flow() ;
+
+    uint32_t old = state_read_latency(res) ;
+    char pack[4] ;
+    char fmt[UINT32_FMT] ;
+    char path[strlen(res->sa.s + res->live.status) + SS_LATENCY_LEN + 1] ;
+
+    latency_path(path, res) ;
+
+    /** smooth the value, one slow start must not reorder the next boot */
+    if (old)
+        ms = (uint32_t)(((uint64_t)old * 3 + ms) / 4) ;
+
+    fmt[uint32_fmt(fmt, ms)] = 0 ;
+    log_trace("write latency of: ", res->sa.s + res->name, " at: ", path, " -- ", fmt, "ms") ;
+
+    uint32_pack_big(pack, ms) ;
+
+    if (!openwritenclose_unsafe(path, pack, 4))
+        log_warnusys_return(LOG_EXIT_ZERO, "write latency file: ", path) ;
+
+    return 1 ;
+}
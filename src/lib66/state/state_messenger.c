@@ -22,8 +22,20 @@ int state_messenger(resolve_service_t *res, uint32_t flag, uint32_t value)
 {
     log_flow() ;
 
+    int r ;
     ss_state_t sta = STATE_ZERO ;
 
+    /** a service living at the live directory owns a slot of the
+     * state table, flip the flag in place */
+    r = state_table_set_flag(res, flag, value) ;
+    if (r > 0) {
+        state_notify(res) ;
+        return 1 ;
+    }
+
+    if (r < 0)
+        log_warnusys_return(LOG_EXIT_ZERO, "write state of: ", res->sa.s + res->name, " at the state table") ;
+
     if (!state_read(&sta, res))
         log_warnu_return(LOG_EXIT_ZERO, "read status file of: ", res->sa.s + res->name) ;
 
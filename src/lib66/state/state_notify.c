@@ -0,0 +1,39 @@
+/*
+ * state_notify.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <s6/ftrigw.h>
+
+#include <66/state.h>
+#include <66/constants.h>
+#include <66/service.h>
+
+/** Wake up the processes watching the state of the services of the
+ * owner of @res, e.g. 66 status -w. Nothing is done if nobody ever
+ * watched them as the event directory does not exist. */
+void state_notify(resolve_service_t *res)
+{
+    log_flow() ;
+
+    size_t livelen = strlen(res->sa.s + res->live.livedir) ;
+    size_t ownerlen = strlen(res->sa.s + res->ownerstr) ;
+    char event[livelen + SS_STATE_LEN + 1 + ownerlen + SS_STATE_EVENT_LEN + 1] ;
+
+    auto_strings(event, res->sa.s + res->live.livedir, SS_STATE + 1, "/", res->sa.s + res->ownerstr, SS_STATE_EVENT) ;
+
+    ftrigw_notify(event, 's') ;
+}
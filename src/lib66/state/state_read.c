@@ -23,29 +23,40 @@
 #include <66/state.h>
 #include <66/constants.h>
 #include <66/service.h>
+#include <66/resolve.h>
 
 int state_read(ss_state_t *sta, resolve_service_t *res)
 {
     log_flow() ;
 
     int r ;
-    char pack[STATE_STATE_SIZE] ;
-    char *path = 0 ;
+    char const *pack = 0 ;
+    size_t len = 0 ;
     char status[strlen(res->sa.s + res->live.statedir) + 1 + SS_STATUS_LEN + 1] ;
 
+    r = state_table_read(sta, res) ;
+    if (r > 0)
+        return 1 ;
+
     auto_strings(status, res->sa.s + res->live.statedir, "/", SS_STATUS) ;
 
-    if (access(status, F_OK) < 0) {
-        path = res->sa.s + res->live.status ;
-    } else {
-        path = status ;
+    /** state files are cached as resolve files are */
+    r = resolve_cache_get(status, &pack, &len) ;
+    if (r > 0 && len >= STATE_STATE_SIZE) {
+
+        /** status file copied at the live directory by sanitize_livestate,
+         * it stays the source until state_write() imports it at the table.
+         * Reading never claims a slot */
+        state_unpack((char *)pack, sta) ;
+
+        return 1 ;
     }
 
-    r = openreadnclose(path, pack, STATE_STATE_SIZE) ;
-    if (r < STATE_STATE_SIZE || r < 0)
+    r = resolve_cache_get(res->sa.s + res->live.status, &pack, &len) ;
+    if (r <= 0 || len < STATE_STATE_SIZE)
         return 0 ;
 
-    state_unpack(pack, sta) ;
+    state_unpack((char *)pack, sta) ;
 
     return 1 ;
 }
@@ -0,0 +1,177 @@
+/*
+ * state_read_array.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/stralloc.h>
+#include <skalibs/allreadwrite.h>
+#include <skalibs/djbunix.h>
+
+#include <66/state.h>
+#include <66/constants.h>
+#include <66/service.h>
+
+/** directory holding the state directories of the services
+ * e.g. /run/66/state/0, opened once for a selection */
+typedef struct state_root_s state_root_t ;
+struct state_root_s
+{
+    stralloc path ;
+    int fd ;
+    uint8_t opened ;
+} ;
+
+#define STATE_ROOT_ZERO { STRALLOC_ZERO, -1, 0 }
+
+/** @dir is <root>/<name>/state, give back the descriptor of <root> */
+static int root_get(state_root_t *root, char const *dir, char const *name)
+{
+    size_t dirlen = strlen(dir), namelen = strlen(name) ;
+
+    if (dirlen < 1 + namelen + SS_STATE_LEN)
+        return -1 ;
+
+    size_t len = dirlen - 1 - namelen - SS_STATE_LEN ;
+
+    if (root->opened && root->path.len == len + 1 && !memcmp(root->path.s, dir, len))
+        return root->fd ;
+
+    if (root->fd >= 0)
+        close(root->fd) ;
+
+    root->fd = -1 ;
+    root->opened = 0 ;
+    root->path.len = 0 ;
+
+    if (!stralloc_catb(&root->path, dir, len) ||
+        !stralloc_0(&root->path))
+            log_die_nomem("stralloc") ;
+
+    root->fd = open(root->path.s, O_RDONLY | O_DIRECTORY | O_CLOEXEC) ;
+    root->opened = 1 ;
+
+    return root->fd ;
+}
+
+static void root_close(state_root_t *root)
+{
+    if (root->fd >= 0)
+        close(root->fd) ;
+
+    stralloc_free(&root->path) ;
+}
+
+/** Return 1 on success, 0 if the file does not exist, -1 on error. */
+static int read_at(ss_state_t *sta, int dfd, char const *name)
+{
+    int fd ;
+    size_t r ;
+    char pack[STATE_STATE_SIZE] ;
+    char file[strlen(name) + SS_STATE_LEN + 1 + SS_STATUS_LEN + 1] ;
+
+    if (dfd < 0)
+        return 0 ;
+
+    auto_strings(file, name, SS_STATE, "/", SS_STATUS) ;
+
+    fd = openat(dfd, file, O_RDONLY | O_CLOEXEC) ;
+    if (fd < 0)
+        return errno == ENOENT || errno == ENOTDIR ? 0 : -1 ;
+
+    r = allread(fd, pack, STATE_STATE_SIZE) ;
+    fd_close(fd) ;
+
+    if (r < STATE_STATE_SIZE)
+        return 0 ;
+
+    state_unpack(pack, sta) ;
+
+    return 1 ;
+}
+
+/**
+ * Read the state of the @n services of @res in one pass, @sta[i]
+ * receiving the state of @res[i]. The state table is looked up first,
+ * then the status files through their directories opened once for
+ * the whole selection. @found[i] tells if a state exists for @res[i],
+ * @found can be 0.
+ *
+ * Return the number of states read, -1 on error.
+ * */
+int state_read_array(ss_state_t *sta, uint8_t *found, resolve_service_t *const *res, unsigned int n)
+{
+    log_flow() ;
+
+    int r, e = -1 ;
+    unsigned int pos = 0, nfound = 0 ;
+    state_root_t live = STATE_ROOT_ZERO, system = STATE_ROOT_ZERO ;
+    ss_state_t zero = STATE_ZERO ;
+
+    for (; pos < n ; pos++) {
+
+        resolve_service_t *pres = res[pos] ;
+        char *name = pres->sa.s + pres->name ;
+
+        sta[pos] = zero ;
+
+        if (found)
+            found[pos] = 0 ;
+
+        r = state_table_read(&sta[pos], pres) ;
+
+        if (!r) {
+
+            /** not imported yet, state_write() claims the slot */
+            r = read_at(&sta[pos], root_get(&live, pres->sa.s + pres->live.statedir, name), name) ;
+        }
+
+        if (!r) {
+
+            /** <root>/<name>/state/status */
+            size_t len = strlen(pres->sa.s + pres->live.status) ;
+            char dir[len + 1] ;
+
+            auto_strings(dir, pres->sa.s + pres->live.status) ;
+
+            if (len > SS_STATUS_LEN + 1) {
+                dir[len - SS_STATUS_LEN - 1] = 0 ;
+                r = read_at(&sta[pos], root_get(&system, dir, name), name) ;
+            }
+        }
+
+        if (r < 0) {
+            log_warnusys("read state of: ", name) ;
+            goto err ;
+        }
+
+        if (r) {
+            nfound++ ;
+            if (found)
+                found[pos] = 1 ;
+        }
+    }
+
+    e = (int)nfound ;
+
+    err:
+        root_close(&live) ;
+        root_close(&system) ;
+        return e ;
+}
@@ -32,6 +32,8 @@ void state_rmfile(resolve_service_t *res)
 
     auto_strings(status, res->sa.s + res->live.statedir, "/", SS_STATUS) ;
 
+    state_table_release(res) ;
+
     if (access(status, F_OK) < 0) {
         unlink_void(res->sa.s + res->live.status) ;
     } else {
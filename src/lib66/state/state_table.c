@@ -0,0 +1,591 @@
+/*
+ * state_table.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/djbunix.h>
+
+#include <66/state.h>
+#include <66/constants.h>
+#include <66/config.h>
+#include <66/service.h>
+#include <66/hash.h>
+
+/**
+ * The table of an owner lives at <live>/state/<owner>/.table. It holds
+ * STATE_TABLE_NSLOT slots, a service keeps its slot, so its id, as long
+ * as its live directory exists. The slot of a service is found by
+ * hashing its name, probing the next slots on collision: a lookup
+ * stops at the first empty slot, so a released slot is kept as a
+ * tombstone for the probes going through it. A tombstone followed by
+ * an empty slot ends every probe anyway, it becomes empty again. The fields of a slot are
+ * accessed atomically, a slot is claimed or released under the exclusive
+ * lock of the table and published by its used field written last. A
+ * write holds the shared lock, so the slot found cannot be given to
+ * another service before the store. A read takes no lock and checks the
+ * owner of the slot after loading it.
+ *
+ * At most three quarter of the slots are used at once to keep the
+ * probes short. A service finding no free slot keeps its state at its
+ * status file as before the table existed.
+ * */
+
+#define STATE_TABLE_MAGIC "66st"
+#define STATE_TABLE_VERSION 2
+#define STATE_TABLE_NSLOT (SS_MAX_SERVICE * 2)
+#define STATE_TABLE_NUSED (STATE_TABLE_NSLOT / 4 * 3)
+
+/** values of the used field of a slot */
+#define STATE_TABLE_EMPTY 0
+#define STATE_TABLE_USED 1
+#define STATE_TABLE_RELEASED 2
+#define STATE_TABLE_CLAIMED 3
+
+typedef struct state_table_header_s state_table_header_t ;
+struct state_table_header_s
+{
+    char magic[4] ;
+    uint32_t version ;
+    uint32_t nslot ;
+    uint32_t slotlen ;
+    uint32_t nused ; // slots currently owned, written under the lock
+} ;
+
+typedef struct state_table_slot_s state_table_slot_t ;
+struct state_table_slot_s
+{
+    uint32_t used ;
+    ss_state_t sta ;
+    char name[SS_MAX_SERVICE_NAME + 1] ;
+} ;
+
+#define STATE_TABLE_LEN (sizeof(state_table_header_t) + STATE_TABLE_NSLOT * sizeof(state_table_slot_t))
+
+struct state_table_id_s {
+    char *name ; // key
+    uint32_t id ;
+    UT_hash_handle hh ;
+} ;
+
+struct state_table_s {
+    char *file ; // key
+    int fd ;
+    uint8_t rdonly ;
+    char *map ;
+    struct state_table_id_s *ids ;
+    UT_hash_handle hh ;
+} ;
+
+static struct state_table_s *tables = NULL ;
+
+#define STATE_TABLE_SLOT(t, id) ((state_table_slot_t *)((t)->map + sizeof(state_table_header_t)) + (id))
+#define STATE_TABLE_HEADER(t) ((state_table_header_t *)(t)->map)
+
+/** FNV-1a */
+static uint32_t table_hash(char const *name)
+{
+    uint32_t h = 2166136261u ;
+
+    for (; *name ; name++) {
+        h ^= (unsigned char)*name ;
+        h *= 16777619u ;
+    }
+
+    return h % STATE_TABLE_NSLOT ;
+}
+
+static uint32_t *table_field(ss_state_t *sta, int flag)
+{
+    switch (flag)
+    {
+        case STATE_FLAGS_TOINIT: return &sta->toinit ;
+        case STATE_FLAGS_TORELOAD: return &sta->toreload ;
+        case STATE_FLAGS_TORESTART: return &sta->torestart ;
+        case STATE_FLAGS_TOUNSUPERVISE: return &sta->tounsupervise ;
+        case STATE_FLAGS_TOPARSE: return &sta->toparse ;
+        case STATE_FLAGS_ISPARSED: return &sta->isparsed ;
+        case STATE_FLAGS_ISSUPERVISED: return &sta->issupervised ;
+        case STATE_FLAGS_ISUP: return &sta->isup ;
+        default: return 0 ;
+    }
+}
+
+static int table_isvalid(char const *map)
+{
+    state_table_header_t const *h = (state_table_header_t const *)map ;
+
+    return !memcmp(h->magic, STATE_TABLE_MAGIC, 4) &&
+        h->version == STATE_TABLE_VERSION &&
+        h->nslot == STATE_TABLE_NSLOT &&
+        h->slotlen == sizeof(state_table_slot_t) ;
+}
+
+/** write a fresh header, the caller holds the lock */
+static int table_format(int fd)
+{
+    state_table_header_t h ;
+
+    memcpy(h.magic, STATE_TABLE_MAGIC, 4) ;
+    h.version = STATE_TABLE_VERSION ;
+    h.nslot = STATE_TABLE_NSLOT ;
+    h.slotlen = sizeof(state_table_slot_t) ;
+    h.nused = 0 ;
+
+    if (ftruncate(fd, 0) < 0 || ftruncate(fd, STATE_TABLE_LEN) < 0)
+        return 0 ;
+
+    if (pwrite(fd, &h, sizeof(h), 0) != sizeof(h))
+        return 0 ;
+
+    return 1 ;
+}
+
+/**
+ * Give at @table the mapped table of the owner of @res, creating the
+ * file if @create is set.
+ *
+ * Return 1 on success, 0 if the table does not exist, -1 on error.
+ * */
+static int table_get(struct state_table_s **table, resolve_service_t *res, uint8_t create)
+{
+    struct stat st ;
+    struct state_table_s *t = NULL ;
+    size_t livelen = strlen(res->sa.s + res->live.livedir) ;
+    size_t ownerlen = strlen(res->sa.s + res->ownerstr) ;
+    char file[livelen + SS_STATE_LEN + 1 + ownerlen + SS_STATE_TABLE_LEN + 1] ;
+
+    auto_strings(file, res->sa.s + res->live.livedir, SS_STATE + 1, "/", res->sa.s + res->ownerstr, SS_STATE_TABLE) ;
+
+    HASH_FIND_STR(tables, file, t) ;
+
+    if (t && (!create || !t->rdonly)) {
+        *table = t ;
+        return 1 ;
+    }
+
+    int fd = -1 ;
+    uint8_t rdonly = 0 ;
+
+    if (create) {
+
+        fd = open(file, O_RDWR | O_CREAT | O_CLOEXEC, 0644) ;
+
+    } else {
+
+        fd = open(file, O_RDWR | O_CLOEXEC) ;
+        if (fd < 0 && errno == EACCES) {
+            fd = open(file, O_RDONLY | O_CLOEXEC) ;
+            rdonly = 1 ;
+        }
+    }
+
+    if (fd < 0)
+        return errno == ENOENT ? 0 : -1 ;
+
+    if (fstat(fd, &st) < 0)
+        goto err ;
+
+    if ((size_t)st.st_size != STATE_TABLE_LEN) {
+
+        if (!create) {
+            /** not yet formatted by its creator */
+            close(fd) ;
+            return 0 ;
+        }
+
+        if (fd_lock(fd, 1, 0) < 1)
+            goto err ;
+
+        if (fstat(fd, &st) < 0 || ((size_t)st.st_size != STATE_TABLE_LEN && !table_format(fd))) {
+            fd_unlock(fd) ;
+            goto err ;
+        }
+
+        fd_unlock(fd) ;
+    }
+
+    char *map = mmap(0, STATE_TABLE_LEN, rdonly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) ;
+    if (map == MAP_FAILED)
+        goto err ;
+
+    if (!table_isvalid(map)) {
+
+        if (!create) {
+            munmap(map, STATE_TABLE_LEN) ;
+            close(fd) ;
+            return 0 ;
+        }
+
+        /** written by a build with a different layout */
+        if (fd_lock(fd, 1, 0) < 1 || (!table_isvalid(map) && !table_format(fd))) {
+            munmap(map, STATE_TABLE_LEN) ;
+            goto err ;
+        }
+
+        fd_unlock(fd) ;
+    }
+
+    if (t) {
+        /** replace the read-only mapping */
+        munmap(t->map, STATE_TABLE_LEN) ;
+        close(t->fd) ;
+
+    } else {
+
+        t = (struct state_table_s *)malloc(sizeof(*t)) ;
+        if (t == NULL) {
+            munmap(map, STATE_TABLE_LEN) ;
+            goto err ;
+        }
+
+        memset(t, 0, sizeof(*t)) ;
+
+        t->file = strdup(file) ;
+        if (t->file == NULL) {
+            free(t) ;
+            munmap(map, STATE_TABLE_LEN) ;
+            goto err ;
+        }
+
+        HASH_ADD_KEYPTR(hh, tables, t->file, strlen(t->file), t) ;
+    }
+
+    t->fd = fd ;
+    t->rdonly = rdonly ;
+    t->map = map ;
+    *table = t ;
+
+    return 1 ;
+
+    err:
+        close(fd) ;
+        return -1 ;
+}
+
+/**
+ * Return the id of @name at @t or -1 if the service
+ * does not own a slot. The id known by the process is
+ * checked against the slot as another process may have
+ * released it.
+ * */
+static int32_t table_find(struct state_table_s *t, char const *name)
+{
+    uint32_t id = 0, n = 0, used ;
+    state_table_slot_t *slot ;
+    struct state_table_id_s *c = NULL ;
+
+    HASH_FIND_STR(t->ids, name, c) ;
+
+    if (c) {
+
+        slot = STATE_TABLE_SLOT(t, c->id) ;
+
+        if (__atomic_load_n(&slot->used, __ATOMIC_ACQUIRE) == STATE_TABLE_USED && !strcmp(slot->name, name))
+            return (int32_t)c->id ;
+
+        HASH_DEL(t->ids, c) ;
+        free(c->name) ;
+        free(c) ;
+    }
+
+    for (id = table_hash(name) ; n < STATE_TABLE_NSLOT ; n++, id = (id + 1) % STATE_TABLE_NSLOT) {
+
+        slot = STATE_TABLE_SLOT(t, id) ;
+        used = __atomic_load_n(&slot->used, __ATOMIC_ACQUIRE) ;
+
+        if (used == STATE_TABLE_EMPTY)
+            break ;
+
+        if (used != STATE_TABLE_USED || strcmp(slot->name, name))
+            continue ;
+
+        c = (struct state_table_id_s *)malloc(sizeof(*c)) ;
+        if (c) {
+            c->name = strdup(name) ;
+            if (c->name == NULL) {
+                free(c) ;
+            } else {
+                c->id = id ;
+                HASH_ADD_KEYPTR(hh, t->ids, c->name, strlen(c->name), c) ;
+            }
+        }
+
+        return (int32_t)id ;
+    }
+
+    return -1 ;
+}
+
+/** Claim a slot for @name, the caller holds the lock and checked
+ * that @name does not own one. Return its id, -1 if the table is full */
+static int32_t table_claim(struct state_table_s *t, char const *name)
+{
+    uint32_t id = 0, n = 0, used ;
+    state_table_slot_t *slot ;
+    state_table_header_t *h = STATE_TABLE_HEADER(t) ;
+
+    if (__atomic_load_n(&h->nused, __ATOMIC_RELAXED) >= STATE_TABLE_NUSED)
+        return -1 ;
+
+    for (id = table_hash(name) ; n < STATE_TABLE_NSLOT ; n++, id = (id + 1) % STATE_TABLE_NSLOT) {
+
+        slot = STATE_TABLE_SLOT(t, id) ;
+        used = __atomic_load_n(&slot->used, __ATOMIC_ACQUIRE) ;
+
+        if (used != STATE_TABLE_EMPTY && used != STATE_TABLE_RELEASED)
+            continue ;
+
+        /** keep the probes going through it while the name changes */
+        __atomic_store_n(&slot->used, STATE_TABLE_CLAIMED, __ATOMIC_RELEASE) ;
+        memset(slot->name, 0, sizeof(slot->name)) ;
+        auto_strings(slot->name, name) ;
+        __atomic_store_n(&h->nused, __atomic_load_n(&h->nused, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED) ;
+
+        return (int32_t)id ;
+    }
+
+    return -1 ;
+}
+
+/** Empty the tombstones ending at @id, no probe goes through them
+ * when the next slot is empty. The caller holds the lock */
+static void table_reclaim(struct state_table_s *t, uint32_t id)
+{
+    uint32_t n = 0 ;
+
+    if (__atomic_load_n(&STATE_TABLE_SLOT(t, (id + 1) % STATE_TABLE_NSLOT)->used, __ATOMIC_ACQUIRE) != STATE_TABLE_EMPTY)
+        return ;
+
+    for (; n < STATE_TABLE_NSLOT ; n++, id = (id + STATE_TABLE_NSLOT - 1) % STATE_TABLE_NSLOT) {
+
+        state_table_slot_t *slot = STATE_TABLE_SLOT(t, id) ;
+
+        if (__atomic_load_n(&slot->used, __ATOMIC_ACQUIRE) != STATE_TABLE_RELEASED)
+            break ;
+
+        __atomic_store_n(&slot->used, STATE_TABLE_EMPTY, __ATOMIC_RELEASE) ;
+    }
+}
+
+static void table_load(ss_state_t *sta, state_table_slot_t *slot)
+{
+    sta->toinit = __atomic_load_n(&slot->sta.toinit, __ATOMIC_RELAXED) ;
+    sta->toreload = __atomic_load_n(&slot->sta.toreload, __ATOMIC_RELAXED) ;
+    sta->torestart = __atomic_load_n(&slot->sta.torestart, __ATOMIC_RELAXED) ;
+    sta->tounsupervise = __atomic_load_n(&slot->sta.tounsupervise, __ATOMIC_RELAXED) ;
+    sta->toparse = __atomic_load_n(&slot->sta.toparse, __ATOMIC_RELAXED) ;
+    sta->isparsed = __atomic_load_n(&slot->sta.isparsed, __ATOMIC_RELAXED) ;
+    sta->issupervised = __atomic_load_n(&slot->sta.issupervised, __ATOMIC_RELAXED) ;
+    sta->isup = __atomic_load_n(&slot->sta.isup, __ATOMIC_RELAXED) ;
+}
+
+static void table_store(state_table_slot_t *slot, ss_state_t *sta)
+{
+    __atomic_store_n(&slot->sta.toinit, sta->toinit, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.toreload, sta->toreload, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.torestart, sta->torestart, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.tounsupervise, sta->tounsupervise, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.toparse, sta->toparse, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.isparsed, sta->isparsed, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.issupervised, sta->issupervised, __ATOMIC_RELAXED) ;
+    __atomic_store_n(&slot->sta.isup, sta->isup, __ATOMIC_RELAXED) ;
+}
+
+/** Return 1 on success, 0 if the service does not own a slot, -1 on error. */
+int state_table_read(ss_state_t *sta, resolve_service_t *res)
+{
+    log_flow() ;
+
+    int r ;
+    int32_t id ;
+    state_table_slot_t *slot ;
+    struct state_table_s *t = NULL ;
+
+    r = table_get(&t, res, 0) ;
+    if (r <= 0)
+        return r ;
+
+    id = table_find(t, res->sa.s + res->name) ;
+    if (id < 0)
+        return 0 ;
+
+    slot = STATE_TABLE_SLOT(t, id) ;
+    table_load(sta, slot) ;
+
+    /** released and given to another service while loading */
+    if (__atomic_load_n(&slot->used, __ATOMIC_ACQUIRE) != STATE_TABLE_USED || strcmp(slot->name, res->sa.s + res->name))
+        return 0 ;
+
+    return 1 ;
+}
+
+/**
+ * Write @sta at the slot of @res. A missing slot is claimed
+ * if @create is set.
+ *
+ * Return 1 on success, 0 if the service does not own a slot
+ * and @create is not set or no slot can be given to it, -1 on error.
+ * */
+int state_table_write(ss_state_t *sta, resolve_service_t *res, uint8_t create)
+{
+    log_flow() ;
+
+    int r ;
+    int32_t id ;
+    char const *name = res->sa.s + res->name ;
+    struct state_table_s *t = NULL ;
+
+    if (strlen(name) > SS_MAX_SERVICE_NAME)
+        return 0 ;
+
+    r = table_get(&t, res, create) ;
+    if (r <= 0)
+        return r ;
+
+    if (t->rdonly) {
+
+        if (table_find(t, name) < 0)
+            return 0 ;
+
+        errno = EACCES ;
+        return -1 ;
+    }
+
+    if (fd_lock(t->fd, 0, 0) < 1)
+        return -1 ;
+
+    id = table_find(t, name) ;
+
+    if (id >= 0) {
+
+        table_store(STATE_TABLE_SLOT(t, id), sta) ;
+        fd_unlock(t->fd) ;
+        return 1 ;
+    }
+
+    fd_unlock(t->fd) ;
+
+    /** a full table is not worth the lock */
+    if (!create || __atomic_load_n(&STATE_TABLE_HEADER(t)->nused, __ATOMIC_RELAXED) >= STATE_TABLE_NUSED)
+        return 0 ;
+
+    if (fd_lock(t->fd, 1, 0) < 1)
+        return -1 ;
+
+    /** claimed by another process while waiting for the lock */
+    id = table_find(t, name) ;
+
+    if (id < 0) {
+
+        id = table_claim(t, name) ;
+        if (id < 0) {
+            fd_unlock(t->fd) ;
+            return 0 ;
+        }
+
+        table_store(STATE_TABLE_SLOT(t, id), sta) ;
+        __atomic_store_n(&STATE_TABLE_SLOT(t, id)->used, STATE_TABLE_USED, __ATOMIC_RELEASE) ;
+
+    } else {
+
+        table_store(STATE_TABLE_SLOT(t, id), sta) ;
+    }
+
+    fd_unlock(t->fd) ;
+
+    return 1 ;
+}
+
+/**
+ * Set @flag to @value at the slot of @res, the other
+ * fields of the slot are left untouched.
+ *
+ * Return 1 on success, 0 if the service does not own a slot, -1 on error.
+ * */
+int state_table_set_flag(resolve_service_t *res, int flag, uint32_t value)
+{
+    log_flow() ;
+
+    int r ;
+    int32_t id ;
+    uint32_t *field = 0 ;
+    struct state_table_s *t = NULL ;
+
+    r = table_get(&t, res, 0) ;
+    if (r <= 0)
+        return r ;
+
+    if (t->rdonly) {
+
+        if (table_find(t, res->sa.s + res->name) < 0)
+            return 0 ;
+
+        errno = EACCES ;
+        return -1 ;
+    }
+
+    if (fd_lock(t->fd, 0, 0) < 1)
+        return -1 ;
+
+    id = table_find(t, res->sa.s + res->name) ;
+    if (id < 0) {
+        fd_unlock(t->fd) ;
+        return 0 ;
+    }
+
+    field = table_field(&STATE_TABLE_SLOT(t, id)->sta, flag) ;
+    if (!field) {
+        fd_unlock(t->fd) ;
+        errno = EINVAL ;
+        return -1 ;
+    }
+
+    __atomic_store_n(field, value, __ATOMIC_RELAXED) ;
+    fd_unlock(t->fd) ;
+
+    return 1 ;
+}
+
+/** drop the slot of @res, its id can be given to another service */
+void state_table_release(resolve_service_t *res)
+{
+    log_flow() ;
+
+    int32_t id ;
+    struct state_table_s *t = NULL ;
+
+    if (table_get(&t, res, 0) <= 0 || t->rdonly)
+        return ;
+
+    if (fd_lock(t->fd, 1, 0) < 1)
+        return ;
+
+    id = table_find(t, res->sa.s + res->name) ;
+    if (id >= 0) {
+        __atomic_store_n(&STATE_TABLE_SLOT(t, id)->used, STATE_TABLE_RELEASED, __ATOMIC_RELEASE) ;
+        __atomic_store_n(&STATE_TABLE_HEADER(t)->nused, __atomic_load_n(&STATE_TABLE_HEADER(t)->nused, __ATOMIC_RELAXED) - 1, __ATOMIC_RELAXED) ;
+        table_reclaim(t, (uint32_t)id) ;
+    }
+
+    fd_unlock(t->fd) ;
+}
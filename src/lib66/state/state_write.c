@@ -24,34 +24,74 @@
 #include <66/state.h>
 #include <66/constants.h>
 #include <66/service.h>
+#include <66/resolve.h>
 
 int state_write(ss_state_t *sta, resolve_service_t *res)
 {
     log_flow() ;
 
+    int r ;
     char pack[STATE_STATE_SIZE] ;
     char *path = 0 ;
     char status[strlen(res->sa.s + res->live.statedir) + 1 + SS_STATUS_LEN + 1] ;
 
     auto_strings(status, res->sa.s + res->live.statedir, "/", SS_STATUS) ;
 
-    if (access(status, F_OK) < 0) {
+    /** While a service owns a slot of the table, the table is the only
+     * source of its state: <statedir>/status is left as it was copied by
+     * sanitize_livestate and is not updated anymore. Readers must go through
+     * state_read(), state_read_array() or state_check(), never read the
+     * file directly. */
+    r = state_table_write(sta, res, 0) ;
+    if (r < 0)
+        log_warnusys("write state of: ", res->sa.s + res->name, " at the state table -- falling back to its status file") ;
+
+    if (r > 0) {
+
+        state_notify(res) ;
+        return 1 ;
+
+    } else if (access(status, F_OK) < 0) {
+
         path = res->sa.s + res->live.status ;
+
+        if (access(path, F_OK) < 0) {
+            log_trace("create directory: ", path) ;
+            if (!dir_create_parent(path, 0755))
+                log_warnusys_return(LOG_EXIT_ZERO, "create directory: ", path) ;
+        }
+
     } else {
-        path = status ;
-    }
 
-    if (access(path, F_OK) < 0) {
-        log_trace("create directory: ", path) ;
-        if (!dir_create_parent(path, 0755))
-            log_warnusys_return(LOG_EXIT_ZERO, "create directory: ", path) ;
+        /** first write since the live directory was made. A full table
+         * leaves the state at the status file only, as a service without
+         * a slot is read from it */
+        if (!r) {
+
+            r = state_table_write(sta, res, 1) ;
+            if (r > 0) {
+                state_notify(res) ;
+                return 1 ;
+            }
+
+            if (r < 0)
+                log_warnusys("write state of: ", res->sa.s + res->name, " at the state table -- falling back to its status file") ;
+        }
+
+        path = status ;
     }
 
     state_pack(pack, sta) ;
 
+    /** readers must never see a partial status file */
     log_trace("write status file at: ", path) ;
-    if (!openwritenclose_unsafe(path, pack, STATE_STATE_SIZE))
+    if (!state_write_file(path, pack))
         return 0 ;
 
+    resolve_cache_remove(path) ;
+
+    if (path == status)
+        state_notify(res) ;
+
     return 1 ;
 }
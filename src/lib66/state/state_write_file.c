@@ -0,0 +1,56 @@
+/*
+ * state_write_file.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+#include <string.h>
+#include <stdio.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/djbunix.h>
+#include <skalibs/allreadwrite.h>
+#include <skalibs/posixplz.h>
+
+#include <66/state.h>
+
+/** Write @pack at @path through a temporary file renamed over it.
+ * State files live under the run directory, nothing is synced: the
+ * rename is enough for the readers to never see a partial file */
+int state_write_file(char const *path, char const *pack)
+{
+    log_flow() ;
+
+    int fd ;
+    char tmp[strlen(path) + 5] ;
+
+    auto_strings(tmp, path, ":new") ;
+
+    fd = open_trunc(tmp) ;
+    if (fd < 0)
+        return 0 ;
+
+    if (allwrite(fd, pack, STATE_STATE_SIZE) < STATE_STATE_SIZE) {
+        fd_close(fd) ;
+        unlink_void(tmp) ;
+        return 0 ;
+    }
+
+    fd_close(fd) ;
+
+    if (rename(tmp, path) < 0) {
+        unlink_void(tmp) ;
+        return 0 ;
+    }
+
+    return 1 ;
+}
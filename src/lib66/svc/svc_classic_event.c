@@ -0,0 +1,116 @@
+/*
+ * svc_classic_event.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <stdint.h>
+
+#include <s6/supervise.h>
+
+#include <66/service.h>
+#include <66/svc.h>
+
+/** A service without readiness notification never sends
+ * the U event. Wait for the u event instead. Same logic for
+ * the D and R events.*/
+char svc_classic_wait(resolve_service_t *res, char wait)
+{
+    if (!res->notify)
+        return wait == 'U' ? 'u' : wait == 'D' ? 'd' : wait == 'R' ? 'r' : wait ;
+
+    return wait ;
+}
+
+/** Check the current status of the service against
+ * @wait like s6-svlisten1 does before sending the command.
+ * Restart can never be satisfied by the current status.
+ *
+ * @Return 1 if the state is already reached else 0 */
+int svc_classic_status(resolve_service_t *res, char wait)
+{
+    s6_svstatus_t status = S6_SVSTATUS_ZERO ;
+
+    if (!s6_svstatus_read(res->sa.s + res->live.scandir, &status))
+        return 0 ;
+
+    switch (wait) {
+
+        case 'u':
+            return status.pid && !status.flagfinishing ;
+
+        case 'U':
+            return status.pid && !status.flagfinishing && status.flagready ;
+
+        case 'd':
+            return !status.pid ;
+
+        case 'D':
+            return !status.pid && !status.flagfinishing ;
+
+        default:
+            break ;
+    }
+
+    return 0 ;
+}
+
+/** Check the event @c received from the event directory
+ * of the service against @wait. @down keeps track of
+ * the down event at restart.
+ *
+ * @Return 1 if the event complete the wait
+ * @Return -1 if the event means a failure
+ * @Return 0 otherwise */
+int svc_classic_event(char wait, uint8_t *down, char c)
+{
+    switch (wait) {
+
+        case 'u':
+            if (c == 'u' || c == 'U')
+                return 1 ;
+            break ;
+
+        case 'U':
+            if (c == 'U')
+                return 1 ;
+            break ;
+
+        case 'd':
+            if (c == 'd' || c == 'D')
+                return 1 ;
+            break ;
+
+        case 'D':
+            if (c == 'D')
+                return 1 ;
+            break ;
+
+        case 'r':
+        case 'R':
+            if (c == 'd' || c == 'D') {
+                *down = 1 ;
+                break ;
+            }
+            if (*down && (c == 'U' || (wait == 'r' && c == 'u')))
+                return 1 ;
+            break ;
+
+        default:
+            break ;
+    }
+
+    /** the supervisor of the service exited */
+    if (c == 'x')
+        return -1 ;
+
+    return 0 ;
+}
@@ -13,6 +13,7 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/graph.h>
@@ -39,11 +40,10 @@ int svc_compute_ns(resolve_service_t *res, uint8_t what, ssexec_t *info, char co
     graph_t graph = GRAPH_ZERO ;
 
     unsigned int napid = 0 ;
-    unsigned int list[SS_MAX_SERVICE + 1], visit[SS_MAX_SERVICE + 1] ;
+    unsigned int *list = 0 ;
+    uint8_t *visit = 0 ;
     struct resolve_hash_s *hash = NULL ;
 
-    memset(list, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
-    memset(visit, 0, (SS_MAX_SERVICE + 1) * sizeof(unsigned int)) ;
     uint32_t gflag = STATE_FLAGS_TOPROPAGATE|STATE_FLAGS_WANTUP ;
 
     if (!propagate)
@@ -73,6 +73,8 @@ int svc_compute_ns(resolve_service_t *res, uint8_t what, ssexec_t *info, char co
     if (!graph.mlen)
         log_die(LOG_EXIT_USER, "services selection is not supervised -- initiate its first") ;
 
+    graph_visit_alloc(&graph, &list, &visit) ;
+
     FOREACH_STK(&stk, pos) {
 
         char const *name = stk.s + pos ;
@@ -91,14 +93,17 @@ int svc_compute_ns(resolve_service_t *res, uint8_t what, ssexec_t *info, char co
     if (!what)
         sanitize_init(list, napid, &graph, &hash) ;
 
-    pidservice_t apids[napid] ;
+    svc_array_t array = SVC_ARRAY_ZERO ;
 
-    svc_init_array(list, napid, apids, &graph, &hash, info, requiredby, gflag) ;
+    svc_init_array(&array, list, napid, &graph, &hash, info, requiredby, gflag) ;
 
-    r = svc_launch(apids, napid, what, &graph, &hash, info, updown, opt_updown, reloadmsg, data, propagate) ;
+    r = svc_launch(array.apids, array.napid, what, &graph, &hash, info, updown, opt_updown, reloadmsg, data, propagate) ;
 
+    svc_array_free(&array) ;
+    free(list) ;
+    free(visit) ;
     hash_free(&hash) ;
-    graph_free_all(&graph) ;
+    graph_csr_free_all(&graph) ;
 
     return r ;
 }
@@ -13,12 +13,15 @@
  */
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include <oblibs/log.h>
 #include <oblibs/graph.h>
 #include <oblibs/types.h>
 #include <oblibs/stack.h>
 
+#include <skalibs/genalloc.h>
+
 #include <66/svc.h>
 #include <66/service.h>
 #include <66/ssexec.h>
@@ -27,69 +30,101 @@
 
 #include <s6/supervise.h>
 
-static pidservice_t pidservice_init(unsigned int len)
+/** the graph may return up to g->mlen edges for a vertex */
+static unsigned int *edges_ready(genalloc *edges, graph_t *g)
 {
-    log_flow() ;
-
-    pidservice_t pids = PIDSERVICE_ZERO ;
-
-    if (len > SS_MAX_SERVICE)
-        log_die(LOG_EXIT_SYS, "too many services") ;
-
-    memset(pids.edge, 0, len * sizeof(unsigned int)) ;
-    memset(pids.notif, 0, len * sizeof(unsigned int)) ;
+    if (!genalloc_readyplus(unsigned int, edges, g->mlen))
+        log_die_nomem("genalloc") ;
 
-    return pids ;
+    return genalloc_s(unsigned int, edges) + genalloc_len(unsigned int, edges) ;
 }
 
-void svc_init_array(unsigned int *list, unsigned int listlen, pidservice_t *apids, graph_t *g, struct resolve_hash_s **hres, ssexec_t *info, uint8_t requiredby, uint32_t flag)
+void svc_init_array(svc_array_t *array, unsigned int *list, unsigned int listlen, graph_t *g, struct resolve_hash_s **hres, ssexec_t *info, uint8_t requiredby, uint32_t flag)
 {
     log_flow() ;
 
     int r = 0 ;
-    unsigned int pos = 0 ;
+    unsigned int pos = 0, i = 0, *e = 0, nstate = 0 ;
+    /** apids slot of the services without supervision, their
+     * state is read at once after the loop */
+    unsigned int sslot[listlen + 1] ;
+    resolve_service_t *sres[listlen + 1] ;
+    /** graph vertex -> apids slot + 1, 0 if not part of the selection */
+    unsigned int *vslot = (unsigned int *)calloc(g->mlen + 1, sizeof(unsigned int)) ;
+    pidservice_t *apids = (pidservice_t *)malloc((listlen + 1) * sizeof(pidservice_t)) ;
+
+    if (!vslot || !apids)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+    array->apids = apids ;
+    array->napid = listlen ;
+    array->edges.len = 0 ;
+
+    /** SS_MAX_SERVICE is only a hint, the buffer grows on demand */
+    if (!genalloc_ready(unsigned int, &array->edges, SS_MAX_SERVICE))
+        log_die_nomem("genalloc") ;
+
+    for (; pos < listlen ; pos++)
+        vslot[list[pos]] = pos + 1 ;
 
-    for (; pos < listlen ; pos++) {
+    for (pos = 0 ; pos < listlen ; pos++) {
 
-        pidservice_t pids = pidservice_init(g->mlen) ;
+        pidservice_t pids = PIDSERVICE_ZERO ;
 
         char *name = g->data.s + genalloc_s(graph_hash_t,&g->hash)[list[pos]].vertex ;
 
-        struct resolve_hash_s *hash = hash_search(hres, name) ;
-        if (hash == NULL)
-            log_dieu(LOG_EXIT_SYS,"find hash id of: ", name, " -- please make a bug reports") ;
+        if (!SVC_ISBARRIER(name)) {
 
-        pids.res = &hash->res ;
+            struct resolve_hash_s *hash = hash_search(hres, name) ;
+            if (hash == NULL)
+                log_dieu(LOG_EXIT_SYS,"find hash id of: ", name, " -- please make a bug reports") ;
+
+            pids.res = &hash->res ;
+        }
 
         if (FLAGS_ISSET(flag, STATE_FLAGS_TOPROPAGATE)) {
 
-            pids.nedge = graph_matrix_get_edge_g_sorted_list(pids.edge, g, name, requiredby, 0) ;
+            e = edges_ready(&array->edges, g) ;
+
+            pids.nedge = graph_csr_get_edge_sorted_list(e, g, name, requiredby, 0) ;
 
             if (pids.nedge < 0)
                 log_dieu(LOG_EXIT_SYS,"get sorted ", requiredby ? "required by" : "dependency", " list of service: ", name) ;
 
-            pids.nnotif = graph_matrix_get_edge_g_sorted_list(pids.notif, g, name, !requiredby, 0) ;
+            array->edges.len += pids.nedge * sizeof(unsigned int) ;
+
+            e = edges_ready(&array->edges, g) ;
+
+            pids.nnotif = graph_csr_get_edge_sorted_list(e, g, name, !requiredby, 0) ;
 
             if (pids.nnotif < 0)
                 log_dieu(LOG_EXIT_SYS,"get sorted ", !requiredby ? "required by" : "dependency", " list of service: ", name) ;
+
+            /** keep only the services part of the selection and
+             * store their slot at apids instead of their vertex */
+            for (i = 0, r = 0 ; i < pids.nnotif ; i++)
+                if (vslot[e[i]])
+                    e[r++] = vslot[e[i]] - 1 ;
+
+            pids.nnotif = r ;
+
+            array->edges.len += pids.nnotif * sizeof(unsigned int) ;
         }
 
-        pids.vertex = graph_hash_vertex_get_id(g, name) ;
+        pids.vertex = graph_csr_get_id(g, name) ;
 
         if (pids.vertex < 0)
             log_dieu(LOG_EXIT_SYS, "get vertex id -- please make a bug report") ;
 
-        if (pids.res->type != TYPE_CLASSIC) {
+        if (pids.res == NULL) {
 
-                ss_state_t sta = STATE_ZERO ;
+            /** nothing to control, it waits for the transition like a service would */
+            FLAGS_SET(pids.state, SVC_FLAGS_BARRIER|(FLAGS_ISSET(flag, STATE_FLAGS_WANTDOWN) ? SVC_FLAGS_UP : SVC_FLAGS_DOWN)) ;
 
-                if (!state_read(&sta, pids.res))
-                    log_dieusys(LOG_EXIT_SYS, "read state file of: ", name) ;
+        } else if (pids.res->type != TYPE_CLASSIC) {
 
-                if (sta.isup == STATE_FLAGS_TRUE)
-                    FLAGS_SET(pids.state, SVC_FLAGS_UP) ;
-                else
-                    FLAGS_SET(pids.state, SVC_FLAGS_DOWN) ;
+            sslot[nstate] = pos ;
+            sres[nstate++] = pids.res ;
 
         } else {
 
@@ -109,4 +144,48 @@ void svc_init_array(unsigned int *list, unsigned int listlen, pidservice_t *apid
 
         apids[pos] = pids ;
     }
+
+    free(vslot) ;
+
+    if (nstate) {
+
+        ss_state_t sta[nstate] ;
+        uint8_t found[nstate] ;
+
+        if (state_read_array(sta, found, sres, nstate) < 0)
+            log_dieusys(LOG_EXIT_SYS, "read state of the selection") ;
+
+        for (i = 0 ; i < nstate ; i++) {
+
+            if (!found[i])
+                log_dieusys(LOG_EXIT_SYS, "read state file of: ", sres[i]->sa.s + sres[i]->name) ;
+
+            if (sta[i].isup == STATE_FLAGS_TRUE)
+                FLAGS_SET(apids[sslot[i]].state, SVC_FLAGS_UP) ;
+            else
+                FLAGS_SET(apids[sslot[i]].state, SVC_FLAGS_DOWN) ;
+        }
+    }
+
+    /** the edges buffer do not move anymore, the lists can
+     * be pointed. They follow the order of the apids array */
+    e = genalloc_s(unsigned int, &array->edges) ;
+
+    for (pos = 0 ; pos < listlen ; pos++) {
+
+        apids[pos].edge = e ;
+        e += apids[pos].nedge ;
+        apids[pos].notif = e ;
+        e += apids[pos].nnotif ;
+    }
+}
+
+void svc_array_free(svc_array_t *array)
+{
+    log_flow() ;
+
+    free(array->apids) ;
+    array->apids = 0 ;
+    array->napid = 0 ;
+    genalloc_free(unsigned int, &array->edges) ;
 }
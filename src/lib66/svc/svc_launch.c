@@ -14,24 +14,29 @@
 
 #include <string.h>
 #include <stdint.h>
-#include <unistd.h> // access, unlink
+#include <stdlib.h> // malloc, free
+#include <unistd.h> // access, unlink, fork, _exit
 #include <errno.h>
 #include <signal.h>
 #include <sys/types.h>
+#include <sys/time.h> // setitimer
 
 #include <oblibs/log.h>
 #include <oblibs/string.h>
 #include <oblibs/types.h>
-#include <oblibs/environ.h>
 
 #include <skalibs/types.h>
+#include <skalibs/uint32.h>
 #include <skalibs/tai.h>
 #include <skalibs/selfpipe.h>
 #include <skalibs/djbunix.h>
-#include <skalibs/cspawn.h>
 #include <skalibs/genalloc.h>
 #include <skalibs/iopause.h>
 #include <skalibs/sig.h>//sig_ignore
+#include <skalibs/stralloc.h>
+
+#include <s6/supervise.h>
+#include <s6/ftrigr.h>
 
 #include <66/ssexec.h>
 #include <66/constants.h>
@@ -39,9 +44,14 @@
 #include <66/enum.h>
 #include <66/state.h>
 #include <66/svc.h>
+#include <66/trace.h>
 
 static unsigned int napid = 0 ;
 static unsigned int npid = 0 ;
+static unsigned int ntransition = 0 ;
+static unsigned int nnotification = 0 ;
+/** job slots of the fork engine, one byte per free slot */
+static int jobfd[2] = { -1, -1 } ;
 
 static char data[DATASIZE + 1] ;
 static char updown[4] ;
@@ -132,43 +142,79 @@ static int check_action(pidservice_t *apids, unsigned int pos, unsigned int rece
 
 }
 
+static inline char const *svc_name(pidservice_t *pids)
+{
+    return pids->res ? pids->res->sa.s + pids->res->name : "barrier" ;
+}
+
 static void notify(pidservice_t *apids, unsigned int pos, char const *sig, unsigned int what)
 {
     log_flow() ;
 
-    unsigned int i = 0, idx = 0 ;
-    char fmt[UINT_FMT] ;
+    int i = 0 ;
+    unsigned int idx = 0 ;
+    char s[SVC_NOTIF_SIZE] ;
     uint8_t flag = what ? SVC_FLAGS_DOWN : SVC_FLAGS_UP ;
 
+    uint32_pack_big(s, (uint32_t)pos) ;
+    s[4] = *sig ;
+
+    /** notif contains the slot at apids of the dependents part of
+     * the selection, see svc_init_array() */
     for (; i < apids[pos].nnotif ; i++) {
 
-        for (idx = 0 ; idx < napid ; idx++) {
+        idx = apids[pos].notif[i] ;
 
-            if (apids[pos].notif[i] == apids[idx].vertex && !FLAGS_ISSET(apids[idx].state, flag))  {
+        if (FLAGS_ISSET(apids[idx].state, flag))
+            continue ;
 
-                size_t nlen = uint_fmt(fmt, pos) ;
-                fmt[nlen] = 0 ;
-                size_t len = nlen + 1 + 2 ;
-                char s[len + 1] ;
-                auto_strings(s, fmt, ":", sig, "@") ;
+        nnotification++ ;
 
-                log_trace("sends notification ", sig, " to: ", apids[idx].res->sa.s + apids[idx].res->name, " from: ", apids[pos].res->sa.s + apids[pos].res->name) ;
+        log_trace("sends notification ", sig, " to: ", svc_name(&apids[idx]), " from: ", svc_name(&apids[pos])) ;
 
-                if (write(apids[idx].pipe[1], s, strlen(s)) < 0)
-                    log_dieusys(LOG_EXIT_SYS, "send notif to: ", apids[idx].res->sa.s + apids[idx].res->name) ;
-            }
-        }
+        if (write(apids[idx].pipe[1], s, SVC_NOTIF_SIZE) < 0)
+            log_dieusys(LOG_EXIT_SYS, "send notif to: ", svc_name(&apids[idx])) ;
     }
 }
 
+static void trace_service(pidservice_t *apids, unsigned int pos, uint8_t event, unsigned int what, char const *by, unsigned int exitcode)
+{
+    resolve_service_t *res = apids[pos].res ;
+
+    if (res == NULL)
+        return ;
+
+    trace_write(TRACE_KIND_SERVICE, event, what, res->sa.s + res->name, res->sa.s + res->treename, by, exitcode) ;
+}
+
+/** expose the amount of work made by the transaction */
+static void trace_transitions(void)
+{
+    char t[UINT_FMT], n[UINT_FMT], a[UINT_FMT] ;
+
+    t[uint_fmt(t, ntransition)] = 0 ;
+    n[uint_fmt(n, nnotification)] = 0 ;
+    a[uint_fmt(a, napid)] = 0 ;
+
+    log_trace("transaction of ", a, " services: ", t, " transitions, ", n, " notifications") ;
+}
+
 /**
  * @what: up or down
- * @success: 0 fail, 1 win
+ * @success: 0 win, 1 fail
+ *
+ * The notification of the dependents is the job of the caller.
  * */
 static void announce(unsigned int pos, pidservice_t *apids, unsigned int what, unsigned int success, unsigned int exitcode)
 {
     log_flow() ;
 
+    if (FLAGS_ISSET(apids[pos].state, SVC_FLAGS_BARRIER)) {
+        FLAGS_CLEAR(apids[pos].state, SVC_FLAGS_BLOCK) ;
+        FLAGS_SET(apids[pos].state, (what ? SVC_FLAGS_DOWN : SVC_FLAGS_UP)|SVC_FLAGS_UNBLOCK) ;
+        return ;
+    }
+
     int fd = 0 ;
     char fmt[UINT_FMT] ;
     char const *name = apids[pos].res->sa.s + apids[pos].res->name ;
@@ -180,6 +226,8 @@ static void announce(unsigned int pos, pidservice_t *apids, unsigned int what, u
 
     uint8_t flag = what ? SVC_FLAGS_DOWN : SVC_FLAGS_UP ;
 
+    ntransition++ ;
+
     if (success) {
 
         if (apids[pos].res->type == TYPE_CLASSIC) {
@@ -194,7 +242,7 @@ static void announce(unsigned int pos, pidservice_t *apids, unsigned int what, u
 
         log_1_warn("unable to ", reloadmsg == 1 ? "restart" : reloadmsg > 1 ? "reload" : what ? "stop" : "start", " service: ", name, " -- exited with signal: ", fmt) ;
 
-        notify(apids, pos, "F", what) ;
+        trace_service(apids, pos, TRACE_EVENT_FAIL, what, 0, exitcode) ;
 
         FLAGS_SET(apids[pos].state, SVC_FLAGS_BLOCK|SVC_FLAGS_FATAL) ;
 
@@ -237,7 +285,7 @@ static void announce(unsigned int pos, pidservice_t *apids, unsigned int what, u
 
         log_info("Successfully ", reloadmsg == 1 ? "restarted" : reloadmsg > 1 ? "reloaded" : what ? "stopped" : "started", " service: ", name) ;
 
-        notify(apids, pos, what ? "D" : "U", what) ;
+        trace_service(apids, pos, TRACE_EVENT_DONE, what, 0, 0) ;
 
         FLAGS_CLEAR(apids[pos].state, SVC_FLAGS_BLOCK) ;
         FLAGS_SET(apids[pos].state, flag|SVC_FLAGS_UNBLOCK) ;
@@ -283,12 +331,14 @@ static int handle_signal(pidservice_t *apids, unsigned int what, graph_t *graph,
                         if (!WIFSIGNALED(wstat) && !WEXITSTATUS(wstat)) {
 
                             announce(pos, apids, what, 0, 0) ;
+                            notify(apids, pos, what ? "D" : "U", what) ;
                             npid-- ;
 
                         } else {
 
                             ok = WIFSIGNALED(wstat) ? WTERMSIG(wstat) : WEXITSTATUS(wstat) ;
                             announce(pos, apids, what, 1, ok) ;
+                            notify(apids, pos, "F", what) ;
                             npid-- ;
                             kill_all(apids) ;
                             break ;
@@ -333,128 +383,170 @@ unsigned int compute_timeout(resolve_service_t *res, unsigned int what)
 
 }
 
-static int doit(pidservice_t *apids, unsigned int napid, unsigned int idx, unsigned int what, tain *deadline)
+/** fill the job slots pipe with @n tokens. A service takes one of them
+ * before being controlled and gives it back when it reaches its state.
+ * The read side blocks: a released token wakes a single waiting service
+ * instead of every one of them racing for it */
+static void jobs_init(unsigned int n)
 {
     log_flow() ;
 
-    uint8_t type = apids[idx].res->type ;
+    char c = 0 ;
 
-    pid_t pid ;
-    int wstat ;
+    if (pipenb(jobfd) < 0 || ndelay_off(jobfd[0]) < 0)
+        log_dieusys(LOG_EXIT_SYS, "pipe") ;
 
-    char tfmt[UINT32_FMT] ;
+    while (n--) {
 
-    unsigned int timeout = 0 ;
+        if (write(jobfd[1], &c, 1) < 0) {
 
-    timeout = compute_timeout(apids[idx].res, what) ;
+            /** -j is clamped to SSEXEC_JOBS_MAX, a full pipe
+             * still leaves enough slots */
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break ;
 
-    tfmt[uint_fmt(tfmt, timeout)] = 0 ;
+            log_dieusys(LOG_EXIT_SYS, "fill job slots") ;
+        }
+    }
+}
 
-    if (type == TYPE_CLASSIC) {
+/** interrupts the read of jobs_acquire() at the deadline */
+static void jobs_alarm(int sig)
+{
+    (void)sig ;
+}
 
-        char *scandir = apids[idx].res->sa.s + apids[idx].res->live.scandir ;
+static void jobs_acquire(int fd, char const *name, tain *deadline)
+{
+    log_flow() ;
 
-        if (updown[2] == 'U' || updown[2] == 'D' || updown[2] == 'R') {
+    char c ;
+    int ms = -1 ;
+    struct sigaction sa, sold ;
+    struct itimerval it = { .it_interval = { 0, 0 }, .it_value = { 0, 0 } } ;
 
-            if (!apids[idx].res->notify)
-                updown[2] = updown[2] == 'U' ? 'u' : updown[2] == 'D' ? 'd' : updown[2] == 'R' ? 'r' : updown[2] ;
+    log_trace("waiting for a job slot for: ", name) ;
 
-        }
+    tain_now_g() ;
 
-        char const *newargv[8] ;
-        unsigned int m = 0 ;
+    if (tain_less(deadline, &STAMP)) {
+        errno = ETIMEDOUT ;
+        log_dieusys(LOG_EXIT_SYS, "wait for a job slot for: ", name) ;
+    }
 
-        newargv[m++] = "s6-svc" ;
-        newargv[m++] = data ;
+    /** no SA_RESTART, the alarm must break the read */
+    sa.sa_handler = &jobs_alarm ;
+    sa.sa_flags = 0 ;
+    sigemptyset(&sa.sa_mask) ;
 
-        if (opt_updown)
-            newargv[m++] = updown ;
+    if (sigaction(SIGALRM, &sa, &sold) < 0)
+        log_dieusys(LOG_EXIT_SYS, "set SIGALRM handler") ;
 
-        newargv[m++] = "-T" ;
-        newargv[m++] = tfmt ;
-        newargv[m++] = "--" ;
-        newargv[m++] = scandir ;
-        newargv[m++] = 0 ;
+    {
+        tain left ;
+        tain_sub(&left, deadline, &STAMP) ;
+        ms = tain_to_millisecs(&left) ;
+    }
 
-        log_trace("sending ", opt_updown ? newargv[2] : "", opt_updown ? " " : "", data, " to: ", scandir) ;
+    /** an infinite deadline does not fit, no alarm in this case */
+    if (ms >= 0) {
 
-        pid = child_spawn0(newargv[0], newargv, (char const *const *) environ) ;
+        if (!ms)
+            ms = 1 ;
 
-        if (waitpid_nointr(pid, &wstat, 0) < 0)
-            log_warnusys_return(LOG_EXIT_ZERO, "wait for s6-svc") ;
+        it.it_value.tv_sec = ms / 1000 ;
+        it.it_value.tv_usec = (ms % 1000) * 1000 ;
+        /** rings again if the first one came before the read */
+        it.it_interval.tv_usec = 100000 ;
 
-        if (!WIFSIGNALED(wstat) && !WEXITSTATUS(wstat))
-            return WEXITSTATUS(wstat) ;
-        else
-            return WIFSIGNALED(wstat) ? WTERMSIG(wstat) : WEXITSTATUS(wstat) ;
+        if (setitimer(ITIMER_REAL, &it, 0) < 0)
+            log_dieusys(LOG_EXIT_SYS, "set timer") ;
+    }
 
-    } else if (type == TYPE_ONESHOT) {
+    for (;;) {
 
-        char *servicedir = apids[idx].res->sa.s + apids[idx].res->live.servicedir ;
-        char *oneshotdir = apids[idx].res->sa.s + apids[idx].res->live.oneshotddir ;
-        char *scandir = apids[idx].res->sa.s + apids[idx].res->live.scandir ;
-        char oneshot[strlen(oneshotdir) + 2 + 1] ;
-        auto_strings(oneshot, oneshotdir, "/s") ;
-
-        char const *newargv[11] ;
-        unsigned int m = 0 ;
-        newargv[m++] = "s6-sudo" ;
-        newargv[m++] = VERBOSITY >= 4 ? "-vel0" : "-el0" ;
-        newargv[m++] = "-t" ;
-        newargv[m++] = "30000" ;
-        newargv[m++] = "-T" ;
-        newargv[m++] = tfmt ;
-        newargv[m++] = "--" ;
-        newargv[m++] = oneshot ;
-        newargv[m++] = !what ? "up" : "down" ;
-        newargv[m++] = servicedir ;
-        newargv[m++] = 0 ;
-
-        log_trace("sending ", !what ? "start" : "stop", " to: ", scandir) ;
-
-        pid = child_spawn0(newargv[0], newargv, (char const *const *) environ) ;
-
-        if (waitpid_nointr(pid, &wstat, 0) < 0)
-            log_warnusys_return(LOG_EXIT_ZERO, "wait for s6-sudo") ;
-
-        if (!WIFSIGNALED(wstat) && !WEXITSTATUS(wstat)) {
-
-            if (data[1] == 'r') {
-                /** oneshot service are not handled automatically by
-                 * s6-supervise. Signal is restart, so let it down first
-                 * and force to bring it up again .*/
-
-                log_trace("sending up to: ", scandir) ;
-
-                char const *newargv[11] ;
-                unsigned int m = 0 ;
-                newargv[m++] = "s6-sudo" ;
-                newargv[m++] = VERBOSITY >= 4 ? "-vel0" : "-el0" ;
-                newargv[m++] = "-t" ;
-                newargv[m++] = "30000" ;
-                newargv[m++] = "-T" ;
-                newargv[m++] = tfmt ;
-                newargv[m++] = "--" ;
-                newargv[m++] = oneshot ;
-                newargv[m++] = "up" ;
-                newargv[m++] = servicedir ;
-                newargv[m++] = 0 ;
-
-                pid = child_spawn0(newargv[0], newargv, (char const *const *) environ) ;
-
-                if (waitpid_nointr(pid, &wstat, 0) < 0)
-                    log_warnusys_return(LOG_EXIT_ZERO, "wait for s6-sudo") ;
-
-                if (WIFSIGNALED(wstat) && WEXITSTATUS(wstat))
-                    return WIFSIGNALED(wstat) ? WTERMSIG(wstat) : WEXITSTATUS(wstat) ;
-            }
+        if (read(fd, &c, 1) == 1)
+            break ;
 
-            return WEXITSTATUS(wstat) ;
+        if (errno != EINTR)
+            log_dieusys(LOG_EXIT_SYS, "read job slots") ;
 
-        } else {
+        tain_now_g() ;
 
-            return WIFSIGNALED(wstat) ? WTERMSIG(wstat) : WEXITSTATUS(wstat) ;
+        if (!tain_less(&STAMP, deadline)) {
+            errno = ETIMEDOUT ;
+            log_dieusys(LOG_EXIT_SYS, "wait for a job slot for: ", name) ;
         }
+    }
+
+    if (ms >= 0) {
+
+        it.it_value.tv_sec = it.it_value.tv_usec = 0 ;
+        it.it_interval.tv_usec = 0 ;
+        setitimer(ITIMER_REAL, &it, 0) ;
+    }
+
+    sigaction(SIGALRM, &sold, 0) ;
+}
+
+static void jobs_release(int fd)
+{
+    log_flow() ;
+
+    char c = 0 ;
+
+    if (write(fd, &c, 1) < 0)
+        log_dieusys(LOG_EXIT_SYS, "release job slot") ;
+}
+
+/** only a plain start is measured, a restart or a service
+ * already up would record the time of something else */
+static inline uint8_t latency_wanted(unsigned int what)
+{
+    return !what && data[1] == 'u' ;
+}
+
+/** @start was taken when the control was written, STAMP must be
+ * up to date when the up event is received */
+static void latency_record(resolve_service_t *res, tain const *start)
+{
+    log_flow() ;
+
+    int ms ;
+    tain d ;
+
+    tain_sub(&d, &STAMP, start) ;
+    ms = tain_to_millisecs(&d) ;
+
+    if (ms >= 0)
+        state_write_latency(res, (uint32_t)ms) ;
+}
+
+static int doit(pidservice_t *apids, unsigned int napid, unsigned int idx, unsigned int what, tain *deadline)
+{
+    log_flow() ;
+
+    uint8_t type = apids[idx].res->type ;
+
+    unsigned int timeout = 0 ;
+
+    timeout = compute_timeout(apids[idx].res, what) ;
+
+    if (type == TYPE_CLASSIC) {
+
+        return svc_send_classic(apids[idx].res, data + 1, opt_updown ? updown[2] : 0, timeout) ;
+
+    } else if (type == TYPE_ONESHOT) {
+
+        int e = svc_send_oneshot(apids[idx].res, !what ? "up" : "down", timeout) ;
+
+        if (!e && data[1] == 'r')
+            /** oneshot service are not handled automatically by
+             * s6-supervise. Signal is restart, so let it down first
+             * and force to bring it up again .*/
+            e = svc_send_oneshot(apids[idx].res, "up", timeout) ;
+
+        return e ;
 
     } else if (type == TYPE_MODULE) {
 
@@ -465,13 +557,16 @@ static int doit(pidservice_t *apids, unsigned int napid, unsigned int idx, unsig
     return 0 ;
 }
 
-static int async_deps(struct resolve_hash_s **hres, pidservice_t *apids, unsigned int i, unsigned int what, ssexec_t *info, tain *deadline)
+/** @last receives the dependency which released @i */
+static int async_deps(struct resolve_hash_s **hres, pidservice_t *apids, unsigned int i, unsigned int what, ssexec_t *info, tain *deadline, unsigned int *last)
 {
     log_flow() ;
 
     int r ;
-    unsigned int pos = 0, id = 0, idx = 0 ;
-    char buf[(UINT_FMT*2)*SS_MAX_SERVICE + 1] ;
+    unsigned int pos = 0, n = apids[i].nedge ;
+    size_t len = 0, idx = 0 ;
+    char buf[SVC_NOTIF_BUFSIZE] ;
+    char const *name = svc_name(&apids[i]) ;
 
     tain dead ;
     tain_now_set_stopwatch_g() ;
@@ -479,12 +574,7 @@ static int async_deps(struct resolve_hash_s **hres, pidservice_t *apids, unsigne
 
     iopause_fd x = { .fd = apids[i].pipe[0], .events = IOPAUSE_READ, 0 } ;
 
-    unsigned int n = apids[i].nedge ;
-    unsigned int visit[n + 1] ;
-
-    memset(visit, 0, (n + 1) * sizeof(unsigned int));
-
-    log_trace("waiting dependencies for: ", apids[i].res->sa.s + apids[i].res->name) ;
+    log_trace("waiting dependencies for: ", name) ;
 
     while (pos < n) {
 
@@ -495,74 +585,56 @@ static int async_deps(struct resolve_hash_s **hres, pidservice_t *apids, unsigne
 
         if (!r) {
             errno = ETIMEDOUT ;
-            log_dieusys(LOG_EXIT_SYS,"timed out", apids[i].res->sa.s + apids[i].res->name) ;
+            log_dieusys(LOG_EXIT_SYS,"timed out", name) ;
         }
 
-        if (x.revents & IOPAUSE_READ) {
+        if (!(x.revents & IOPAUSE_READ))
+            continue ;
+
+        /** The pipe might contain multiple records coming from
+         * the dependencies if they finished before the start of
+         * this read process. Read them in bulk after the incomplete
+         * record left by the previous read, if any. */
+        r = read(apids[i].pipe[0], buf + len, sizeof(buf) - len) ;
+        if (r < 0) {
+            if (errno == EINTR)
+                continue ;
+            log_dieusys(LOG_EXIT_SYS, "read from pipe") ;
+        }
+
+        if (!r)
+            log_die(LOG_EXIT_SYS, "notification pipe of: ", name, " closed -- please make a bug report") ;
+
+        len += r ;
+
+        for (idx = 0 ; idx + SVC_NOTIF_SIZE <= len && pos < n ; idx += SVC_NOTIF_SIZE) {
+
+            uint32_t id = 0 ;
+            unsigned char c = (unsigned char)buf[idx + 4] ;
+            char pc[2] = { (char)c, 0 } ;
 
-            memset(buf, 0, ((UINT_FMT*2)*SS_MAX_SERVICE + 1) * sizeof(char)) ;
-            r = read(apids[i].pipe[0], buf, sizeof(buf)) ;
+            uint32_unpack_big(buf + idx, &id) ;
+
+            if (id >= napid || c > 127)
+                log_die(LOG_EXIT_SYS, "received bad notification -- please make a bug report") ;
+
+            log_trace(name, " acknowledges: ", pc, " from: ", svc_name(&apids[id])) ;
+
+            r = check_action(apids, id, c, what) ;
             if (r < 0)
-                log_dieu(LOG_EXIT_SYS, "read from pipe") ;
-            buf[r] = 0 ;
-
-            idx = 0 ;
-
-            while (r != -1) {
-                /** The buf might contain multiple signal coming
-                 * from the dependencies if they finished before
-                 * the start of this read process. Check every
-                 * signal received.*/
-                r = get_len_until(buf + idx, '@') ;
-
-                if (r < 0)
-                    /* no more signal */
-                    goto next ;
-
-                char line[r + 1] ;
-                memcpy(line, buf + idx, r) ;
-                line[r] = 0 ;
-
-                idx += r + 1 ;
-
-                /**
-                 * the received string have the format:
-                 *      apids_array_id:signal_receive
-                 *
-                 * typically:
-                 *      - 10:D
-                 *      - 8:u
-                 *      - ...
-                 *
-                 * Split it and check the signal receive.*/
-                int sep = get_len_until(line, ':') ;
-                if (sep < 0)
-                    log_die(LOG_EXIT_SYS, "received bad signal format -- please make a bug report") ;
-
-                unsigned int c = line[sep + 1] ;
-                char pc[2] = { c, 0 } ;
-                line[sep] = 0 ;
-
-                if (!uint0_scan(line, &id))
-                    log_dieusys(LOG_EXIT_SYS, "retrieve service number -- please make a bug report") ;
-
-                log_trace(apids[i].res->sa.s + apids[i].res->name, " acknowledges: ", pc, " from: ", apids[id].res->sa.s + apids[id].res->name) ;
-
-                if (!visit[pos]) {
-
-                    id = check_action(apids, id, c, what) ;
-                    if (id < 0)
-                        log_die(LOG_EXIT_SYS, "service dependency: ", apids[id].res->sa.s + apids[id].res->name, " of: ", apids[i].res->sa.s + apids[i].res->name," crashed") ;
-
-                    if (!id)
-                        continue ;
+                log_die(LOG_EXIT_SYS, "service dependency: ", svc_name(&apids[id]), " of: ", name," crashed") ;
 
-                    visit[pos++] ;
-                }
-            }
+            if (!r)
+                continue ;
+
+            *last = id ;
+            pos++ ;
         }
-        next:
 
+        /** keep the incomplete record for the next read */
+        len -= idx ;
+        if (len)
+            memmove(buf, buf + idx, len) ;
     }
 
     return 1 ;
@@ -584,12 +656,46 @@ static int async(struct resolve_hash_s **hres, pidservice_t *apids, unsigned int
 
             FLAGS_SET(apids[i].state, SVC_FLAGS_BLOCK) ;
 
+            unsigned int last = napid ;
+
             if (apids[i].nedge)
-                if (!async_deps(hres, apids, i, what, info, deadline))
+                if (!async_deps(hres, apids, i, what, info, deadline, &last))
                     log_warnu_return(LOG_EXIT_SYS, !what ? "start" : "stop", " dependencies of service: ", name) ;
 
+            trace_service(apids, i, TRACE_EVENT_READY, what, last < napid ? svc_name(&apids[last]) : 0, 0) ;
+
+            /** the exit of the process releases its dependents */
+            if (FLAGS_ISSET(apids[i].state, SVC_FLAGS_BARRIER))
+                return 0 ;
+
+            /** a module runs its own transaction with its own
+             * job slots, keep the ones of this transaction */
+            int rfd = jobfd[0], wfd = jobfd[1] ;
+            /** without -w option svc_send_classic returns as soon as
+             * the control is written, there is nothing to measure */
+            uint8_t timed = latency_wanted(what) && (apids[i].res->type != TYPE_CLASSIC || opt_updown) ;
+            tain start ;
+
+            if (rfd >= 0)
+                jobs_acquire(rfd, name, deadline) ;
+
+            trace_service(apids, i, TRACE_EVENT_SENT, what, 0, 0) ;
+
+            if (timed) {
+                tain_now_g() ;
+                start = STAMP ;
+            }
+
             e = doit(apids, napid, i, what, deadline) ;
 
+            if (!e && timed) {
+                tain_now_g() ;
+                latency_record(apids[i].res, &start) ;
+            }
+
+            if (wfd >= 0)
+                jobs_release(wfd) ;
+
         } else {
 
             log_warn("skipping service: ", name, " -- already in ", what ? "stopping" : "starting", " process") ;
@@ -606,6 +712,729 @@ static int async(struct resolve_hash_s **hres, pidservice_t *apids, unsigned int
     return e ;
 }
 
+/** event engine
+ *
+ * A single process drives the whole transaction. Every service
+ * of the selection gets a slot with a countdown of its dependencies
+ * part of the selection. A slot is launched as soon as its countdown
+ * reach zero, classic services are controlled directly through
+ * their supervise control pipe and followed by ftrigr on their
+ * event directory (see svc_send_classic.c), oneshot services talk
+ * to their oneshotd daemon through a socket (see svc_oneshot.c) and
+ * module are handled by a helper process reaped through the selfpipe. */
+
+typedef enum svc_phase_e svc_phase_t, *svc_phase_t_ref ;
+enum svc_phase_e
+{
+    SVC_PHASE_WAIT = 0, // dependencies not handled yet
+    SVC_PHASE_READY, // queued, waiting to be launched
+    SVC_PHASE_RUN, // control sent, waiting for the result
+    SVC_PHASE_DONE
+} ;
+
+typedef struct svc_slot_s svc_slot_t, *svc_slot_t_ref ;
+struct svc_slot_s
+{
+    uint8_t phase ;
+    unsigned int ndeps ; // countdown of dependencies
+    uint16_t id ; // ftrigr subscription of a classic service
+    char wait ; // event to wait for, 0 if none
+    uint8_t down ; // restart: down step done
+    svc_oneshot_t oneshot ; // connection to the oneshotd daemon
+    tain deadline ;
+    tain start ; // control written
+    uint8_t timed ; // record the latency at the end of the transition
+} ;
+
+typedef struct svc_engine_s svc_engine_t, *svc_engine_t_ref ;
+struct svc_engine_s
+{
+    pidservice_t *apids ;
+    unsigned int what ;
+    svc_slot_t *slot ;
+    unsigned int *queue ; // fifo, or max-heap on prio with SSEXEC_SCHED_CRITICAL
+    unsigned int qhead ;
+    unsigned int qtail ;
+    uint32_t *prio ; // length of the longest remaining path, 0 if not computed
+    unsigned int *run ; // slots currently in SVC_PHASE_RUN
+    unsigned int nrun ;
+    unsigned int jobs ; // maximum of slots in SVC_PHASE_RUN, 0 for no limit
+    iopause_fd *x ; // selfpipe, ftrigr, oneshot connections
+    unsigned int *xpos ; // x index -> slot
+    unsigned int ndone ;
+    ftrigr_t fifo ;
+    uint8_t fifo_started ;
+    stralloc sa ;
+    tain *deadline ;
+} ;
+
+/** critical path scheduler
+ *
+ * The priority of a slot is its own weight plus the heaviest
+ * priority of its dependents. The weight is the latency observed
+ * at the previous start of the service, 1 if the service was never
+ * measured, so an unknown graph falls back to the longest chain. */
+static uint32_t event_prio(svc_engine_t *eng, unsigned int pos)
+{
+    unsigned int i = 0 ;
+    uint32_t w = 0, max = 0 ;
+    pidservice_t *apids = eng->apids ;
+
+    if (eng->prio[pos])
+        return eng->prio[pos] ;
+
+    if (!eng->what && apids[pos].res)
+        w = state_read_latency(apids[pos].res) ;
+
+    if (!w)
+        w = 1 ;
+
+    for (; i < apids[pos].nnotif ; i++) {
+        uint32_t p = event_prio(eng, apids[pos].notif[i]) ;
+        if (p > max)
+            max = p ;
+    }
+
+    eng->prio[pos] = (max > UINT32_MAX - w) ? UINT32_MAX : w + max ;
+
+    return eng->prio[pos] ;
+}
+
+static void event_push(svc_engine_t *eng, unsigned int pos)
+{
+    eng->slot[pos].phase = SVC_PHASE_READY ;
+
+    if (!eng->prio) {
+        eng->queue[eng->qtail++] = pos ;
+        return ;
+    }
+
+    unsigned int i = eng->qtail++ ;
+
+    while (i) {
+        unsigned int parent = (i - 1) / 2 ;
+        if (eng->prio[eng->queue[parent]] >= eng->prio[pos])
+            break ;
+        eng->queue[i] = eng->queue[parent] ;
+        i = parent ;
+    }
+
+    eng->queue[i] = pos ;
+}
+
+static unsigned int event_pop(svc_engine_t *eng)
+{
+    if (!eng->prio)
+        return eng->queue[eng->qhead++] ;
+
+    unsigned int top = eng->queue[0], last = eng->queue[--eng->qtail], i = 0 ;
+
+    for (;;) {
+
+        unsigned int child = 2 * i + 1 ;
+
+        if (child >= eng->qtail)
+            break ;
+
+        if (child + 1 < eng->qtail && eng->prio[eng->queue[child + 1]] > eng->prio[eng->queue[child]])
+            child++ ;
+
+        if (eng->prio[last] >= eng->prio[eng->queue[child]])
+            break ;
+
+        eng->queue[i] = eng->queue[child] ;
+        i = child ;
+    }
+
+    eng->queue[i] = last ;
+
+    return top ;
+}
+
+static void event_unrun(svc_engine_t *eng, unsigned int pos)
+{
+    unsigned int i = 0 ;
+
+    for (; i < eng->nrun ; i++) {
+        if (eng->run[i] == pos) {
+            eng->run[i] = eng->run[--eng->nrun] ;
+            break ;
+        }
+    }
+}
+
+/** decrease the countdown of the dependents of @pos */
+static void event_release(svc_engine_t *eng, unsigned int pos)
+{
+    log_flow() ;
+
+    int i = 0 ;
+    pidservice_t *apids = eng->apids ;
+
+    for (; i < apids[pos].nnotif ; i++) {
+
+        unsigned int idx = apids[pos].notif[i] ;
+
+        if (eng->slot[idx].phase != SVC_PHASE_WAIT || !eng->slot[idx].ndeps)
+            continue ;
+
+        log_trace(svc_name(&apids[idx]), " acknowledges: ", eng->what ? "D" : "U", " from: ", svc_name(&apids[pos])) ;
+
+        nnotification++ ;
+
+        if (!--eng->slot[idx].ndeps) {
+            trace_service(apids, idx, TRACE_EVENT_READY, eng->what, svc_name(&apids[pos]), 0) ;
+            event_push(eng, idx) ;
+        }
+    }
+}
+
+static void event_done(svc_engine_t *eng, unsigned int pos)
+{
+    log_flow() ;
+
+    if (eng->slot[pos].phase == SVC_PHASE_RUN)
+        event_unrun(eng, pos) ;
+
+    eng->slot[pos].phase = SVC_PHASE_DONE ;
+    eng->apids[pos].pid = 0 ;
+    eng->ndone++ ;
+
+    if (eng->slot[pos].timed)
+        latency_record(eng->apids[pos].res, &eng->slot[pos].start) ;
+
+    announce(pos, eng->apids, eng->what, 0, 0) ;
+
+    event_release(eng, pos) ;
+}
+
+static int event_fail(svc_engine_t *eng, unsigned int pos, unsigned int exitcode)
+{
+    log_flow() ;
+
+    if (eng->slot[pos].phase == SVC_PHASE_RUN)
+        event_unrun(eng, pos) ;
+
+    eng->slot[pos].phase = SVC_PHASE_DONE ;
+    eng->apids[pos].pid = 0 ;
+    svc_oneshot_end(&eng->slot[pos].oneshot) ;
+
+    announce(pos, eng->apids, eng->what, 1, exitcode) ;
+
+    return exitcode ;
+}
+
+static void event_kill(svc_engine_t *eng)
+{
+    log_flow() ;
+
+    unsigned int i = 0 ;
+
+    for (; i < eng->nrun ; i++) {
+
+        if (eng->apids[eng->run[i]].pid > 0)
+            kill(eng->apids[eng->run[i]].pid, SIGKILL) ;
+
+        /** s6-sudod kills the program when the connection is closed */
+        svc_oneshot_end(&eng->slot[eng->run[i]].oneshot) ;
+    }
+}
+
+static int event_classic(svc_engine_t *eng, unsigned int pos)
+{
+    log_flow() ;
+
+    int r ;
+    resolve_service_t *res = eng->apids[pos].res ;
+    char const *name = res->sa.s + res->name ;
+    char const *scandir = res->sa.s + res->live.scandir ;
+    char wait = svc_classic_wait(res, opt_updown ? updown[2] : 0) ;
+
+    eng->slot[pos].wait = wait ;
+    eng->slot[pos].down = 0 ;
+
+    if (wait) {
+
+        char const *eventdir = res->sa.s + res->live.eventdir ;
+
+        log_trace("subcribe to fifo: ", eventdir) ;
+        eng->slot[pos].id = ftrigr_subscribe_g(&eng->fifo, eventdir, "[DdUux]", FTRIGR_REPEAT, eng->deadline) ;
+        if (!eng->slot[pos].id) {
+            log_warnusys("subcribe to fifo: ", eventdir) ;
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+        }
+
+        if (svc_classic_status(res, wait))
+            wait = 0 ;
+    }
+
+    log_trace("sending ", data, " to: ", scandir) ;
+
+    r = s6_svc_writectl(scandir, S6_SUPERVISE_CTLDIR, data + 1, strlen(data + 1)) ;
+    if (r < 0) {
+        log_warnusys("send signal to: ", name) ;
+        return event_fail(eng, pos, LOG_EXIT_SYS) ;
+    } else if (!r) {
+        log_warn("supervisor of: ", name, " is not listening") ;
+        return event_fail(eng, pos, LOG_EXIT_SYS) ;
+    }
+
+    if (!wait) {
+
+        eng->slot[pos].timed = 0 ;
+
+        if (eng->slot[pos].id) {
+            ftrigr_unsubscribe_g(&eng->fifo, eng->slot[pos].id, eng->deadline) ;
+            eng->slot[pos].id = 0 ;
+        }
+
+        event_done(eng, pos) ;
+    }
+
+    return 0 ;
+}
+
+static int event_exec(svc_engine_t *eng, unsigned int pos)
+{
+    log_flow() ;
+
+    pidservice_t *apids = eng->apids ;
+    resolve_service_t *res = apids[pos].res ;
+    unsigned int timeout = 0 ;
+    tain t ;
+
+    /** its dependencies are done, so it is */
+    if (FLAGS_ISSET(apids[pos].state, SVC_FLAGS_BARRIER)) {
+        event_done(eng, pos) ;
+        return 0 ;
+    }
+
+    timeout = compute_timeout(res, eng->what) ;
+
+    log_trace("Initiating process of: ", res->sa.s + res->name) ;
+
+    if (timeout)
+        tain_from_millisecs(&t, timeout) ;
+    else
+        t = tain_infinite_relative ;
+
+    tain_add_g(&eng->slot[pos].deadline, &t) ;
+
+    eng->slot[pos].start = STAMP ;
+    eng->slot[pos].timed = latency_wanted(eng->what) ;
+    eng->slot[pos].phase = SVC_PHASE_RUN ;
+    eng->run[eng->nrun++] = pos ;
+
+    trace_service(apids, pos, TRACE_EVENT_SENT, eng->what, 0, 0) ;
+
+    if (res->type == TYPE_CLASSIC) {
+
+        return event_classic(eng, pos) ;
+
+    } else if (res->type == TYPE_ONESHOT) {
+
+        eng->slot[pos].down = 0 ;
+
+        log_trace("sending ", !eng->what ? "start" : "stop", " to: ", res->sa.s + res->live.scandir) ;
+
+        if (!svc_oneshot_start(&eng->slot[pos].oneshot, res, !eng->what ? "up" : "down"))
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+
+    } else if (res->type == TYPE_MODULE) {
+
+        pid_t pid = fork() ;
+
+        if (pid < 0) {
+            log_warnusys("fork") ;
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+        }
+
+        if (!pid) {
+            selfpipe_finish() ;
+            int r = svc_compute_ns(res, eng->what, PINFO, updown, opt_updown, reloadmsg, data, PROPAGATE, apids, napid) ;
+            /** _exit() skips the flush made at exit() */
+            trace_flush() ;
+            _exit(r) ;
+        }
+
+        apids[pos].pid = pid ;
+    }
+
+    return 0 ;
+}
+
+static int event_signal(svc_engine_t *eng)
+{
+    log_flow() ;
+
+    for (;;) {
+
+        int s = selfpipe_read() ;
+        switch (s) {
+
+            case -1 : log_dieusys(LOG_EXIT_SYS,"selfpipe_read") ;
+            case 0 : return 0 ;
+            case SIGCHLD :
+
+                for (;;) {
+
+                    unsigned int i = 0, pos = 0 ;
+                    int wstat = 0 ;
+                    pid_t r = wait_nohang(&wstat) ;
+
+                    if (r < 0) {
+
+                        if (errno == ECHILD)
+                            break ;
+                        else
+                            log_dieusys(LOG_EXIT_SYS,"wait for children") ;
+
+                    } else if (!r) break ;
+
+                    for (; i < eng->nrun ; i++)
+                        if (eng->apids[eng->run[i]].pid == r)
+                            break ;
+
+                    if (i >= eng->nrun)
+                        continue ;
+
+                    pos = eng->run[i] ;
+
+                    if (WIFSIGNALED(wstat) || WEXITSTATUS(wstat))
+                        return event_fail(eng, pos, WIFSIGNALED(wstat) ? WTERMSIG(wstat) : WEXITSTATUS(wstat)) ;
+
+                    event_done(eng, pos) ;
+                }
+                break ;
+            case SIGTERM :
+            case SIGKILL :
+            case SIGINT :
+                    log_1_warn("received SIGINT, aborting transaction") ;
+                    return 111 ;
+            default : log_die(LOG_EXIT_SYS, "unexpected data in selfpipe") ;
+        }
+    }
+}
+
+static int event_fifo(svc_engine_t *eng)
+{
+    log_flow() ;
+
+    unsigned int i = 0 ;
+
+    if (ftrigr_updateb(&eng->fifo) < 0)
+        log_dieusys(LOG_EXIT_SYS, "update fifo") ;
+
+    while (i < eng->nrun) {
+
+        unsigned int pos = eng->run[i], j = 0 ;
+        svc_slot_t *slot = &eng->slot[pos] ;
+        int r ;
+
+        if (!slot->id) {
+            i++ ;
+            continue ;
+        }
+
+        eng->sa.len = 0 ;
+        r = ftrigr_checksa(&eng->fifo, slot->id, &eng->sa) ;
+        if (r < 0) {
+            log_warnusys("check events of: ", eng->apids[pos].res->sa.s + eng->apids[pos].res->name) ;
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+        }
+
+        for (r = 0 ; j < eng->sa.len && !r ; j++)
+            r = svc_classic_event(slot->wait, &slot->down, eng->sa.s[j]) ;
+
+        if (r < 0) {
+            log_warn("supervisor of: ", eng->apids[pos].res->sa.s + eng->apids[pos].res->name, " exited") ;
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+        }
+
+        if (r > 0) {
+
+            ftrigr_unsubscribe_g(&eng->fifo, slot->id, eng->deadline) ;
+            slot->id = 0 ;
+            /** event_done remove pos from the run list,
+             * the current index now points to the next slot */
+            event_done(eng, pos) ;
+            continue ;
+        }
+
+        i++ ;
+    }
+
+    return 0 ;
+}
+
+static int event_oneshot(svc_engine_t *eng, unsigned int pos)
+{
+    log_flow() ;
+
+    int r, e ;
+    svc_slot_t *slot = &eng->slot[pos] ;
+    resolve_service_t *res = eng->apids[pos].res ;
+
+    r = svc_oneshot_update(&slot->oneshot) ;
+
+    if (r < 0) {
+        log_warnusys("talk to oneshotd of: ", res->sa.s + res->name) ;
+        return event_fail(eng, pos, LOG_EXIT_SYS) ;
+    }
+
+    if (!r)
+        return 0 ;
+
+    svc_oneshot_end(&slot->oneshot) ;
+
+    e = svc_oneshot_exitcode(&slot->oneshot) ;
+    if (e)
+        return event_fail(eng, pos, e) ;
+
+    if (data[1] == 'r' && !slot->down) {
+        /** oneshot service are not handled automatically by
+         * s6-supervise. Signal is restart, so let it down first
+         * and force to bring it up again .*/
+        slot->down = 1 ;
+
+        log_trace("sending up to: ", res->sa.s + res->live.scandir) ;
+
+        if (!svc_oneshot_start(&slot->oneshot, res, "up"))
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+
+        return 0 ;
+    }
+
+    event_done(eng, pos) ;
+
+    return 0 ;
+}
+
+static int event_timeout(svc_engine_t *eng)
+{
+    log_flow() ;
+
+    unsigned int i = 0 ;
+
+    for (; i < eng->nrun ; i++) {
+
+        unsigned int pos = eng->run[i] ;
+        svc_oneshot_t *o = &eng->slot[pos].oneshot ;
+
+        if (svc_oneshot_fd(o) >= 0 && svc_oneshot_handshake(o) && !tain_future(&o->deadline)) {
+            errno = ETIMEDOUT ;
+            log_warnusys("connect to oneshotd of: ", eng->apids[pos].res->sa.s + eng->apids[pos].res->name) ;
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+        }
+
+        if (!tain_future(&eng->slot[pos].deadline)) {
+            errno = ETIMEDOUT ;
+            log_warnusys("handle service: ", eng->apids[pos].res->sa.s + eng->apids[pos].res->name) ;
+            return event_fail(eng, pos, LOG_EXIT_SYS) ;
+        }
+    }
+
+    return 0 ;
+}
+
+static int event_launch(pidservice_t *apids, unsigned int what, tain *deadline)
+{
+    log_flow() ;
+
+    int e = 0, r ;
+    unsigned int pos = 0, i ;
+    uint8_t fifo = 0 ;
+    svc_engine_t eng = {
+        .apids = apids,
+        .what = what,
+        .qhead = 0,
+        .qtail = 0,
+        .prio = 0,
+        .nrun = 0,
+        .jobs = PINFO->jobs,
+        .ndone = 0,
+        .fifo = FTRIGR_ZERO,
+        .fifo_started = 0,
+        .sa = STRALLOC_ZERO,
+        .deadline = deadline
+    } ;
+
+    eng.slot = (svc_slot_t *)malloc(napid * sizeof(svc_slot_t)) ;
+    eng.queue = (unsigned int *)malloc(napid * sizeof(unsigned int)) ;
+    eng.run = (unsigned int *)malloc(napid * sizeof(unsigned int)) ;
+    eng.x = (iopause_fd *)malloc((napid + 2) * sizeof(iopause_fd)) ;
+    eng.xpos = (unsigned int *)malloc((napid + 2) * sizeof(unsigned int)) ;
+
+    if (!eng.slot || !eng.queue || !eng.run || !eng.x || !eng.xpos)
+        log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+
+    memset(eng.slot, 0, napid * sizeof(svc_slot_t)) ;
+
+    if (PINFO->sched == SSEXEC_SCHED_CRITICAL) {
+
+        eng.prio = (uint32_t *)calloc(napid, sizeof(uint32_t)) ;
+        if (!eng.prio)
+            log_dieusys(LOG_EXIT_SYS, "allocate memory") ;
+    }
+
+    for (; pos < napid ; pos++) {
+
+        eng.slot[pos].oneshot.fd = -1 ;
+
+        if (apids[pos].res && apids[pos].res->type == TYPE_CLASSIC && opt_updown)
+            fifo = 1 ;
+    }
+
+    /** only count the dependencies part of the selection, the
+     * others are never notified. The notif lists only contain them */
+    for (pos = 0 ; pos < napid ; pos++)
+        for (i = 0 ; i < apids[pos].nnotif ; i++)
+            eng.slot[apids[pos].notif[i]].ndeps++ ;
+
+    int spfd = selfpipe_init() ;
+
+    if (spfd < 0)
+        log_dieusys(LOG_EXIT_SYS, "selfpipe_init") ;
+
+    if (!selfpipe_trap(SIGCHLD) ||
+        !selfpipe_trap(SIGINT) ||
+        !selfpipe_trap(SIGKILL) ||
+        !selfpipe_trap(SIGTERM) ||
+        !sig_altignore(SIGPIPE))
+            log_dieusys(LOG_EXIT_SYS, "selfpipe_trap") ;
+
+    if (fifo) {
+
+        if (!ftrigr_startf_g(&eng.fifo, deadline))
+            log_dieusys(LOG_EXIT_SYS, "ftrigr") ;
+
+        eng.fifo_started = 1 ;
+    }
+
+    /** the priorities must be final before the first event_push(),
+     * a skipped service below already releases its dependents */
+    if (eng.prio)
+        for (pos = 0 ; pos < napid ; pos++)
+            event_prio(&eng, pos) ;
+
+    for (pos = 0 ; pos < napid ; pos++) {
+
+        if (!FLAGS_ISSET(apids[pos].state, !what ? SVC_FLAGS_DOWN : SVC_FLAGS_UP)) {
+            log_warn("skipping service: ", apids[pos].res->sa.s + apids[pos].res->name, " -- already ", what ? "down" : "up") ;
+            event_done(&eng, pos) ;
+        }
+    }
+
+    for (pos = 0 ; pos < napid ; pos++) {
+        if (eng.slot[pos].phase == SVC_PHASE_WAIT && !eng.slot[pos].ndeps) {
+            trace_service(apids, pos, TRACE_EVENT_READY, what, 0, 0) ;
+            event_push(&eng, pos) ;
+        }
+    }
+
+    while (eng.ndone < napid) {
+
+        /** ready services wait at the queue until a job slot is free */
+        while (eng.qhead < eng.qtail && !e && (!eng.jobs || eng.nrun < eng.jobs))
+            e = event_exec(&eng, event_pop(&eng)) ;
+
+        if (e || eng.ndone >= napid)
+            break ;
+
+        if (!eng.nrun)
+            log_die(LOG_EXIT_SYS, "services selection can not be resolved -- please make a bug report") ;
+
+        unsigned int n = 0 ;
+        tain dead = *deadline ;
+
+        eng.x[n].fd = spfd ;
+        eng.x[n++].events = IOPAUSE_READ ;
+
+        if (eng.fifo_started) {
+            eng.x[n].fd = ftrigr_fd(&eng.fifo) ;
+            eng.x[n++].events = IOPAUSE_READ ;
+        }
+
+        for (i = 0 ; i < eng.nrun ; i++) {
+
+            unsigned int p = eng.run[i] ;
+
+            svc_oneshot_t *o = &eng.slot[p].oneshot ;
+
+            if (tain_less(&eng.slot[p].deadline, &dead))
+                dead = eng.slot[p].deadline ;
+
+            if (svc_oneshot_fd(o) >= 0) {
+
+                if (svc_oneshot_handshake(o) && tain_less(&o->deadline, &dead))
+                    dead = o->deadline ;
+
+                eng.xpos[n] = p ;
+                eng.x[n].fd = svc_oneshot_fd(o) ;
+                eng.x[n++].events = svc_oneshot_events(o) ;
+            }
+        }
+
+        r = iopause_g(eng.x, n, &dead) ;
+
+        if (r < 0)
+            log_dieusys(LOG_EXIT_SYS, "iopause") ;
+
+        if (!r) {
+
+            if (!tain_future(deadline)) {
+                errno = ETIMEDOUT ;
+                log_diesys(LOG_EXIT_SYS,"time out") ;
+            }
+
+            e = event_timeout(&eng) ;
+            if (e)
+                break ;
+
+            continue ;
+        }
+
+        if (eng.x[0].revents & IOPAUSE_READ) {
+            e = event_signal(&eng) ;
+            if (e)
+                break ;
+        }
+
+        if (eng.fifo_started && eng.x[1].revents & IOPAUSE_READ) {
+            e = event_fifo(&eng) ;
+            if (e)
+                break ;
+        }
+
+        for (i = eng.fifo_started ? 2 : 1 ; i < n && !e ; i++)
+            if (eng.x[i].revents & (IOPAUSE_READ|IOPAUSE_WRITE|IOPAUSE_EXCEPT) && eng.slot[eng.xpos[i]].phase == SVC_PHASE_RUN)
+                e = event_oneshot(&eng, eng.xpos[i]) ;
+
+        if (e)
+            break ;
+    }
+
+    if (e)
+        event_kill(&eng) ;
+
+    trace_transitions() ;
+
+    if (eng.fifo_started)
+        ftrigr_end(&eng.fifo) ;
+
+    selfpipe_finish() ;
+
+    stralloc_free(&eng.sa) ;
+    free(eng.slot) ;
+    free(eng.queue) ;
+    free(eng.prio) ;
+    free(eng.run) ;
+    free(eng.x) ;
+    free(eng.xpos) ;
+
+    return e ;
+}
+
 int svc_launch(pidservice_t *apids, unsigned int len, uint8_t what, graph_t *graph, struct resolve_hash_s **hres, ssexec_t *info, char const *rise, uint8_t rise_opt, uint8_t msg, char const *signal, uint8_t propagate)
 {
     log_flow() ;
@@ -613,11 +1442,11 @@ int svc_launch(pidservice_t *apids, unsigned int len, uint8_t what, graph_t *gra
     unsigned int e = 0, pos = 0 ;
     int r ;
     pid_t pid ;
-    pidservice_t apidservicetable[len] ;
-    pidservice_t_ref apidservice = apidservicetable ;
     tain deadline ;
 
     npid = 0 ;
+    ntransition = 0 ;
+    nnotification = 0 ;
     PINFO = info ;
     PROPAGATE = propagate ;
     napid = len ;
@@ -626,11 +1455,26 @@ int svc_launch(pidservice_t *apids, unsigned int len, uint8_t what, graph_t *gra
     reloadmsg = msg ;
     auto_strings(data, signal) ;
 
+    trace_open(info->live.s, info->ownerstr) ;
+
+    for (; pos < napid ; pos++)
+        trace_service(apids, pos, TRACE_EVENT_QUEUED, what, 0, 0) ;
+
     if (info->opt_timeout)
         tain_from_millisecs(&deadline, info->timeout) ;
     else
         deadline = tain_infinite_relative ;
 
+    /** the fork engine can not order the services waiting for
+     * a job slot, the critical path needs the event engine */
+    if (info->engine == SSEXEC_ENGINE_EVENT || info->sched == SSEXEC_SCHED_CRITICAL) {
+
+        tain_now_set_stopwatch_g() ;
+        tain_add_g(&deadline, &deadline) ;
+
+        return event_launch(apids, what, &deadline) ;
+    }
+
     int spfd = selfpipe_init() ;
 
     if (spfd < 0)
@@ -645,14 +1489,14 @@ int svc_launch(pidservice_t *apids, unsigned int len, uint8_t what, graph_t *gra
 
     iopause_fd x = { .fd = spfd, .events = IOPAUSE_READ, .revents = 0 } ;
 
-    for (; pos < napid ; pos++) {
-
-        apidservice[pos] = apids[pos] ;
-
-        if (pipe(apidservice[pos].pipe) < 0)
+    for (pos = 0 ; pos < napid ; pos++)
+        if (pipe(apids[pos].pipe) < 0)
             log_dieusys(LOG_EXIT_SYS, "pipe");
 
-    }
+    jobfd[0] = jobfd[1] = -1 ;
+
+    if (info->jobs && info->jobs < napid)
+        jobs_init(info->jobs) ;
 
     tain_now_set_stopwatch_g() ;
     tain_add_g(&deadline, &deadline) ;
@@ -668,16 +1512,16 @@ int svc_launch(pidservice_t *apids, unsigned int len, uint8_t what, graph_t *gra
 
             selfpipe_finish() ;
 
-            close(apidservice[pos].pipe[1]) ;
+            close(apids[pos].pipe[1]) ;
 
-            e = async(hres, apidservice, napid, pos, what, info, graph, &deadline) ;
+            e = async(hres, apids, napid, pos, what, info, graph, &deadline) ;
 
             goto end ;
         }
 
-        apidservice[pos].pid = pid ;
+        apids[pos].pid = pid ;
 
-        close(apidservice[pos].pipe[0]) ;
+        close(apids[pos].pipe[0]) ;
 
         npid++ ;
     }
@@ -695,18 +1539,25 @@ int svc_launch(pidservice_t *apids, unsigned int len, uint8_t what, graph_t *gra
         }
 
         if (x.revents & IOPAUSE_READ) {
-            e = handle_signal(apidservice, what, graph, info) ;
+            e = handle_signal(apids, what, graph, info) ;
 
             if (e)
                 break ;
         }
     }
 
+    trace_transitions() ;
+
     selfpipe_finish() ;
 
     for (pos = 0 ; pos < napid ; pos++) {
-        close(apidservice[pos].pipe[1]) ;
-        close(apidservice[pos].pipe[0]) ;
+        close(apids[pos].pipe[1]) ;
+        close(apids[pos].pipe[0]) ;
+    }
+
+    if (jobfd[0] >= 0) {
+        close(jobfd[0]) ;
+        close(jobfd[1]) ;
     }
 
     end:
@@ -0,0 +1,230 @@
+/*
+ * svc_oneshot.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/tai.h>
+#include <skalibs/djbunix.h>
+#include <skalibs/allreadwrite.h>
+#include <skalibs/socket.h>
+#include <skalibs/uint32.h>
+#include <skalibs/unixmessage.h>
+#include <skalibs/error.h>
+
+#include <66/service.h>
+#include <66/svc.h>
+
+/** s6-sudod protocol, see s6-sudoc(1)
+ *
+ * server -> client: banner B
+ * client -> server: banner A, argc, envc, argvlen, envlen packed
+ *                   as big endian uint32, argv and envp strings.
+ *                   The stdin, stdout, stderr of the client travel
+ *                   with the message.
+ * server -> client: one byte, errno of the spawn of the program, 0 on success
+ * server -> client: the wait status of the program packed as big endian uint32
+ *
+ * s6-sudod kills the program if the connection is closed before the end. */
+#define SVC_SUDO_BANNERA "s6-sudo a v1.0\n"
+#define SVC_SUDO_BANNERA_LEN (sizeof SVC_SUDO_BANNERA - 1)
+#define SVC_SUDO_BANNERB "s6-sudo b v1.0\n"
+#define SVC_SUDO_BANNERB_LEN (sizeof SVC_SUDO_BANNERB - 1)
+
+/** timeout of the connection to s6-sudod, s6-sudo -t 30000 */
+#define SVC_SUDO_TIMEOUT 30000
+
+/** Connect to the oneshotd daemon of @res and ask it to run
+ * 66-oneshot @action servicedir, like s6-sudo -e does.
+ * Nothing blocks: the connection is started and the request is
+ * queued, svc_oneshot_update() drives the handshake then reads the
+ * answer each time svc_oneshot_fd() is ready for svc_oneshot_events().
+ * The handshake must end before o->deadline.
+ *
+ * @Return 1 on success, 0 on failure */
+int svc_oneshot_start(svc_oneshot_t *o, resolve_service_t *res, char const *action)
+{
+    log_flow() ;
+
+    int fds[3] = { 0, 1, 2 } ;
+    char const *servicedir = res->sa.s + res->live.servicedir ;
+    char const *oneshotdir = res->sa.s + res->live.oneshotddir ;
+    size_t actionlen = strlen(action) + 1, servicedirlen = strlen(servicedir) + 1 ;
+    char pack[16] ;
+    char oneshot[strlen(oneshotdir) + 2 + 1] ;
+
+    struct iovec v[4] = {
+        { .iov_base = SVC_SUDO_BANNERA, .iov_len = SVC_SUDO_BANNERA_LEN },
+        { .iov_base = pack, .iov_len = 16 },
+        { .iov_base = (char *)action, .iov_len = actionlen },
+        { .iov_base = (char *)servicedir, .iov_len = servicedirlen }
+    } ;
+    unixmessagev m = { .v = v, .vlen = 4, .fds = fds, .nfds = 3 } ;
+
+    auto_strings(oneshot, oneshotdir, "/s") ;
+
+    o->len = 0 ;
+    o->wstat = 0 ;
+    o->step = SVC_ONESHOT_CONNECT ;
+
+    tain_now_set_stopwatch_g() ;
+    tain_from_millisecs(&o->deadline, SVC_SUDO_TIMEOUT) ;
+    tain_add_g(&o->deadline, &o->deadline) ;
+
+    o->fd = ipc_stream_nbcoe() ;
+    if (o->fd < 0)
+        log_warnusys_return(LOG_EXIT_ZERO, "create socket") ;
+
+    if (ipc_connect(o->fd, oneshot)) {
+
+        o->step = SVC_ONESHOT_BANNER ;
+
+    } else if (errno != EINPROGRESS && !error_isagain(errno)) {
+
+        log_warnusys("connect to: ", oneshot) ;
+        fd_close(o->fd) ;
+        o->fd = -1 ;
+        return 0 ;
+    }
+
+    /** argc, envc, argvlen, envlen. The environment is never
+     * passed, s6-sudo -e */
+    uint32_pack_big(pack, 2) ;
+    uint32_pack_big(pack + 4, 0) ;
+    uint32_pack_big(pack + 8, (uint32_t)(actionlen + servicedirlen)) ;
+    uint32_pack_big(pack + 12, 0) ;
+
+    /** the request is copied, it is sent after the banner */
+    unixmessage_sender_init(&o->b, o->fd) ;
+
+    if (!unixmessage_putv(&o->b, &m)) {
+        log_warnusys("prepare request to: ", oneshot) ;
+        svc_oneshot_end(o) ;
+        return 0 ;
+    }
+
+    return 1 ;
+}
+
+/** Make a step of the request without blocking.
+ *
+ * @Return 1 when the program exited, the wait status is at o->wstat
+ * @Return 0 if the answer is not complete yet
+ * @Return -1 on error */
+int svc_oneshot_update(svc_oneshot_t *o)
+{
+    log_flow() ;
+
+    ssize_t r ;
+
+    switch (o->step) {
+
+        case SVC_ONESHOT_CONNECT:
+
+            if (!socket_connected(o->fd))
+                return -1 ;
+
+            o->step = SVC_ONESHOT_BANNER ;
+            return 0 ;
+
+        case SVC_ONESHOT_BANNER:
+
+            while (o->len < SVC_SUDO_BANNERB_LEN) {
+
+                r = sanitize_read(fd_read(o->fd, o->buf + o->len, SVC_SUDO_BANNERB_LEN - o->len)) ;
+
+                if (r < 0)
+                    return -1 ;
+
+                if (!r)
+                    return 0 ;
+
+                o->len += r ;
+            }
+
+            if (memcmp(o->buf, SVC_SUDO_BANNERB, SVC_SUDO_BANNERB_LEN)) {
+                errno = EPROTO ;
+                return -1 ;
+            }
+
+            o->len = 0 ;
+            o->step = SVC_ONESHOT_SEND ;
+            /** the socket is usually writable, try at once */
+
+        case SVC_ONESHOT_SEND:
+
+            if (!unixmessage_sender_flush(&o->b))
+                return error_isagain(errno) ? 0 : -1 ;
+
+            unixmessage_sender_free(&o->b) ;
+            o->step = SVC_ONESHOT_WAIT ;
+            return 0 ;
+
+        default:
+            break ;
+    }
+
+    while (o->len < 5) {
+
+        r = sanitize_read(fd_read(o->fd, o->buf + o->len, 5 - o->len)) ;
+
+        if (r < 0)
+            return -1 ;
+
+        if (!r)
+            return 0 ;
+
+        /** the first byte is the result of the spawn */
+        if (!o->len && o->buf[0]) {
+            errno = (unsigned char)o->buf[0] ;
+            return -1 ;
+        }
+
+        o->len += r ;
+    }
+
+    {
+        uint32_t wstat ;
+        uint32_unpack_big(o->buf + 1, &wstat) ;
+        o->wstat = (int)wstat ;
+    }
+
+    return 1 ;
+}
+
+/** Close the connection. If the program is still running
+ * s6-sudod kills it. */
+void svc_oneshot_end(svc_oneshot_t *o)
+{
+    log_flow() ;
+
+    if (o->fd >= 0)
+        fd_close(o->fd) ;
+
+    unixmessage_sender_free(&o->b) ;
+    o->fd = -1 ;
+}
+
+/** Convert the wait status of the program into an exit code
+ * like s6-sudo does */
+int svc_oneshot_exitcode(svc_oneshot_t *o)
+{
+    return WIFSIGNALED(o->wstat) ? WTERMSIG(o->wstat) : WEXITSTATUS(o->wstat) ;
+}
@@ -0,0 +1,151 @@
+/*
+ * svc_send_classic.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/tai.h>
+#include <skalibs/iopause.h>
+#include <skalibs/stralloc.h>
+
+#include <s6/supervise.h>
+#include <s6/ftrigr.h>
+
+#include <66/service.h>
+#include <66/svc.h>
+
+/** Equivalent of s6-svc [ -w@wait ] -T @timeout -@sig scandir
+ * without spawning any process. The control is written directly to
+ * the supervise/control fifo and the event directory is followed
+ * through ftrigr until the @wait event is received.
+ *
+ * @sig: control letters, e.g. "u", "ru"
+ * @wait: one of dDuUrR, 0 to not wait
+ * @timeout: in milliseconds, 0 means infinite
+ *
+ * @Return 0 on success else an exit code */
+int svc_send_classic(resolve_service_t *res, char const *sig, char wait, unsigned int timeout)
+{
+    log_flow() ;
+
+    int r, e = 0 ;
+    uint16_t id = 0 ;
+    uint8_t down = 0, done = 0 ;
+    size_t pos = 0 ;
+    char const *name = res->sa.s + res->name ;
+    char const *scandir = res->sa.s + res->live.scandir ;
+    char const *eventdir = res->sa.s + res->live.eventdir ;
+    ftrigr_t fifo = FTRIGR_ZERO ;
+    stralloc sa = STRALLOC_ZERO ;
+    tain deadline ;
+
+    wait = svc_classic_wait(res, wait) ;
+
+    if (timeout)
+        tain_from_millisecs(&deadline, timeout) ;
+    else
+        deadline = tain_infinite_relative ;
+
+    tain_now_set_stopwatch_g() ;
+    tain_add_g(&deadline, &deadline) ;
+
+    if (wait) {
+
+        if (!ftrigr_startf_g(&fifo, &deadline))
+            log_warnusys_return(LOG_EXIT_SYS, "ftrigr") ;
+
+        log_trace("subcribe to fifo: ", eventdir) ;
+        id = ftrigr_subscribe_g(&fifo, eventdir, "[DdUux]", FTRIGR_REPEAT, &deadline) ;
+        if (!id) {
+            log_warnusys("subcribe to fifo: ", eventdir) ;
+            e = LOG_EXIT_SYS ;
+            goto end ;
+        }
+
+        /** the subscription is made, any change from now
+         * on will be reported by the fifo */
+        done = svc_classic_status(res, wait) ;
+    }
+
+    log_trace("sending -", sig, " to: ", scandir) ;
+
+    switch (s6_svc_writectl(scandir, S6_SUPERVISE_CTLDIR, sig, strlen(sig))) {
+
+        case -1: log_warnusys("control: ", scandir) ;
+                e = LOG_EXIT_SYS ;
+                goto end ;
+        case -2: log_warnsys("something is wrong with the ", scandir, "/" S6_SUPERVISE_CTLDIR " directory. errno reported") ;
+                e = LOG_EXIT_SYS ;
+                goto end ;
+        case 0: log_warnu("control: ", scandir, ": supervisor not listening") ;
+                e = LOG_EXIT_SYS ;
+                goto end ;
+    }
+
+    while (wait && !done) {
+
+        iopause_fd x = { .fd = ftrigr_fd(&fifo), .events = IOPAUSE_READ, .revents = 0 } ;
+
+        r = iopause_g(&x, 1, &deadline) ;
+
+        if (r < 0) {
+            log_warnusys("iopause") ;
+            e = LOG_EXIT_SYS ;
+            goto end ;
+        }
+
+        if (!r) {
+            errno = ETIMEDOUT ;
+            log_warnusys("handle service: ", name) ;
+            e = LOG_EXIT_SYS ;
+            goto end ;
+        }
+
+        if (ftrigr_updateb(&fifo) < 0) {
+            log_warnusys("update fifo") ;
+            e = LOG_EXIT_SYS ;
+            goto end ;
+        }
+
+        sa.len = 0 ;
+        r = ftrigr_checksa(&fifo, id, &sa) ;
+        if (r < 0) {
+            log_warnusys("check events of: ", name) ;
+            e = LOG_EXIT_SYS ;
+            goto end ;
+        }
+
+        for (pos = 0 ; r && pos < sa.len && !done ; pos++) {
+
+            int c = svc_classic_event(wait, &down, sa.s[pos]) ;
+
+            if (c < 0) {
+                log_warn("supervisor of: ", name, " exited") ;
+                e = LOG_EXIT_SYS ;
+                goto end ;
+            }
+
+            done = c ;
+        }
+    }
+
+    end:
+        if (wait)
+            ftrigr_end(&fifo) ;
+        stralloc_free(&sa) ;
+        return e ;
+}
@@ -0,0 +1,94 @@
+/*
+ * svc_send_oneshot.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <errno.h>
+
+#include <oblibs/log.h>
+
+#include <skalibs/tai.h>
+#include <skalibs/iopause.h>
+
+#include <66/service.h>
+#include <66/svc.h>
+
+/** Equivalent of s6-sudo -e -T @timeout oneshotd/s @action servicedir
+ * without spawning any process.
+ *
+ * @action: up or down
+ * @timeout: in milliseconds, 0 means infinite
+ *
+ * @Return 0 on success else an exit code */
+int svc_send_oneshot(resolve_service_t *res, char const *action, unsigned int timeout)
+{
+    log_flow() ;
+
+    int r ;
+    svc_oneshot_t o = SVC_ONESHOT_ZERO ;
+    tain deadline ;
+
+    log_trace("sending ", action, " to: ", res->sa.s + res->live.scandir) ;
+
+    if (!svc_oneshot_start(&o, res, action))
+        return LOG_EXIT_SYS ;
+
+    if (timeout)
+        tain_from_millisecs(&deadline, timeout) ;
+    else
+        deadline = tain_infinite_relative ;
+
+    tain_now_set_stopwatch_g() ;
+    tain_add_g(&deadline, &deadline) ;
+
+    for (;;) {
+
+        iopause_fd x = { .fd = svc_oneshot_fd(&o), .events = svc_oneshot_events(&o), .revents = 0 } ;
+        uint8_t handshake = svc_oneshot_handshake(&o) && tain_less(&o.deadline, &deadline) ;
+
+        r = iopause_g(&x, 1, handshake ? &o.deadline : &deadline) ;
+
+        if (r < 0) {
+            log_warnusys("iopause") ;
+            svc_oneshot_end(&o) ;
+            return LOG_EXIT_SYS ;
+        }
+
+        if (!r) {
+            errno = ETIMEDOUT ;
+            if (handshake) {
+                log_warnusys("connect to oneshotd of: ", res->sa.s + res->name) ;
+                svc_oneshot_end(&o) ;
+                return LOG_EXIT_SYS ;
+            }
+            log_warnusys("handle service: ", res->sa.s + res->name) ;
+            /** s6-sudod kills the program when the connection is closed */
+            svc_oneshot_end(&o) ;
+            return 99 ;
+        }
+
+        r = svc_oneshot_update(&o) ;
+
+        if (r < 0) {
+            log_warnusys("talk to oneshotd of: ", res->sa.s + res->name) ;
+            svc_oneshot_end(&o) ;
+            return LOG_EXIT_SYS ;
+        }
+
+        if (r)
+            break ;
+    }
+
+    svc_oneshot_end(&o) ;
+
+    return svc_oneshot_exitcode(&o) ;
+}
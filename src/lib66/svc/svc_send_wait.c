@@ -29,11 +29,12 @@ int svc_send_wait(char const *const *list, unsigned int nservice, char **sig, un
     pid_t pid ;
     int wstat ;
 
-    int nargc = 5 + nservice + siglen + info->opt_color + (info->opt_timeout ? 2 : 0) ;
+    int nargc = 5 + nservice + siglen + info->opt_color + (info->opt_timeout ? 2 : 0) + (info->engine ? 2 : 0) + (info->jobs ? 2 : 0) + (info->sched ? 2 : 0) ;
     char const *newargv[nargc] ;
     unsigned int m = 0 ;
     char verbo[UINT_FMT] ;
     char fmt[UINT32_FMT] ;
+    char jobs[UINT_FMT] ;
 
     verbo[uint_fmt(verbo, VERBOSITY)] = 0 ;
 
@@ -50,6 +51,22 @@ int svc_send_wait(char const *const *list, unsigned int nservice, char **sig, un
         newargv[m++] = fmt ;
     }
 
+    if (info->engine == SSEXEC_ENGINE_FORK) {
+        newargv[m++] = "-e" ;
+        newargv[m++] = "fork" ;
+    }
+
+    if (info->jobs) {
+        jobs[uint_fmt(jobs, info->jobs)] = 0 ;
+        newargv[m++] = "-j" ;
+        newargv[m++] = jobs ;
+    }
+
+    if (info->sched == SSEXEC_SCHED_CRITICAL) {
+        newargv[m++] = "-s" ;
+        newargv[m++] = "critical" ;
+    }
+
     newargv[m++] = "-v" ;
     newargv[m++] = verbo ;
     newargv[m++] = "signal" ;
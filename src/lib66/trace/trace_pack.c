@@ -0,0 +1,60 @@
+/*
+ * trace_pack.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+
+#include <skalibs/uint32.h>
+#include <skalibs/uint64.h>
+
+#include <66/trace.h>
+
+void trace_pack(char *pack, trace_record_t *rec)
+{
+    char *p = pack + 16 ;
+
+    uint64_pack_big(pack, rec->stamp) ;
+    uint32_pack_big(pack + 8, rec->txn) ;
+    pack[12] = (char)rec->kind ;
+    pack[13] = (char)rec->event ;
+    pack[14] = (char)rec->what ;
+    pack[15] = (char)rec->exitcode ;
+
+    memcpy(p, rec->name, TRACE_NAMELEN) ;
+    p += TRACE_NAMELEN ;
+    memcpy(p, rec->tree, TRACE_TREELEN) ;
+    p += TRACE_TREELEN ;
+    memcpy(p, rec->by, TRACE_NAMELEN) ;
+}
+
+void trace_unpack(char *pack, trace_record_t *rec)
+{
+    char *p = pack + 16 ;
+
+    uint64_unpack_big(pack, &rec->stamp) ;
+    uint32_unpack_big(pack + 8, &rec->txn) ;
+    rec->kind = (uint8_t)pack[12] ;
+    rec->event = (uint8_t)pack[13] ;
+    rec->what = (uint8_t)pack[14] ;
+    rec->exitcode = (uint8_t)pack[15] ;
+
+    memcpy(rec->name, p, TRACE_NAMELEN) ;
+    rec->name[TRACE_NAMELEN - 1] = 0 ;
+    p += TRACE_NAMELEN ;
+    memcpy(rec->tree, p, TRACE_TREELEN) ;
+    rec->tree[TRACE_TREELEN - 1] = 0 ;
+    p += TRACE_TREELEN ;
+    memcpy(rec->by, p, TRACE_NAMELEN) ;
+    rec->by[TRACE_NAMELEN - 1] = 0 ;
+}
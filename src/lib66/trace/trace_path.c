@@ -0,0 +1,28 @@
+/*
+ * trace_path.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+
+#include <oblibs/string.h>
+
+#include <66/trace.h>
+#include <66/constants.h>
+
+/** @dst must be at least TRACE_PATH_LEN(strlen(live), strlen(ownerstr)) */
+void trace_path(char *dst, char const *live, char const *ownerstr)
+{
+    size_t livelen = strlen(live) ;
+
+    auto_strings(dst, live, livelen && live[livelen - 1] == '/' ? "" : "/", SS_STATE + 1, "/", ownerstr, "/", SS_TRACE) ;
+}
@@ -0,0 +1,91 @@
+/*
+ * trace_read.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/uint32.h>
+#include <skalibs/genalloc.h>
+#include <skalibs/djbunix.h>
+
+#include <66/trace.h>
+#include <66/constants.h>
+
+/** @ga is filled with the records of the ring, the oldest first.
+ * Return 0 on error with errno set, ENOENT meaning nothing was
+ * traced yet */
+int trace_read(genalloc *ga, char const *live, char const *ownerstr)
+{
+    log_flow() ;
+
+    int fd, e = 0 ;
+    uint32_t version = 0, capacity = 0, count = 0, start = 0, n = 0, i = 0 ;
+    struct flock fl = { .l_type = F_RDLCK, .l_whence = SEEK_SET, .l_start = 0, .l_len = 0 } ;
+    char hdr[TRACE_HEADER_SIZE], pack[TRACE_RECORD_SIZE] ;
+    char file[TRACE_PATH_LEN(strlen(live), strlen(ownerstr))] ;
+
+    trace_path(file, live, ownerstr) ;
+
+    fd = open_read(file) ;
+    if (fd < 0)
+        return 0 ;
+
+    if (fcntl(fd, F_SETLKW, &fl) < 0)
+        goto err ;
+
+    if (pread(fd, hdr, TRACE_HEADER_SIZE, 0) != TRACE_HEADER_SIZE)
+        goto inval ;
+
+    uint32_unpack_big(hdr + 4, &version) ;
+    uint32_unpack_big(hdr + 8, &capacity) ;
+    uint32_unpack_big(hdr + 12, &count) ;
+
+    if (memcmp(hdr, TRACE_MAGIC, 4) || version != TRACE_VERSION || !capacity)
+        goto inval ;
+
+    n = count < capacity ? count : capacity ;
+    start = count < capacity ? 0 : count % capacity ;
+
+    for (; i < n ; i++) {
+
+        trace_record_t rec ;
+        off_t off = TRACE_HEADER_SIZE + (off_t)((start + i) % capacity) * TRACE_RECORD_SIZE ;
+
+        if (pread(fd, pack, TRACE_RECORD_SIZE, off) != TRACE_RECORD_SIZE)
+            goto inval ;
+
+        trace_unpack(pack, &rec) ;
+
+        if (!genalloc_append(trace_record_t, ga, &rec))
+            goto err ;
+    }
+
+    fd_close(fd) ;
+
+    return 1 ;
+
+    inval:
+        errno = EINVAL ;
+    err:
+        e = errno ;
+        fd_close(fd) ;
+        errno = e ;
+        return 0 ;
+}
@@ -0,0 +1,239 @@
+/*
+ * trace_write.c
+ *
+ * Copyright (c) 2018-2024 Eric Vidal <eric@obarun.org>
+ *
+ * All rights reserved.
+ *
+ * This file is part of Obarun. It is subject to the license terms in
+ * the LICENSE file found in the top-level directory of this
+ * distribution.
+ * This file may not be copied, modified, propagated, or distributed
+ * except according to the terms contained in the LICENSE file./
+ */
+
+#include <string.h>
+#include <stdint.h>
+#include <stdlib.h> // atexit
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <sys/stat.h>
+
+#include <oblibs/log.h>
+#include <oblibs/string.h>
+
+#include <skalibs/uint32.h>
+
+#include <66/trace.h>
+#include <66/constants.h>
+
+/** the descriptor is shared with the children of the transaction,
+ * fcntl locks being per process, they serialize the writers */
+static int tracefd = -1 ;
+static uint32_t txn = 0 ;
+
+/** the records of the transaction are kept here and written to the
+ * file at once, the buffer belongs to the process which filled it,
+ * a forked child drops the records inherited from its parent */
+#define TRACE_BUFFER_MAX 64
+static char buffer[TRACE_BUFFER_MAX * TRACE_RECORD_SIZE] ;
+static uint32_t nbuffer = 0 ;
+static pid_t owner = 0 ;
+
+static int trace_lock(int fd, short type)
+{
+    int r ;
+    struct flock fl = { .l_type = type, .l_whence = SEEK_SET, .l_start = 0, .l_len = 0 } ;
+
+    do r = fcntl(fd, F_SETLKW, &fl) ;
+    while (r < 0 && errno == EINTR) ;
+
+    return r ;
+}
+
+static void trace_copy(char *dst, char const *src, size_t len)
+{
+    size_t n = src ? strlen(src) : 0 ;
+
+    if (n >= len)
+        n = len - 1 ;
+
+    memcpy(dst, src, n) ;
+    dst[n] = 0 ;
+}
+
+int trace_open(char const *live, char const *ownerstr)
+{
+    log_flow() ;
+
+    struct stat st ;
+    char hdr[TRACE_HEADER_SIZE] ;
+    char file[TRACE_PATH_LEN(strlen(live), strlen(ownerstr))] ;
+
+    /** a module runs its own transaction from a child process */
+    txn = (uint32_t)getpid() ;
+
+    if (tracefd >= 0)
+        return 1 ;
+
+    trace_path(file, live, ownerstr) ;
+
+    tracefd = open(file, O_RDWR|O_CREAT|O_CLOEXEC, 0644) ;
+    if (tracefd < 0) {
+        /** the live state directory may not exist yet,
+         * the transaction is not traced in this case */
+        log_trace("unable to open trace file: ", file) ;
+        return 0 ;
+    }
+
+    /** a process leaving with _exit() or exec() must call trace_flush()
+     * itself, see also TRACE_EVENT_FAIL at trace_write_stamp() */
+    atexit(&trace_flush) ;
+
+    if (trace_lock(tracefd, F_WRLCK) < 0)
+        goto err ;
+
+    if (fstat(tracefd, &st) < 0)
+        goto err ;
+
+    if (st.st_size < TRACE_HEADER_SIZE ||
+        pread(tracefd, hdr, TRACE_HEADER_SIZE, 0) != TRACE_HEADER_SIZE ||
+        memcmp(hdr, TRACE_MAGIC, 4)) {
+
+        log_trace("initialize trace file: ", file) ;
+
+        memcpy(hdr, TRACE_MAGIC, 4) ;
+        uint32_pack_big(hdr + 4, TRACE_VERSION) ;
+        uint32_pack_big(hdr + 8, SS_TRACE_MAX) ;
+        uint32_pack_big(hdr + 12, 0) ;
+
+        if (ftruncate(tracefd, 0) < 0 ||
+            pwrite(tracefd, hdr, TRACE_HEADER_SIZE, 0) != TRACE_HEADER_SIZE)
+                goto err ;
+    }
+
+    trace_lock(tracefd, F_UNLCK) ;
+
+    return 1 ;
+
+    err:
+        log_warnusys("initialize trace file: ", file) ;
+        close(tracefd) ;
+        tracefd = -1 ;
+        return 0 ;
+}
+
+/** 0 if the clock can not be read */
+uint64_t trace_now(void)
+{
+    struct timespec ts ;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) < 0)
+        return 0 ;
+
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec ;
+}
+
+void trace_write(uint8_t kind, uint8_t event, uint8_t what, char const *name, char const *tree, char const *by, uint8_t exitcode)
+{
+    trace_write_stamp(trace_now(), kind, event, what, name, tree, by, exitcode) ;
+}
+
+/** Write the buffered records at the ring under a single lock of
+ * the file. Tracing never fails a transaction, errors are silently
+ * dropped. */
+void trace_flush(void)
+{
+    log_flow() ;
+
+    uint32_t capacity = 0, count = 0, pos = 0 ;
+    char hdr[TRACE_HEADER_SIZE] ;
+
+    if (tracefd < 0 || !nbuffer)
+        return ;
+
+    if (owner != getpid()) {
+        nbuffer = 0 ;
+        return ;
+    }
+
+    if (trace_lock(tracefd, F_WRLCK) < 0)
+        goto end ;
+
+    if (pread(tracefd, hdr, TRACE_HEADER_SIZE, 0) != TRACE_HEADER_SIZE)
+        goto unlock ;
+
+    uint32_unpack_big(hdr + 8, &capacity) ;
+    uint32_unpack_big(hdr + 12, &count) ;
+
+    if (!capacity)
+        goto unlock ;
+
+    /** the buffer may wrap around the end of the ring */
+    while (pos < nbuffer) {
+
+        uint32_t slot = count % capacity, n = nbuffer - pos ;
+        size_t len ;
+
+        if (n > capacity - slot)
+            n = capacity - slot ;
+
+        len = (size_t)n * TRACE_RECORD_SIZE ;
+
+        if (pwrite(tracefd, buffer + (size_t)pos * TRACE_RECORD_SIZE, len, TRACE_HEADER_SIZE + (off_t)slot * TRACE_RECORD_SIZE) != (ssize_t)len)
+            break ;
+
+        pos += n ;
+        count += n ;
+    }
+
+    if (pos) {
+
+        uint32_pack_big(hdr + 12, count) ;
+        if (pwrite(tracefd, hdr + 12, 4, 12) != 4)
+            log_trace("update trace header") ;
+    }
+
+    unlock:
+        trace_lock(tracefd, F_UNLCK) ;
+    end:
+        nbuffer = 0 ;
+}
+
+/** Tracing never fails a transaction, errors are silently dropped.
+ * @stamp comes from trace_now(), it allows to record an event which
+ * happened before the opening of the file, e.g. at boot time. A
+ * failure is written at once, the process may die right after it */
+void trace_write_stamp(uint64_t stamp, uint8_t kind, uint8_t event, uint8_t what, char const *name, char const *tree, char const *by, uint8_t exitcode)
+{
+    log_flow() ;
+
+    trace_record_t rec ;
+    pid_t pid = getpid() ;
+
+    if (tracefd < 0 || !stamp)
+        return ;
+
+    if (owner != pid) {
+        nbuffer = 0 ;
+        owner = pid ;
+    }
+
+    rec.stamp = stamp ;
+    rec.txn = txn ;
+    rec.kind = kind ;
+    rec.event = event ;
+    rec.what = what ;
+    rec.exitcode = exitcode ;
+    trace_copy(rec.name, name, TRACE_NAMELEN) ;
+    trace_copy(rec.tree, tree, TRACE_TREELEN) ;
+    trace_copy(rec.by, by, TRACE_NAMELEN) ;
+
+    trace_pack(buffer + (size_t)nbuffer * TRACE_RECORD_SIZE, &rec) ;
+    nbuffer++ ;
+
+    if (nbuffer == TRACE_BUFFER_MAX || event == TRACE_EVENT_FAIL)
+        trace_flush() ;
+}
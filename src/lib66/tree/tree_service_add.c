@@ -20,13 +20,13 @@
 #include <66/tree.h>
 #include <66/ssexec.h>
 
-void tree_service_add(char const *treename, char const *service, ssexec_t *info)
+void tree_service_add(resolve_txn_t *txn, char const *treename, char const *service, ssexec_t *info)
 {
     log_flow() ;
 
     size_t len = strlen(service) ;
-    resolve_tree_t tres = RESOLVE_TREE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_TREE, &tres) ;
+    resolve_wrapper_t_ref wres = 0 ;
+    resolve_tree_t_ref tres = 0 ;
 
     if (!tree_isvalid(info->base.s, treename)) {
 
@@ -38,6 +38,13 @@ void tree_service_add(char const *treename, char const *service, ssexec_t *info)
         newargv[m++] = treename ;
         newargv[m++] = 0 ;
 
+        /** the creation of the tree writes resolve files by itself,
+         * flush the pending ones before and read them again after */
+        if (!resolve_txn_commit(txn))
+            log_dieu(LOG_EXIT_SYS, "write pending resolve files") ;
+
+        resolve_txn_free(txn) ;
+
         char const *prog = PROG ;
         PROG = "tree" ;
         if (ssexec_tree_admin(nargc, newargv, info))
@@ -46,14 +53,16 @@ void tree_service_add(char const *treename, char const *service, ssexec_t *info)
 
     }
 
-    if (resolve_read_g(wres, info->base.s, treename) <= 0)
+    if (resolve_txn_get(&wres, txn, DATA_TREE, info->base.s, treename) <= 0)
         log_dieusys(LOG_EXIT_SYS, "read resolve file of tree: ", treename) ;
 
-    _alloc_stk_(stk, strlen(tres.sa.s + tres.contents) + len + 3) ;
+    tres = (resolve_tree_t *)wres->obj ;
+
+    _alloc_stk_(stk, strlen(tres->sa.s + tres->contents) + len + 3) ;
 
-    if (tres.ncontents) {
+    if (tres->ncontents) {
 
-        if (!stack_string_clean(&stk, tres.sa.s + tres.contents))
+        if (!stack_string_clean(&stk, tres->sa.s + tres->contents))
             log_dieusys(LOG_EXIT_SYS, "convert string to stack") ;
 
         if (stack_retrieve_element(&stk, service) < 0) {
@@ -74,16 +83,13 @@ void tree_service_add(char const *treename, char const *service, ssexec_t *info)
 
     }
 
-    tres.ncontents = stack_count_element(&stk) ;
+    tres->ncontents = stack_count_element(&stk) ;
 
     if (!stack_string_rebuild_with_delim(&stk, ' '))
         log_dieu(LOG_EXIT_SYS, "convert stack to string") ;
 
-    if (!resolve_modify_field(wres, E_RESOLVE_TREE_CONTENTS, stk.s))
-        log_dieusys(LOG_EXIT_SYS, "modify resolve file of tree: ", treename) ;
-
-    if (!resolve_write_g(wres, info->base.s, treename))
-        log_dieusys(LOG_EXIT_SYS, "write resolve file of tree: ", treename) ;
-
-    resolve_free(wres) ;
+    /** written at the commit of @txn */
+    if (!resolve_modify_field(wres, E_RESOLVE_TREE_CONTENTS, stk.s) ||
+        !resolve_txn_touch(txn, DATA_TREE, info->base.s, treename))
+            log_dieusys(LOG_EXIT_SYS, "modify resolve file of tree: ", treename) ;
 }
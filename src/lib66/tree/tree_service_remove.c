@@ -19,23 +19,25 @@
 #include <66/resolve.h>
 #include <66/tree.h>
 
-void tree_service_remove(char const *base, char const *treename, char const *service)
+void tree_service_remove(resolve_txn_t *txn, char const *base, char const *treename, char const *service)
 {
     log_flow() ;
 
-    resolve_tree_t tres = RESOLVE_TREE_ZERO ;
-    resolve_wrapper_t_ref wres = resolve_set_struct(DATA_TREE, &tres) ;
+    resolve_wrapper_t_ref wres = 0 ;
+    resolve_tree_t_ref tres = 0 ;
     char *str = 0 ;
 
-    if (resolve_read_g(wres, base, treename) <= 0)
+    if (resolve_txn_get(&wres, txn, DATA_TREE, base, treename) <= 0)
         log_dieusys(LOG_EXIT_SYS, "read resolve file of tree: ", treename) ;
 
-    if (tres.ncontents) {
+    tres = (resolve_tree_t *)wres->obj ;
 
-        size_t clen = strlen(tres.sa.s + tres.contents) ;
+    if (tres->ncontents) {
+
+        size_t clen = strlen(tres->sa.s + tres->contents) ;
         _alloc_stk_(stk, clen + 1) ;
 
-        if (!stack_string_clean(&stk, tres.sa.s + tres.contents))
+        if (!stack_string_clean(&stk, tres->sa.s + tres->contents))
             log_dieusys(LOG_EXIT_SYS, "convert string to stack") ;
 
         if (!stack_remove_element_g(&stk, service))
@@ -48,20 +50,17 @@ void tree_service_remove(char const *base, char const *treename, char const *ser
 
             str = stk.s ;
 
-            tres.ncontents = stack_count_element(&stk) ;
+            tres->ncontents = stack_count_element(&stk) ;
 
         } else {
 
-            tres.ncontents = 0 ;
+            tres->ncontents = 0 ;
             str = "" ;
         }
 
-        if (!resolve_modify_field(wres, E_RESOLVE_TREE_CONTENTS, str))
-            log_dieusys(LOG_EXIT_SYS, "modify resolve file of: ", treename) ;
-
-        if (!resolve_write_g(wres, base, treename))
-            log_dieusys(LOG_EXIT_SYS, "write resolve file of tree: ", treename) ;
+        /** written at the commit of @txn */
+        if (!resolve_modify_field(wres, E_RESOLVE_TREE_CONTENTS, str) ||
+            !resolve_txn_touch(txn, DATA_TREE, base, treename))
+                log_dieusys(LOG_EXIT_SYS, "modify resolve file of: ", treename) ;
     }
-
-    resolve_free(wres) ;
 }